@@ -60,7 +60,7 @@ int main(void)
     {
         cout << "Hello Blank Application" << endl;
 
-        srand(static_cast<unsigned>(time(nullptr)));
+        set_random_seed(static_cast<uint64_t>(time(nullptr)));
 
 		// Here your code
 
@@ -29,7 +29,7 @@ int main(void)
     {
         cout << "OpenNN. Airfoil Self-Noise Example." << endl;
 
-        srand(static_cast<unsigned>(time(nullptr)));
+        set_random_seed(static_cast<uint64_t>(time(nullptr)));
 
         ///@todo Does not work in linux
 
@@ -29,7 +29,7 @@ int main(void)
     {
         cout << "OpenNN. Leukemia Example." << endl;
 
-        srand(static_cast<unsigned>(time(nullptr)));
+        set_random_seed(static_cast<uint64_t>(time(nullptr)));
 
         // Data set
         DataSet data_set("../data/leukemia.csv", ';', false);
@@ -26,7 +26,7 @@ int main(void)
     {
         cout << "OpenNN. Logical Operations Example." << endl;
 
-        srand(static_cast<unsigned>(time(nullptr)));
+        set_random_seed(static_cast<uint64_t>(time(nullptr)));
 
         // Data set
 
@@ -25,7 +25,7 @@ int main(void)
     {
         cout << "OpenNN. Pima Indians Diabetes Example." << endl;
 
-        srand(static_cast<unsigned>(time(nullptr)));
+        set_random_seed(static_cast<uint64_t>(time(nullptr)));
 
         // Data set
 
@@ -28,7 +28,7 @@ int main(void)
     {
         cout << "OpenNN. Simple Function Regression Example." << endl;
 
-        srand(static_cast<unsigned>(time(nullptr)));
+        set_random_seed(static_cast<uint64_t>(time(nullptr)));
 
         // Data set
 
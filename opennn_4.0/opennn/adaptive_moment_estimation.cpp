@@ -57,6 +57,104 @@ AdaptiveMomentEstimation::~AdaptiveMomentEstimation()
 }
 
 
+/// Parameters number constructor.
+/// It creates the state of an update rule for a given number of parameters, with all the decays set to zero.
+/// @param new_parameters_number Number of parameters.
+
+AdaptiveMomentEstimation::OptimizationData::OptimizationData(const size_t& new_parameters_number)
+{
+   set_parameters_number(new_parameters_number);
+}
+
+
+/// Sets a new number of parameters and restarts the state of the update rule.
+/// @param new_parameters_number Number of parameters.
+
+void AdaptiveMomentEstimation::OptimizationData::set_parameters_number(const size_t& new_parameters_number)
+{
+   iteration = 0;
+   learning_rate_factor = 1.0;
+   learning_rate = 0.0;
+
+   gradient_exponential_decay.set(new_parameters_number, 0.0);
+   square_gradient_exponential_decay.set(new_parameters_number, 0.0);
+
+   maximum_square_gradient_exponential_decay.set();
+   parameters_increment.set();
+}
+
+
+/// Returns a constant reference to the learning rate schedule object used along the training.
+
+const LearningRateSchedule& AdaptiveMomentEstimation::get_learning_rate_schedule() const
+{
+   return learning_rate_schedule;
+}
+
+
+/// Returns a pointer to the learning rate schedule object used along the training.
+
+LearningRateSchedule* AdaptiveMomentEstimation::get_learning_rate_schedule_pointer()
+{
+   return &learning_rate_schedule;
+}
+
+
+/// Returns the rule used for updating the parameters after each batch.
+
+const AdaptiveMomentEstimation::UpdateMethod& AdaptiveMomentEstimation::get_update_method() const
+{
+   return update_method;
+}
+
+
+/// Returns the name of the rule used for updating the parameters after each batch.
+
+string AdaptiveMomentEstimation::write_update_method() const
+{
+   switch(update_method)
+   {
+      case Adam:
+      {
+         return "Adam";
+      }
+
+      case AdamW:
+      {
+         return "AdamW";
+      }
+
+      case AMSGrad:
+      {
+         return "AMSGrad";
+      }
+
+      case RMSProp:
+      {
+         return "RMSProp";
+      }
+
+      case Adagrad:
+      {
+         return "Adagrad";
+      }
+
+      case LAMB:
+      {
+         return "LAMB";
+      }
+   }
+
+   ostringstream buffer;
+
+   buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+          << "string write_update_method() const method.\n"
+          << "Unknown update method.\n";
+
+   throw logic_error(buffer.str());
+}
+
+
 /// Returns the initial learning rate.
 
 const double& AdaptiveMomentEstimation::get_initial_learning_rate() const
@@ -89,6 +187,14 @@ const double& AdaptiveMomentEstimation::get_epsilon() const
 }
 
 
+/// Returns the decoupled weight decay rate, used by AdamW and LAMB.
+
+const double& AdaptiveMomentEstimation::get_weight_decay() const
+{
+   return weight_decay;
+}
+
+
 /// Returns the minimum value for the norm of the parameters vector at wich a warning message is
 /// written to the screen.
 
@@ -207,6 +313,38 @@ const bool& AdaptiveMomentEstimation::get_reserve_selection_error_history() cons
 }
 
 
+/// Returns true if the selection error is calculated on a background thread, concurrently with the training, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_asynchronous_selection_error() const
+{
+   return asynchronous_selection_error;
+}
+
+
+/// Returns the number of epochs between two calculations of the selection error.
+
+const size_t& AdaptiveMomentEstimation::get_selection_error_period() const
+{
+   return selection_error_period;
+}
+
+
+/// Returns the fraction of the selection instances on which the selection error is calculated.
+
+const double& AdaptiveMomentEstimation::get_selection_instances_fraction() const
+{
+   return selection_instances_fraction;
+}
+
+
+/// Returns the number of batches whose gradients are accumulated before each update of the parameters.
+
+const size_t& AdaptiveMomentEstimation::get_gradient_accumulation_steps() const
+{
+   return gradient_accumulation_steps;
+}
+
+
 /// Sets a pointer to a loss index object to be associated to the gradient descent object.
 /// It also sets that loss index to the learning rate algorithm.
 /// @param new_loss_index_pointer Pointer to a loss index object.
@@ -221,6 +359,8 @@ void AdaptiveMomentEstimation::set_default()
 {
    // TRAINING OPERATORS
 
+   update_method = Adam;
+
    initial_learning_rate = 0.001;
    initial_decay = 0.0;
    beta_1 = 0.9;
@@ -228,6 +368,8 @@ void AdaptiveMomentEstimation::set_default()
 
    epsilon =1.e-7;
 
+   weight_decay = 0.01;
+
    // TRAINING PARAMETERS
 
    warning_parameters_norm = 1.0e6;
@@ -252,6 +394,16 @@ void AdaptiveMomentEstimation::set_default()
    reserve_training_error_history = true;
    reserve_selection_error_history = false;
 
+   // SELECTION ERROR
+
+   asynchronous_selection_error = false;
+   selection_error_period = 1;
+   selection_instances_fraction = 1.0;
+
+   // GRADIENT ACCUMULATION
+
+   gradient_accumulation_steps = 1;
+
    // UTILITIES
 
    display = true;
@@ -281,6 +433,66 @@ void AdaptiveMomentEstimation::set_reserve_all_training_history(const bool& new_
 }
 
 
+/// Sets a new rule for updating the parameters after each batch.
+/// @param new_update_method Update method.
+
+void AdaptiveMomentEstimation::set_update_method(const UpdateMethod& new_update_method)
+{
+   update_method = new_update_method;
+}
+
+
+/// Sets a new rule for updating the parameters after each batch from a string containing its name.
+/// Possible values are:
+/// <ul>
+/// <li> "Adam"
+/// <li> "AdamW"
+/// <li> "AMSGrad"
+/// <li> "RMSProp"
+/// <li> "Adagrad"
+/// <li> "LAMB"
+/// </ul>
+/// @param new_update_method_name Name of the update method.
+
+void AdaptiveMomentEstimation::set_update_method(const string& new_update_method_name)
+{
+   if(new_update_method_name == "Adam")
+   {
+      update_method = Adam;
+   }
+   else if(new_update_method_name == "AdamW")
+   {
+      update_method = AdamW;
+   }
+   else if(new_update_method_name == "AMSGrad")
+   {
+      update_method = AMSGrad;
+   }
+   else if(new_update_method_name == "RMSProp")
+   {
+      update_method = RMSProp;
+   }
+   else if(new_update_method_name == "Adagrad")
+   {
+      update_method = Adagrad;
+   }
+   else if(new_update_method_name == "LAMB")
+   {
+      update_method = LAMB;
+   }
+   else
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_update_method(const string&) method.\n"
+             << "Unknown update method: " << new_update_method_name << ".\n";
+
+      throw logic_error(buffer.str());
+   }
+}
+
+
 /// Sets a new learning rate.
 /// @param new_learning_rate.
 
@@ -317,6 +529,31 @@ void AdaptiveMomentEstimation::set_epsilon(const double& new_epsilon)
 }
 
 
+/// Sets a new decoupled weight decay rate.
+/// At each update, AdamW and LAMB shrink the parameters by this fraction of the learning rate.
+/// @param new_weight_decay Weight decay rate.
+
+void AdaptiveMomentEstimation::set_weight_decay(const double& new_weight_decay)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_weight_decay < 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_weight_decay(const double&) method.\n"
+             << "Weight decay must be equal or greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   weight_decay = new_weight_decay;
+}
+
+
 /// Sets a new value for the parameters vector norm at which a warning message is written to the screen.
 /// @param new_warning_parameters_norm Warning norm of parameters vector value.
 
@@ -629,6 +866,78 @@ void AdaptiveMomentEstimation::set_reserve_selection_error_history(const bool& n
 }
 
 
+/// Makes the selection error to be calculated on a background thread or not.
+/// In that case, the selection error of the parameters at the end of an epoch is calculated while the next epochs are trained,
+/// and it is taken into account by the early stopping one evaluation later.
+/// Neural networks with recurrent layers, which keep a state, are always evaluated on the training thread.
+/// @param new_asynchronous_selection_error True if the selection error is to be calculated asynchronously, false otherwise.
+
+void AdaptiveMomentEstimation::set_asynchronous_selection_error(const bool& new_asynchronous_selection_error)
+{
+   asynchronous_selection_error = new_asynchronous_selection_error;
+}
+
+
+/// Sets the number of epochs between two calculations of the selection error.
+/// @param new_selection_error_period Number of epochs. If it is 0, the selection error is calculated every epoch.
+
+void AdaptiveMomentEstimation::set_selection_error_period(const size_t& new_selection_error_period)
+{
+   selection_error_period = max(new_selection_error_period, static_cast<size_t>(1));
+}
+
+
+/// Sets the fraction of the selection instances on which the selection error is calculated.
+/// A different random sample is used each time, and the error over the whole selection subset is extrapolated from it.
+/// @param new_selection_instances_fraction Fraction of selection instances, between 0 and 1.
+
+void AdaptiveMomentEstimation::set_selection_instances_fraction(const double& new_selection_instances_fraction)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_selection_instances_fraction <= 0.0 || new_selection_instances_fraction > 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_selection_instances_fraction(const double&) method.\n"
+             << "Fraction of selection instances must be greater than 0 and equal or less than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   selection_instances_fraction = new_selection_instances_fraction;
+}
+
+
+/// Sets the number of batches whose gradients are accumulated before each update of the parameters.
+/// This allows an effective batch size larger than the one which fits in memory.
+/// The batch gradients are added, which gives the gradient of the union of the accumulated batches.
+/// @param new_gradient_accumulation_steps Number of accumulated batches, greater than 0.
+
+void AdaptiveMomentEstimation::set_gradient_accumulation_steps(const size_t& new_gradient_accumulation_steps)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_gradient_accumulation_steps == 0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_gradient_accumulation_steps(const size_t&) method.\n"
+             << "Number of gradient accumulation steps must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   gradient_accumulation_steps = new_gradient_accumulation_steps;
+}
+
+
 /// Sets a new number of iterations between the training showing progress.
 /// @param new_display_period
 /// Number of iterations between the training showing progress.
@@ -669,7 +978,7 @@ OptimizationAlgorithm::Results AdaptiveMomentEstimation::perform_training()
 
    // Start training
 
-   if(display) cout << "Training with adaptive moment estimator \"Adam\" ...\n";
+   if(display) cout << "Training with adaptive moment estimator \"" << write_update_method() << "\" ...\n";
 
    // Data set stuff
 
@@ -719,23 +1028,38 @@ OptimizationAlgorithm::Results AdaptiveMomentEstimation::perform_training()
 
    results.resize_training_history(maximum_epochs_number + 1);
 
-   Vector<double> gradient_exponential_decay(parameters_number,0.0);
-   Vector<double> square_gradient_exponential_decay(parameters_number,0.0);
+   learning_rate_schedule.reset();
+
+   OptimizationData optimization_data(parameters_number);
+
+   optimization_data.layers_parameters_numbers = neural_network_pointer->get_trainable_layers_parameters_numbers();
+
+    const size_t timesteps = neural_network_pointer->get_timesteps();
+
+   // Selection error stuff
+
+   const bool asynchronous = asynchronous_selection_error
+                          && !neural_network_pointer->has_recurrent_layer()
+                          && !neural_network_pointer->has_long_short_term_memory_layer();
+
+   future<double> selection_error_future;
 
-   Vector<double> last_gradient_exponential_decay(parameters_number,0.0);
-   Vector<double> last_square_gradient_exponential_decay(parameters_number,0.0);
+   Vector<double> selection_error_parameters;
+   Vector<double> pending_selection_error_parameters;
 
-   size_t iteration_count = 0;
+   bool selection_error_evaluated = false;
 
-    bool is_forecasting = false;
+   // Gradient accumulation stuff
 
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+   Vector<double> accumulated_gradient(gradient_accumulation_steps > 1 ? parameters_number : 0, 0.0);
+
+   size_t accumulated_batches_number = 0;
 
    // Main loop
 
    for(size_t epoch = 0; epoch <= maximum_epochs_number; epoch++)
    {
-       const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+       const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
        const size_t batches_number = training_batches.size();
 
@@ -749,31 +1073,49 @@ OptimizationAlgorithm::Results AdaptiveMomentEstimation::perform_training()
 
        for(size_t iteration = 0; iteration < batches_number; iteration++)
        {
-           iteration_count++;
-
-           learning_rate = initial_learning_rate*sqrt(1.0 - pow(beta_2, iteration_count))/(1.0 - pow(beta_1, iteration_count));
+           optimization_data.learning_rate_factor = learning_rate_schedule.calculate_learning_rate_factor(epoch + (iteration + 1.0)/batches_number);
 
            first_order_loss = loss_index_pointer->calculate_batch_first_order_loss(training_batches[iteration]);
 
-           parameters = neural_network_pointer->get_parameters();
-
            // Loss
 
            loss += first_order_loss.loss;
 
            // Gradient
 
-           gradient_exponential_decay = last_gradient_exponential_decay*beta_1 + first_order_loss.gradient*(1 - beta_1);
+           if(gradient_accumulation_steps > 1)
+           {
+               accumulated_gradient += first_order_loss.gradient;
+
+               accumulated_batches_number++;
+
+               if(accumulated_batches_number < gradient_accumulation_steps && iteration != batches_number - 1) continue;
 
-           last_gradient_exponential_decay = gradient_exponential_decay;
+               // The regularization gradient, included in every batch gradient, is counted only once
 
-           square_gradient_exponential_decay = last_square_gradient_exponential_decay*beta_2 + first_order_loss.gradient*first_order_loss.gradient*(1 - beta_2);
+               if(accumulated_batches_number > 1 && loss_index_pointer->get_regularization_method() != LossIndex::NoRegularization)
+               {
+                   accumulated_gradient -= loss_index_pointer->calculate_regularization_gradient()
+                                         *loss_index_pointer->get_regularization_weight()*static_cast<double>(accumulated_batches_number - 1);
+               }
+           }
 
-           last_square_gradient_exponential_decay = square_gradient_exponential_decay;
+           const Vector<double>& gradient = gradient_accumulation_steps > 1 ? accumulated_gradient : first_order_loss.gradient;
 
            // Update parameters
 
-           neural_network_pointer->set_parameters(parameters - gradient_exponential_decay*learning_rate/(square_root(square_gradient_exponential_decay)+ epsilon));
+           update_parameters(gradient, optimization_data, parameters);
+
+           neural_network_pointer->set_parameters(parameters);
+
+           learning_rate = optimization_data.learning_rate;
+
+           if(gradient_accumulation_steps > 1)
+           {
+               accumulated_gradient.initialize(0.0);
+
+               accumulated_batches_number = 0;
+           }
 
         }
 
@@ -785,21 +1127,73 @@ OptimizationAlgorithm::Results AdaptiveMomentEstimation::perform_training()
 
        training_error = loss/static_cast<double>(batches_number);
 
-       if(selection_instances_number > 0) selection_error = loss_index_pointer->calculate_selection_error();
+       // Selection error
+
+       bool selection_error_updated = false;
 
-       if(epoch == 0)
+       if(selection_instances_number == 0)
        {
-          minimum_selection_error = selection_error;
-          minimum_selection_error_parameters = neural_network_pointer->get_parameters();
+           selection_error_parameters = parameters;
+
+           selection_error_updated = true;
        }
-       else if(epoch != 0 && selection_error > old_selection_error)
+       else if(epoch % selection_error_period == 0)
        {
-          selection_failures++;
+           Vector<Vector<size_t>> selection_batches = data_set_pointer->get_selection_batches(true, timesteps);
+
+           const size_t selection_batches_number
+                   = max(static_cast<size_t>(1), static_cast<size_t>(ceil(selection_instances_fraction*selection_batches.size())));
+
+           selection_batches.resize(selection_batches_number);
+
+           if(asynchronous)
+           {
+               // The selection error of the previous snapshot is collected, and the current parameters are evaluated in background
+
+               if(selection_error_future.valid())
+               {
+                   selection_error = selection_error_future.get();
+
+                   selection_error_parameters.swap(pending_selection_error_parameters);
+
+                   selection_error_updated = true;
+               }
+
+               pending_selection_error_parameters = parameters;
+
+               selection_error_future = async(launch::async, &LossIndex::calculate_selection_error_estimate,
+                                              loss_index_pointer, pending_selection_error_parameters, selection_batches);
+           }
+           else
+           {
+               selection_error = loss_index_pointer->calculate_selection_error_estimate(parameters, selection_batches);
+
+               selection_error_parameters = parameters;
+
+               selection_error_updated = true;
+           }
        }
-       else if(selection_error <= minimum_selection_error)
+
+       if(selection_error_updated)
        {
-          minimum_selection_error = selection_error;
-          minimum_selection_error_parameters = neural_network_pointer->get_parameters();
+           if(selection_instances_number > 0) learning_rate_schedule.update_selection_error(selection_error);
+
+           if(!selection_error_evaluated)
+           {
+              minimum_selection_error = selection_error;
+              minimum_selection_error_parameters = selection_error_parameters;
+
+              selection_error_evaluated = true;
+           }
+           else if(selection_error > old_selection_error)
+           {
+              selection_failures++;
+           }
+           else if(selection_error <= minimum_selection_error)
+           {
+              minimum_selection_error = selection_error;
+              minimum_selection_error_parameters = selection_error_parameters;
+           }
        }
 
        // Elapsed time
@@ -920,6 +1314,26 @@ OptimizationAlgorithm::Results AdaptiveMomentEstimation::perform_training()
        if(stop_training) break;
    }
 
+   // Selection error of the last snapshot
+
+   if(selection_error_future.valid())
+   {
+       selection_error = selection_error_future.get();
+
+       if(!selection_error_evaluated || selection_error <= minimum_selection_error)
+       {
+           minimum_selection_error = selection_error;
+           minimum_selection_error_parameters = pending_selection_error_parameters;
+       }
+
+       results.final_selection_error = selection_error;
+
+       if(reserve_selection_error_history && !results.selection_error_history.empty())
+       {
+           results.selection_error_history[results.selection_error_history.size() - 1] = selection_error;
+       }
+   }
+
    if(return_minimum_selection_error_neural_network)
    {
        parameters = minimum_selection_error_parameters;
@@ -941,55 +1355,389 @@ OptimizationAlgorithm::Results AdaptiveMomentEstimation::perform_training()
 }
 
 
-/// @todo Gives error
+/// Updates the parameters, in place, after the gradient of a batch has been calculated.
+/// The state of the update rule is updated in the same pass over the parameters, without temporary vectors.
+/// @param gradient Gradient of the loss for the current batch.
+/// @param optimization_data State of the update rule, from the previous batches.
+/// @param parameters Parameters of the neural network.
 
-void AdaptiveMomentEstimation::perform_training_void()
+void AdaptiveMomentEstimation::update_parameters(const Vector<double>& gradient,
+                                                 OptimizationData& optimization_data,
+                                                 Vector<double>& parameters) const
 {
- //   perform_training();
-}
+   #ifdef __OPENNN_DEBUG__
 
+   if(gradient.size() != parameters.size() || optimization_data.gradient_exponential_decay.size() != parameters.size())
+   {
+      ostringstream buffer;
 
-string AdaptiveMomentEstimation::write_optimization_algorithm_type() const
-{
-   return "GRADIENT_DESCENT";
-}
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void update_parameters(const Vector<double>&, OptimizationData&, Vector<double>&) const method.\n"
+             << "Sizes of gradient (" << gradient.size() << ") and optimization data (" << optimization_data.gradient_exponential_decay.size()
+             << ") must be equal to the number of parameters (" << parameters.size() << ").\n";
 
+      throw logic_error(buffer.str());
+   }
 
-/// Writes as matrix of strings the most representative atributes.
+   #endif
 
-Matrix<string> AdaptiveMomentEstimation::to_string_matrix() const
-{
-    ostringstream buffer;
+   optimization_data.iteration++;
 
-    Vector<string> labels;
-    Vector<string> values;
+   switch(update_method)
+   {
+      case Adam:
+      case AdamW:
+      {
+         update_parameters_Adam(gradient, optimization_data, parameters);
 
-   // Minimum parameters increment norm
+         return;
+      }
 
-   labels.push_back("Minimum parameters increment norm");
+      case AMSGrad:
+      {
+         update_parameters_AMSGrad(gradient, optimization_data, parameters);
 
-   buffer.str("");
-   buffer << minimum_parameters_increment_norm;
+         return;
+      }
 
-   values.push_back(buffer.str());
+      case RMSProp:
+      {
+         update_parameters_RMSProp(gradient, optimization_data, parameters);
 
-   // Minimum loss decrease
+         return;
+      }
 
-   labels.push_back("Minimum loss decrease");
+      case Adagrad:
+      {
+         update_parameters_Adagrad(gradient, optimization_data, parameters);
 
-   buffer.str("");
-   buffer << minimum_loss_decrease;
+         return;
+      }
 
-   values.push_back(buffer.str());
+      case LAMB:
+      {
+         update_parameters_LAMB(gradient, optimization_data, parameters);
 
-   // Loss goal
+         return;
+      }
+   }
+}
 
-   labels.push_back(" Loss goal");
 
-   buffer.str("");
-   buffer << loss_goal;
+/// Adam update, with the bias correction folded into the learning rate.
+/// When the update method is AdamW, the parameters are also shrunk with the decoupled weight decay.
 
-   values.push_back(buffer.str());
+void AdaptiveMomentEstimation::update_parameters_Adam(const Vector<double>& gradient,
+                                                      OptimizationData& optimization_data,
+                                                      Vector<double>& parameters) const
+{
+   const size_t parameters_number = parameters.size();
+
+   const double iteration = static_cast<double>(optimization_data.iteration);
+
+   const double scheduled_learning_rate = initial_learning_rate*optimization_data.learning_rate_factor;
+
+   const double learning_rate = scheduled_learning_rate*sqrt(1.0 - pow(beta_2, iteration))/(1.0 - pow(beta_1, iteration));
+
+   const double decay = update_method == AdamW ? scheduled_learning_rate*weight_decay : 0.0;
+
+   optimization_data.learning_rate = learning_rate;
+
+   const double* gradient_data = gradient.data();
+
+   double* gradient_exponential_decay_data = optimization_data.gradient_exponential_decay.data();
+   double* square_gradient_exponential_decay_data = optimization_data.square_gradient_exponential_decay.data();
+   double* parameters_data = parameters.data();
+
+   #pragma omp parallel for if(parameters_number > 100000)
+
+   for(int i = 0; i < static_cast<int>(parameters_number); i++)
+   {
+      const double gradient_i = gradient_data[i];
+
+      gradient_exponential_decay_data[i] = beta_1*gradient_exponential_decay_data[i] + (1.0 - beta_1)*gradient_i;
+
+      square_gradient_exponential_decay_data[i] = beta_2*square_gradient_exponential_decay_data[i] + (1.0 - beta_2)*gradient_i*gradient_i;
+
+      parameters_data[i] -= learning_rate*gradient_exponential_decay_data[i]/(sqrt(square_gradient_exponential_decay_data[i]) + epsilon)
+                          + decay*parameters_data[i];
+   }
+}
+
+
+/// AMSGrad update, which scales the step with the maximum of the square gradient exponential decays seen so far.
+
+void AdaptiveMomentEstimation::update_parameters_AMSGrad(const Vector<double>& gradient,
+                                                         OptimizationData& optimization_data,
+                                                         Vector<double>& parameters) const
+{
+   const size_t parameters_number = parameters.size();
+
+   if(optimization_data.maximum_square_gradient_exponential_decay.size() != parameters_number)
+   {
+      optimization_data.maximum_square_gradient_exponential_decay.set(parameters_number, 0.0);
+   }
+
+   const double iteration = static_cast<double>(optimization_data.iteration);
+
+   const double learning_rate = initial_learning_rate*optimization_data.learning_rate_factor*sqrt(1.0 - pow(beta_2, iteration))/(1.0 - pow(beta_1, iteration));
+
+   optimization_data.learning_rate = learning_rate;
+
+   const double* gradient_data = gradient.data();
+
+   double* gradient_exponential_decay_data = optimization_data.gradient_exponential_decay.data();
+   double* square_gradient_exponential_decay_data = optimization_data.square_gradient_exponential_decay.data();
+   double* maximum_square_gradient_exponential_decay_data = optimization_data.maximum_square_gradient_exponential_decay.data();
+   double* parameters_data = parameters.data();
+
+   #pragma omp parallel for if(parameters_number > 100000)
+
+   for(int i = 0; i < static_cast<int>(parameters_number); i++)
+   {
+      const double gradient_i = gradient_data[i];
+
+      gradient_exponential_decay_data[i] = beta_1*gradient_exponential_decay_data[i] + (1.0 - beta_1)*gradient_i;
+
+      square_gradient_exponential_decay_data[i] = beta_2*square_gradient_exponential_decay_data[i] + (1.0 - beta_2)*gradient_i*gradient_i;
+
+      maximum_square_gradient_exponential_decay_data[i] = max(maximum_square_gradient_exponential_decay_data[i], square_gradient_exponential_decay_data[i]);
+
+      parameters_data[i] -= learning_rate*gradient_exponential_decay_data[i]/(sqrt(maximum_square_gradient_exponential_decay_data[i]) + epsilon);
+   }
+}
+
+
+/// RMSProp update, which divides the gradient by the root of its square exponential decay.
+/// Beta 2 is used as the decay rate of the square gradient.
+
+void AdaptiveMomentEstimation::update_parameters_RMSProp(const Vector<double>& gradient,
+                                                         OptimizationData& optimization_data,
+                                                         Vector<double>& parameters) const
+{
+   const size_t parameters_number = parameters.size();
+
+   const double learning_rate = initial_learning_rate*optimization_data.learning_rate_factor;
+
+   optimization_data.learning_rate = learning_rate;
+
+   const double* gradient_data = gradient.data();
+
+   double* square_gradient_exponential_decay_data = optimization_data.square_gradient_exponential_decay.data();
+   double* parameters_data = parameters.data();
+
+   #pragma omp parallel for if(parameters_number > 100000)
+
+   for(int i = 0; i < static_cast<int>(parameters_number); i++)
+   {
+      const double gradient_i = gradient_data[i];
+
+      square_gradient_exponential_decay_data[i] = beta_2*square_gradient_exponential_decay_data[i] + (1.0 - beta_2)*gradient_i*gradient_i;
+
+      parameters_data[i] -= learning_rate*gradient_i/(sqrt(square_gradient_exponential_decay_data[i]) + epsilon);
+   }
+}
+
+
+/// Adagrad update, which divides the gradient by the root of the accumulated square gradients.
+
+void AdaptiveMomentEstimation::update_parameters_Adagrad(const Vector<double>& gradient,
+                                                         OptimizationData& optimization_data,
+                                                         Vector<double>& parameters) const
+{
+   const size_t parameters_number = parameters.size();
+
+   const double learning_rate = initial_learning_rate*optimization_data.learning_rate_factor;
+
+   optimization_data.learning_rate = learning_rate;
+
+   const double* gradient_data = gradient.data();
+
+   double* square_gradient_accumulation_data = optimization_data.square_gradient_exponential_decay.data();
+   double* parameters_data = parameters.data();
+
+   #pragma omp parallel for if(parameters_number > 100000)
+
+   for(int i = 0; i < static_cast<int>(parameters_number); i++)
+   {
+      const double gradient_i = gradient_data[i];
+
+      square_gradient_accumulation_data[i] += gradient_i*gradient_i;
+
+      parameters_data[i] -= learning_rate*gradient_i/(sqrt(square_gradient_accumulation_data[i]) + epsilon);
+   }
+}
+
+
+/// LAMB update.
+/// The Adam direction plus the decoupled weight decay is rescaled in each layer by the ratio between the norms of its parameters and of that direction.
+
+void AdaptiveMomentEstimation::update_parameters_LAMB(const Vector<double>& gradient,
+                                                      OptimizationData& optimization_data,
+                                                      Vector<double>& parameters) const
+{
+   const size_t parameters_number = parameters.size();
+
+   if(optimization_data.parameters_increment.size() != parameters_number)
+   {
+      optimization_data.parameters_increment.set(parameters_number);
+   }
+
+   const double iteration = static_cast<double>(optimization_data.iteration);
+
+   const double gradient_correction = 1.0 - pow(beta_1, iteration);
+   const double square_gradient_correction = 1.0 - pow(beta_2, iteration);
+
+   const double learning_rate = initial_learning_rate*optimization_data.learning_rate_factor;
+
+   optimization_data.learning_rate = learning_rate;
+
+   const double* gradient_data = gradient.data();
+
+   double* gradient_exponential_decay_data = optimization_data.gradient_exponential_decay.data();
+   double* square_gradient_exponential_decay_data = optimization_data.square_gradient_exponential_decay.data();
+   double* parameters_increment_data = optimization_data.parameters_increment.data();
+   double* parameters_data = parameters.data();
+
+   #pragma omp parallel for if(parameters_number > 100000)
+
+   for(int i = 0; i < static_cast<int>(parameters_number); i++)
+   {
+      const double gradient_i = gradient_data[i];
+
+      gradient_exponential_decay_data[i] = beta_1*gradient_exponential_decay_data[i] + (1.0 - beta_1)*gradient_i;
+
+      square_gradient_exponential_decay_data[i] = beta_2*square_gradient_exponential_decay_data[i] + (1.0 - beta_2)*gradient_i*gradient_i;
+
+      parameters_increment_data[i] = (gradient_exponential_decay_data[i]/gradient_correction)
+                                   /(sqrt(square_gradient_exponential_decay_data[i]/square_gradient_correction) + epsilon)
+                                   + weight_decay*parameters_data[i];
+   }
+
+   // Layer-wise trust ratios
+
+   Vector<size_t> layers_parameters_numbers = optimization_data.layers_parameters_numbers;
+
+   if(layers_parameters_numbers.empty() || layers_parameters_numbers.calculate_sum() != parameters_number)
+   {
+      layers_parameters_numbers.set(1, parameters_number);
+   }
+
+   size_t index = 0;
+
+   for(size_t i = 0; i < layers_parameters_numbers.size(); i++)
+   {
+      const int layer_begin = static_cast<int>(index);
+      const int layer_end = static_cast<int>(index + layers_parameters_numbers[i]);
+
+      double parameters_squared_norm = 0.0;
+      double increment_squared_norm = 0.0;
+
+      #pragma omp parallel for reduction(+ : parameters_squared_norm, increment_squared_norm) if(layers_parameters_numbers[i] > 100000)
+
+      for(int j = layer_begin; j < layer_end; j++)
+      {
+         parameters_squared_norm += parameters_data[j]*parameters_data[j];
+         increment_squared_norm += parameters_increment_data[j]*parameters_increment_data[j];
+      }
+
+      const double trust_ratio = parameters_squared_norm > 0.0 && increment_squared_norm > 0.0
+                               ? sqrt(parameters_squared_norm/increment_squared_norm)
+                               : 1.0;
+
+      const double layer_learning_rate = learning_rate*trust_ratio;
+
+      #pragma omp parallel for if(layers_parameters_numbers[i] > 100000)
+
+      for(int j = layer_begin; j < layer_end; j++)
+      {
+         parameters_data[j] -= layer_learning_rate*parameters_increment_data[j];
+      }
+
+      index += layers_parameters_numbers[i];
+   }
+}
+
+
+/// @todo Gives error
+
+void AdaptiveMomentEstimation::perform_training_void()
+{
+ //   perform_training();
+}
+
+
+string AdaptiveMomentEstimation::write_optimization_algorithm_type() const
+{
+   return "GRADIENT_DESCENT";
+}
+
+
+/// Writes as matrix of strings the most representative atributes.
+
+Matrix<string> AdaptiveMomentEstimation::to_string_matrix() const
+{
+    ostringstream buffer;
+
+    Vector<string> labels;
+    Vector<string> values;
+
+   // Learning rate schedule
+
+   labels.push_back("Learning rate schedule");
+
+   values.push_back(learning_rate_schedule.write_schedule_method());
+
+   // Update method
+
+   labels.push_back("Update method");
+
+   values.push_back(write_update_method());
+
+   // Initial learning rate
+
+   labels.push_back("Initial learning rate");
+
+   buffer.str("");
+   buffer << initial_learning_rate;
+
+   values.push_back(buffer.str());
+
+   // Weight decay
+
+   labels.push_back("Weight decay");
+
+   buffer.str("");
+   buffer << weight_decay;
+
+   values.push_back(buffer.str());
+
+   // Minimum parameters increment norm
+
+   labels.push_back("Minimum parameters increment norm");
+
+   buffer.str("");
+   buffer << minimum_parameters_increment_norm;
+
+   values.push_back(buffer.str());
+
+   // Minimum loss decrease
+
+   labels.push_back("Minimum loss decrease");
+
+   buffer.str("");
+   buffer << minimum_loss_decrease;
+
+   values.push_back(buffer.str());
+
+   // Loss goal
+
+   labels.push_back(" Loss goal");
+
+   buffer.str("");
+   buffer << loss_goal;
+
+   values.push_back(buffer.str());
 
    // Gradient norm goal
 
@@ -1091,6 +1839,49 @@ tinyxml2::XMLDocument* AdaptiveMomentEstimation::to_XML() const
    tinyxml2::XMLElement* element = nullptr;
    tinyxml2::XMLText* text = nullptr;
 
+   // Learning rate schedule
+   {
+      const tinyxml2::XMLDocument* learning_rate_schedule_document = learning_rate_schedule.to_XML();
+
+      const tinyxml2::XMLElement* learning_rate_schedule_element = learning_rate_schedule_document->FirstChildElement("LearningRateSchedule");
+
+      tinyxml2::XMLNode* node = learning_rate_schedule_element->DeepClone(document);
+
+      root_element->InsertEndChild(node);
+
+      delete learning_rate_schedule_document;
+   }
+
+   // Update method
+
+   element = document->NewElement("UpdateMethod");
+   root_element->LinkEndChild(element);
+
+   text = document->NewText(write_update_method().c_str());
+   element->LinkEndChild(text);
+
+   // Initial learning rate
+
+   element = document->NewElement("InitialLearningRate");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << initial_learning_rate;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Weight decay
+
+   element = document->NewElement("WeightDecay");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << weight_decay;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
    // Return minimum selection error neural network
 
    element = document->NewElement("ReturnMinimumSelectionErrorNN");
@@ -1267,6 +2058,50 @@ tinyxml2::XMLDocument* AdaptiveMomentEstimation::to_XML() const
    text = document->NewText(buffer.str().c_str());
    element->LinkEndChild(text);
 
+   // Asynchronous selection error
+
+   element = document->NewElement("AsynchronousSelectionError");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << asynchronous_selection_error;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Selection error period
+
+   element = document->NewElement("SelectionErrorPeriod");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << selection_error_period;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Selection instances fraction
+
+   element = document->NewElement("SelectionInstancesFraction");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << selection_instances_fraction;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Gradient accumulation steps
+
+   element = document->NewElement("GradientAccumulationSteps");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << gradient_accumulation_steps;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
    // Display period
 
    element = document->NewElement("DisplayPeriod");
@@ -1321,6 +2156,40 @@ void AdaptiveMomentEstimation::write_XML(tinyxml2::XMLPrinter& file_stream) cons
 
     //file_stream.OpenElement("AdaptiveMomentEstimation");
 
+    // Learning rate schedule
+
+    learning_rate_schedule.write_XML(file_stream);
+
+    // Update method
+
+    file_stream.OpenElement("UpdateMethod");
+
+    file_stream.PushText(write_update_method().c_str());
+
+    file_stream.CloseElement();
+
+    // Initial learning rate
+
+    file_stream.OpenElement("InitialLearningRate");
+
+    buffer.str("");
+    buffer << initial_learning_rate;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Weight decay
+
+    file_stream.OpenElement("WeightDecay");
+
+    buffer.str("");
+    buffer << weight_decay;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Return minimum selection error neural network
 
 
@@ -1443,6 +2312,50 @@ void AdaptiveMomentEstimation::write_XML(tinyxml2::XMLPrinter& file_stream) cons
     file_stream.PushText(buffer.str().c_str());
 
     file_stream.CloseElement();
+
+    // Asynchronous selection error
+
+    file_stream.OpenElement("AsynchronousSelectionError");
+
+    buffer.str("");
+    buffer << asynchronous_selection_error;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Selection error period
+
+    file_stream.OpenElement("SelectionErrorPeriod");
+
+    buffer.str("");
+    buffer << selection_error_period;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Selection instances fraction
+
+    file_stream.OpenElement("SelectionInstancesFraction");
+
+    buffer.str("");
+    buffer << selection_instances_fraction;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Gradient accumulation steps
+
+    file_stream.OpenElement("GradientAccumulationSteps");
+
+    buffer.str("");
+    buffer << gradient_accumulation_steps;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
 }
 
 
@@ -1461,6 +2374,79 @@ void AdaptiveMomentEstimation::from_XML(const tinyxml2::XMLDocument& document)
         throw logic_error(buffer.str());
     }
 
+    // Learning rate schedule
+    {
+       const tinyxml2::XMLElement* learning_rate_schedule_element = root_element->FirstChildElement("LearningRateSchedule");
+
+       if(learning_rate_schedule_element)
+       {
+           tinyxml2::XMLDocument learning_rate_schedule_document;
+
+           tinyxml2::XMLNode* element_clone = learning_rate_schedule_element->DeepClone(&learning_rate_schedule_document);
+
+           learning_rate_schedule_document.InsertFirstChild(element_clone);
+
+           learning_rate_schedule.from_XML(learning_rate_schedule_document);
+       }
+    }
+
+   // Update method
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("UpdateMethod");
+
+       if(element)
+       {
+          const string new_update_method = element->GetText();
+
+          try
+          {
+             set_update_method(new_update_method);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Initial learning rate
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("InitialLearningRate");
+
+       if(element)
+       {
+          const double new_initial_learning_rate = atof(element->GetText());
+
+          try
+          {
+             set_initial_learning_rate(new_initial_learning_rate);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Weight decay
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("WeightDecay");
+
+       if(element)
+       {
+          const double new_weight_decay = atof(element->GetText());
+
+          try
+          {
+             set_weight_decay(new_weight_decay);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
    // Warning parameters norm
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarningParametersNorm");
@@ -1744,6 +2730,82 @@ void AdaptiveMomentEstimation::from_XML(const tinyxml2::XMLDocument& document)
         }
     }
 
+   // Asynchronous selection error
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("AsynchronousSelectionError");
+
+       if(element)
+       {
+          const string new_asynchronous_selection_error = element->GetText();
+
+          try
+          {
+             set_asynchronous_selection_error(new_asynchronous_selection_error != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Selection error period
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("SelectionErrorPeriod");
+
+       if(element)
+       {
+          const size_t new_selection_error_period = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_selection_error_period(new_selection_error_period);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Selection instances fraction
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("SelectionInstancesFraction");
+
+       if(element)
+       {
+          const double new_selection_instances_fraction = atof(element->GetText());
+
+          try
+          {
+             set_selection_instances_fraction(new_selection_instances_fraction);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Gradient accumulation steps
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("GradientAccumulationSteps");
+
+       if(element)
+       {
+          const size_t new_gradient_accumulation_steps = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_gradient_accumulation_steps(new_gradient_accumulation_steps);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
    // Display period
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("DisplayPeriod");
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <algorithm>
 #include <functional>
+#include <future>
 #include <limits>
 #include <cmath>
 #include <ctime>
@@ -31,18 +32,28 @@
 
 #include "loss_index.h"
 #include "optimization_algorithm.h"
+#include "learning_rate_schedule.h"
 
 namespace OpenNN
 {
 
 /// This concrete class represents the adaptive moment estimation(Adam) training algorithm, based on adaptative estimates of lower-order moments.
 
+///
+/// The same batched training loop is shared by several first order update rules: Adam, AdamW, AMSGrad, RMSProp, Adagrad and LAMB.
+/// Each of them is implemented as a single pass over the parameters.
 ///
 /// For more information visit:
 ///
 /// \cite 1 C. Barranquero "High performance optimization algorithms for neural networks." \ref https://www.opennn.net/files/high_performance_optimization_algorithms_for_neural_networks.pdf .
 ///
 /// \cite 2 D. P. Kingma and J. L. Ba, "ADAM: A Method for Stochastic Optimization." arXiv preprint arXiv:1412.6980v8 (2014).
+///
+/// \cite 3 I. Loshchilov and F. Hutter, "Decoupled Weight Decay Regularization." arXiv preprint arXiv:1711.05101 (2017).
+///
+/// \cite 4 S. J. Reddi, S. Kale and S. Kumar, "On the Convergence of Adam and Beyond." arXiv preprint arXiv:1904.09237 (2019).
+///
+/// \cite 5 Y. You et al., "Large Batch Optimization for Deep Learning: Training BERT in 76 minutes." arXiv preprint arXiv:1904.00962 (2019).
 
 class AdaptiveMomentEstimation : public OptimizationAlgorithm
 {
@@ -67,18 +78,71 @@ public:
 
    // Enumerations
 
-    ///@todo, to remove
-   /// Enumeration of Adam's variations.
+   /// Enumeration of the available rules for updating the parameters.
 
-   
-   /// Get methods in training operators
+   enum UpdateMethod{Adam, AdamW, AMSGrad, RMSProp, Adagrad, LAMB};
+
+   // Structures
+
+   /// This structure contains the state of the update rule between two consecutive batches.
+
+   struct OptimizationData
+   {
+       /// Default constructor.
+
+       explicit OptimizationData() {}
+
+       explicit OptimizationData(const size_t&);
+
+       void set_parameters_number(const size_t&);
+
+       /// Number of updates performed.
+
+       size_t iteration = 0;
+
+       /// Factor of the learning rate schedule for the next update.
+
+       double learning_rate_factor = 1.0;
+
+       /// Learning rate of the last update, after the bias correction.
+
+       double learning_rate = 0.0;
+
+       /// Exponential decay of the gradient.
+
+       Vector<double> gradient_exponential_decay;
+
+       /// Exponential decay, or accumulation, of the square gradient.
+
+       Vector<double> square_gradient_exponential_decay;
+
+       /// Maximum of the square gradient exponential decay, used by AMSGrad.
+
+       Vector<double> maximum_square_gradient_exponential_decay;
+
+       /// Update direction of the parameters, used by LAMB to compute the layer-wise trust ratios.
+
+       Vector<double> parameters_increment;
+
+       /// Number of parameters of each trainable layer, used by LAMB.
+       /// If empty, all the parameters are considered a single layer.
+
+       Vector<size_t> layers_parameters_numbers;
+   };
 
    // Training operators
 
+   const LearningRateSchedule& get_learning_rate_schedule() const;
+   LearningRateSchedule* get_learning_rate_schedule_pointer();
+
+   const UpdateMethod& get_update_method() const;
+   string write_update_method() const;
+
    const double& get_initial_learning_rate() const;
    const double& get_beta_1() const;
    const double& get_beta_2() const;
    const double& get_epsilon() const;
+   const double& get_weight_decay() const;
 
 
    // Training parameters
@@ -104,6 +168,16 @@ public:
    const bool& get_reserve_training_error_history() const;
    const bool& get_reserve_selection_error_history() const;
 
+   // Selection error
+
+   const bool& get_asynchronous_selection_error() const;
+   const size_t& get_selection_error_period() const;
+   const double& get_selection_instances_fraction() const;
+
+   // Gradient accumulation
+
+   const size_t& get_gradient_accumulation_steps() const;
+
    // Set methods
 
    void set_loss_index_pointer(LossIndex*);
@@ -114,10 +188,14 @@ public:
 
    // Training operators
 
+   void set_update_method(const UpdateMethod&);
+   void set_update_method(const string&);
+
    void set_initial_learning_rate(const double&);
    void set_beta_1(const double&);
    void set_beta_2(const double&);
    void set_epsilon(const double&);
+   void set_weight_decay(const double&);
 
    // Training parameters
 
@@ -143,12 +221,24 @@ public:
    void set_reserve_training_error_history(const bool&);
    void set_reserve_selection_error_history(const bool&);
 
+   // Selection error
+
+   void set_asynchronous_selection_error(const bool&);
+   void set_selection_error_period(const size_t&);
+   void set_selection_instances_fraction(const double&);
+
+   // Gradient accumulation
+
+   void set_gradient_accumulation_steps(const size_t&);
+
    // Utilities
 
    void set_display_period(const size_t&);
 
    // Training methods
 
+   void update_parameters(const Vector<double>&, OptimizationData&, Vector<double>&) const;
+
    Results perform_training();
 
    /// Perform Neural Network training.
@@ -171,8 +261,24 @@ public:
 
 private:
 
+   // Update rules
+
+   void update_parameters_Adam(const Vector<double>&, OptimizationData&, Vector<double>&) const;
+   void update_parameters_AMSGrad(const Vector<double>&, OptimizationData&, Vector<double>&) const;
+   void update_parameters_RMSProp(const Vector<double>&, OptimizationData&, Vector<double>&) const;
+   void update_parameters_Adagrad(const Vector<double>&, OptimizationData&, Vector<double>&) const;
+   void update_parameters_LAMB(const Vector<double>&, OptimizationData&, Vector<double>&) const;
+
    // TRAINING OPERATORS
 
+   /// Schedule of the learning rate along the training.
+
+   LearningRateSchedule learning_rate_schedule;
+
+   /// Rule for updating the parameters after each batch.
+
+   UpdateMethod update_method;
+
    /// Initial learning rate
 
    double initial_learning_rate;
@@ -193,6 +299,10 @@ private:
 
    double epsilon;
 
+   /// Decoupled weight decay rate, used by AdamW and LAMB.
+
+   double weight_decay;
+
    // TRAINING PARAMETERS
 
    /// Value for the parameters norm at which a warning message is written to the screen. 
@@ -271,6 +381,26 @@ private:
    /// True if the selection error history vector is to be reserved, false otherwise.
 
    bool reserve_selection_error_history;
+
+   // SELECTION ERROR
+
+   /// True if the selection error is calculated on a background thread while the next epochs are trained, false otherwise.
+   /// The selection error of an epoch is then known one evaluation later.
+
+   bool asynchronous_selection_error;
+
+   /// Number of epochs between two calculations of the selection error.
+
+   size_t selection_error_period;
+
+   /// Fraction of the selection instances, randomly sampled each time, on which the selection error is calculated.
+
+   double selection_instances_fraction;
+
+   /// Number of batches whose gradients are accumulated before each update of the parameters.
+   /// The effective batch size is the number of batch instances of the data set times this value.
+
+   size_t gradient_accumulation_steps;
 };
 
 }
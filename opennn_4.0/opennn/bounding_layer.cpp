@@ -51,6 +51,8 @@ BoundingLayer::BoundingLayer(const tinyxml2::XMLDocument& bounding_layer_documen
 BoundingLayer::BoundingLayer(const BoundingLayer& other_bounding_layer) : Layer()
 {
    set(other_bounding_layer);
+
+   layer_type = Layer::Bounding;
 }
 
 
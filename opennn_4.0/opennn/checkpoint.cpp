@@ -0,0 +1,549 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   C H E C K P O I N T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "checkpoint.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace OpenNN
+{
+
+/// Default constructor.
+/// It creates an empty checkpoint.
+
+Checkpoint::Checkpoint()
+{
+}
+
+
+/// Destructor.
+
+Checkpoint::~Checkpoint()
+{
+}
+
+
+/// Returns true if the checkpoint has a value with the given name, and false otherwise.
+/// @param name Name of the value.
+
+bool Checkpoint::contains(const string& name) const
+{
+    return values.count(name) != 0;
+}
+
+
+/// Returns the vector with the given name.
+/// @param name Name of the value.
+
+const Vector<double>& Checkpoint::get_vector(const string& name) const
+{
+    const auto iterator = values.find(name);
+
+    if(iterator == values.end())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Checkpoint class.\n"
+               << "const Vector<double>& get_vector(const string&) const method.\n"
+               << "Checkpoint does not contain value: " << name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    return iterator->second;
+}
+
+
+/// Returns the number with the given name.
+/// @param name Name of the value.
+
+double Checkpoint::get_double(const string& name) const
+{
+    return get_vector(name)[0];
+}
+
+
+/// Returns the natural number with the given name.
+/// @param name Name of the value.
+
+size_t Checkpoint::get_size_t(const string& name) const
+{
+    return static_cast<size_t>(get_vector(name)[0]);
+}
+
+
+/// Returns the vector of indices with the given name.
+/// @param name Name of the value.
+
+Vector<size_t> Checkpoint::get_indices(const string& name) const
+{
+    const Vector<double>& vector = get_vector(name);
+
+    const size_t size = vector.size();
+
+    Vector<size_t> indices(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        indices[i] = static_cast<size_t>(vector[i]);
+    }
+
+    return indices;
+}
+
+
+/// Returns the vector of booleans with the given name.
+/// @param name Name of the value.
+
+Vector<bool> Checkpoint::get_bool_vector(const string& name) const
+{
+    const Vector<double>& vector = get_vector(name);
+
+    const size_t size = vector.size();
+
+    Vector<bool> bool_vector(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        bool_vector[i] = vector[i] != 0.0;
+    }
+
+    return bool_vector;
+}
+
+
+/// Returns the vector of vectors with the given name.
+/// @param name Name of the value.
+
+Vector<Vector<double>> Checkpoint::get_vectors(const string& name) const
+{
+    const Vector<double>& vector = get_vector(name);
+
+    const size_t vectors_number = static_cast<size_t>(vector[0]);
+
+    Vector<Vector<double>> vectors(vectors_number);
+
+    size_t index = 1 + vectors_number;
+
+    for(size_t i = 0; i < vectors_number; i++)
+    {
+        const size_t size = static_cast<size_t>(vector[1+i]);
+
+        vectors[i].set(size);
+
+        for(size_t j = 0; j < size; j++)
+        {
+            vectors[i][j] = vector[index+j];
+        }
+
+        index += size;
+    }
+
+    return vectors;
+}
+
+
+/// Returns the vector of vectors of booleans with the given name.
+/// @param name Name of the value.
+
+Vector<Vector<bool>> Checkpoint::get_bool_vectors(const string& name) const
+{
+    const Vector<Vector<double>> vectors = get_vectors(name);
+
+    const size_t vectors_number = vectors.size();
+
+    Vector<Vector<bool>> bool_vectors(vectors_number);
+
+    for(size_t i = 0; i < vectors_number; i++)
+    {
+        const size_t size = vectors[i].size();
+
+        bool_vectors[i].set(size);
+
+        for(size_t j = 0; j < size; j++)
+        {
+            bool_vectors[i][j] = vectors[i][j] != 0.0;
+        }
+    }
+
+    return bool_vectors;
+}
+
+
+/// Returns the random generator with the given name, in the same state as when it was set.
+/// @param name Name of the value.
+
+RandomGenerator Checkpoint::get_generator(const string& name) const
+{
+    const Vector<double>& vector = get_vector(name);
+
+    Vector<uint64_t> state(3);
+
+    for(size_t i = 0; i < 3; i++)
+    {
+        state[i] = (static_cast<uint64_t>(vector[2*i]) << 32) | static_cast<uint64_t>(vector[2*i+1]);
+    }
+
+    RandomGenerator generator(state[0], state[1]);
+
+    generator.set_counter(state[2]);
+
+    return generator;
+}
+
+
+/// Returns the evaluation cache of the checkpoint.
+
+const EvaluationCache& Checkpoint::get_evaluation_cache() const
+{
+    return evaluation_cache;
+}
+
+
+/// Sets a vector with the given name.
+/// @param name Name of the value.
+/// @param new_vector Vector of numbers.
+
+void Checkpoint::set_vector(const string& name, const Vector<double>& new_vector)
+{
+    values[name] = new_vector;
+}
+
+
+/// Sets a number with the given name.
+/// @param name Name of the value.
+/// @param new_value Number.
+
+void Checkpoint::set_double(const string& name, const double& new_value)
+{
+    values[name] = Vector<double>(1, new_value);
+}
+
+
+/// Sets a natural number with the given name.
+/// @param name Name of the value.
+/// @param new_value Natural number.
+
+void Checkpoint::set_size_t(const string& name, const size_t& new_value)
+{
+    values[name] = Vector<double>(1, static_cast<double>(new_value));
+}
+
+
+/// Sets a vector of indices with the given name.
+/// @param name Name of the value.
+/// @param new_indices Vector of indices.
+
+void Checkpoint::set_indices(const string& name, const Vector<size_t>& new_indices)
+{
+    const size_t size = new_indices.size();
+
+    Vector<double> vector(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        vector[i] = static_cast<double>(new_indices[i]);
+    }
+
+    values[name] = vector;
+}
+
+
+/// Sets a vector of booleans with the given name.
+/// @param name Name of the value.
+/// @param new_bool_vector Vector of booleans.
+
+void Checkpoint::set_bool_vector(const string& name, const Vector<bool>& new_bool_vector)
+{
+    const size_t size = new_bool_vector.size();
+
+    Vector<double> vector(size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        vector[i] = new_bool_vector[i] ? 1.0 : 0.0;
+    }
+
+    values[name] = vector;
+}
+
+
+/// Sets a vector of vectors with the given name.
+/// It is stored as the number of vectors, followed by their sizes and by their elements.
+/// @param name Name of the value.
+/// @param new_vectors Vector of vectors of numbers.
+
+void Checkpoint::set_vectors(const string& name, const Vector<Vector<double>>& new_vectors)
+{
+    const size_t vectors_number = new_vectors.size();
+
+    Vector<double> vector(1 + vectors_number);
+
+    vector[0] = static_cast<double>(vectors_number);
+
+    for(size_t i = 0; i < vectors_number; i++)
+    {
+        vector[1+i] = static_cast<double>(new_vectors[i].size());
+    }
+
+    for(size_t i = 0; i < vectors_number; i++)
+    {
+        vector.insert(vector.end(), new_vectors[i].begin(), new_vectors[i].end());
+    }
+
+    values[name] = vector;
+}
+
+
+/// Sets a vector of vectors of booleans with the given name.
+/// @param name Name of the value.
+/// @param new_bool_vectors Vector of vectors of booleans.
+
+void Checkpoint::set_bool_vectors(const string& name, const Vector<Vector<bool>>& new_bool_vectors)
+{
+    const size_t vectors_number = new_bool_vectors.size();
+
+    Vector<Vector<double>> vectors(vectors_number);
+
+    for(size_t i = 0; i < vectors_number; i++)
+    {
+        const size_t size = new_bool_vectors[i].size();
+
+        vectors[i].set(size);
+
+        for(size_t j = 0; j < size; j++)
+        {
+            vectors[i][j] = new_bool_vectors[i][j] ? 1.0 : 0.0;
+        }
+    }
+
+    set_vectors(name, vectors);
+}
+
+
+/// Sets a random generator with the given name.
+/// Its seed, stream and counter are stored as halves of 32 bits, which are represented exactly.
+/// @param name Name of the value.
+/// @param new_generator Random generator.
+
+void Checkpoint::set_generator(const string& name, const RandomGenerator& new_generator)
+{
+    const uint64_t state[3] = {new_generator.get_seed(), new_generator.get_stream(), new_generator.get_counter()};
+
+    Vector<double> vector(6);
+
+    for(size_t i = 0; i < 3; i++)
+    {
+        vector[2*i] = static_cast<double>(state[i] >> 32);
+        vector[2*i+1] = static_cast<double>(state[i] & 0xFFFFFFFF);
+    }
+
+    values[name] = vector;
+}
+
+
+/// Sets the evaluation cache of the checkpoint.
+/// @param new_evaluation_cache Results of the models trained by the algorithm.
+
+void Checkpoint::set_evaluation_cache(const EvaluationCache& new_evaluation_cache)
+{
+    evaluation_cache = new_evaluation_cache;
+}
+
+
+/// Removes all the values and the evaluation cache of the checkpoint.
+
+void Checkpoint::clear()
+{
+    values.clear();
+
+    evaluation_cache.clear();
+}
+
+
+/// Saves the checkpoint to a binary file.
+/// It is written to a temporary file, which then replaces the previous checkpoint.
+/// @param file_name Name of the binary file.
+
+void Checkpoint::save(const string& file_name) const
+{
+    const string temporary_file_name = file_name + ".tmp";
+
+    ofstream file(temporary_file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Checkpoint class.\n"
+               << "void save(const string&) const method.\n"
+               << "Cannot open checkpoint file: " << temporary_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    const size_t values_number = values.size();
+
+    file.write(reinterpret_cast<const char*>(&values_number), sizeof(size_t));
+
+    for(const auto& item : values)
+    {
+        const string& name = item.first;
+        const Vector<double>& vector = item.second;
+
+        const size_t name_size = name.size();
+        const size_t size = vector.size();
+
+        file.write(reinterpret_cast<const char*>(&name_size), sizeof(size_t));
+        file.write(name.data(), static_cast<streamsize>(name_size));
+
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size_t));
+        file.write(reinterpret_cast<const char*>(vector.data()), static_cast<streamsize>(size*sizeof(double)));
+    }
+
+    evaluation_cache.write(file);
+
+    file.close();
+
+    if(!file)
+    {
+        remove(temporary_file_name.c_str());
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Checkpoint class.\n"
+               << "void save(const string&) const method.\n"
+               << "Cannot write checkpoint file: " << temporary_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    // The temporary file replaces the checkpoint in a single step, so that a valid checkpoint always exists
+
+#ifdef _WIN32
+    const bool renamed = MoveFileExA(temporary_file_name.c_str(), file_name.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool renamed = rename(temporary_file_name.c_str(), file_name.c_str()) == 0;
+#endif
+
+    if(!renamed)
+    {
+        remove(temporary_file_name.c_str());
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Checkpoint class.\n"
+               << "void save(const string&) const method.\n"
+               << "Cannot rename checkpoint file: " << temporary_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Loads the checkpoint from a binary file written by the save method.
+/// The previous values and evaluation cache of the checkpoint are removed.
+/// @param file_name Name of the binary file.
+
+void Checkpoint::load(const string& file_name)
+{
+    ifstream file(file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Checkpoint class.\n"
+               << "void load(const string&) method.\n"
+               << "Cannot open checkpoint file: " << file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    clear();
+
+    size_t values_number = 0;
+
+    file.read(reinterpret_cast<char*>(&values_number), sizeof(size_t));
+
+    for(size_t i = 0; i < values_number && file; i++)
+    {
+        size_t name_size = 0;
+
+        file.read(reinterpret_cast<char*>(&name_size), sizeof(size_t));
+
+        if(!file) break;
+
+        string name(name_size, '\0');
+
+        file.read(&name[0], static_cast<streamsize>(name_size));
+
+        size_t size = 0;
+
+        file.read(reinterpret_cast<char*>(&size), sizeof(size_t));
+
+        if(!file) break;
+
+        Vector<double> vector(size);
+
+        file.read(reinterpret_cast<char*>(vector.data()), static_cast<streamsize>(size*sizeof(double)));
+
+        values[name] = vector;
+    }
+
+    if(!file)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Checkpoint class.\n"
+               << "void load(const string&) method.\n"
+               << "Checkpoint file is truncated: " << file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    evaluation_cache.read(file);
+
+    file.close();
+}
+
+
+/// Returns true if a checkpoint file with the given name exists, and false otherwise.
+/// @param file_name Name of the binary file.
+
+bool Checkpoint::exists(const string& file_name)
+{
+    if(file_name.empty()) return false;
+
+    ifstream file(file_name.c_str(), ios::binary);
+
+    return file.is_open();
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
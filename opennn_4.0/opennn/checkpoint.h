@@ -0,0 +1,127 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   C H E C K P O I N T   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <map>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "random.h"
+#include "evaluation_cache.h"
+
+namespace OpenNN
+{
+
+/// This class stores the state of a model selection algorithm, so that a long search can be resumed after it is interrupted.
+
+///
+/// The state is a set of named vectors of numbers, such as the population or the optimal parameters,
+/// together with the evaluation cache of the trained models.
+/// It is saved to a binary file, which is first written to a temporary file and then renamed,
+/// so that an interruption while saving never leaves a corrupted checkpoint.
+
+class Checkpoint
+{
+
+public:
+
+   // Constructors
+
+   explicit Checkpoint();
+
+   // Destructor
+
+   virtual ~Checkpoint();
+
+   // Get methods
+
+   bool contains(const string&) const;
+
+   const Vector<double>& get_vector(const string&) const;
+
+   double get_double(const string&) const;
+   size_t get_size_t(const string&) const;
+
+   Vector<size_t> get_indices(const string&) const;
+   Vector<bool> get_bool_vector(const string&) const;
+
+   Vector<Vector<double>> get_vectors(const string&) const;
+   Vector<Vector<bool>> get_bool_vectors(const string&) const;
+
+   RandomGenerator get_generator(const string&) const;
+
+   const EvaluationCache& get_evaluation_cache() const;
+
+   // Set methods
+
+   void set_vector(const string&, const Vector<double>&);
+
+   void set_double(const string&, const double&);
+   void set_size_t(const string&, const size_t&);
+
+   void set_indices(const string&, const Vector<size_t>&);
+   void set_bool_vector(const string&, const Vector<bool>&);
+
+   void set_vectors(const string&, const Vector<Vector<double>>&);
+   void set_bool_vectors(const string&, const Vector<Vector<bool>>&);
+
+   void set_generator(const string&, const RandomGenerator&);
+
+   void set_evaluation_cache(const EvaluationCache&);
+
+   void clear();
+
+   // Serialization methods
+
+   void save(const string&) const;
+   void load(const string&);
+
+   static bool exists(const string&);
+
+private:
+
+   /// Values of the state of the algorithm, indexed by their names.
+
+   map<string, Vector<double>> values;
+
+   /// Results of the models trained by the algorithm.
+
+   EvaluationCache evaluation_cache;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
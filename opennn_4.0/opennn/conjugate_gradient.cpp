@@ -1414,7 +1414,7 @@ OptimizationAlgorithm::Results ConjugateGradient::perform_training()
          initial_learning_rate = old_learning_rate;
       }
 
-      directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, training_direction, initial_learning_rate);
+      directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, dot(gradient, training_direction), training_direction, initial_learning_rate);
 
       learning_rate = directional_point.first;
 
@@ -1425,7 +1425,7 @@ OptimizationAlgorithm::Results ConjugateGradient::perform_training()
 
          training_direction = calculate_gradient_descent_training_direction(gradient);         
 
-         directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, training_direction, first_learning_rate);
+         directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, dot(gradient, training_direction), training_direction, first_learning_rate);
 
          learning_rate = directional_point.first;
       }
@@ -3741,6 +3741,170 @@ double one_way_anova_correlation(const Matrix<double>& matrix,const size_t& inde
 }
 
 
+/// Assigns each row of a column of data to a discrete label, for the calculation of the mutual information.
+/// Categorical columns, with more than one variable, are labelled with the index of their active category.
+/// Binary columns are labelled with their value, and numeric columns with their bin in a histogram of equal width bins.
+/// @param matrix Data of the column, with one variable for each category of categorical columns.
+/// @param bins_number Number of bins of numeric columns.
+
+Vector<size_t> discretize(const Matrix<double>& matrix, const size_t& bins_number)
+{
+    const size_t rows_number = matrix.get_rows_number();
+    const size_t columns_number = matrix.get_columns_number();
+
+    Vector<size_t> labels(rows_number, 0);
+
+    if(columns_number > 1)
+    {
+        for(size_t i = 0; i < rows_number; i++)
+        {
+            for(size_t j = 1; j < columns_number; j++)
+            {
+                if(matrix(i,j) > matrix(i,labels[i])) labels[i] = j;
+            }
+        }
+
+        return labels;
+    }
+
+    const Vector<double> column = matrix.get_column(0);
+
+    if(column.is_binary_0_1())
+    {
+        for(size_t i = 0; i < rows_number; i++)
+        {
+            labels[i] = column[i] > 0.5 ? 1 : 0;
+        }
+
+        return labels;
+    }
+
+    const double column_minimum = minimum(column);
+    const double column_maximum = maximum(column);
+
+    if(column_maximum - column_minimum < numeric_limits<double>::min()) return labels;
+
+    const double bin_width = (column_maximum - column_minimum)/static_cast<double>(bins_number);
+
+    for(size_t i = 0; i < rows_number; i++)
+    {
+        labels[i] = min(static_cast<size_t>((column[i] - column_minimum)/bin_width), bins_number - 1);
+    }
+
+    return labels;
+}
+
+
+/// Calculates the mutual information, in nats, between two columns of data.
+/// Unlike the correlations, it also measures non monotonic dependencies.
+/// The probabilities are estimated from the joint histogram of the discretized columns,
+/// and the Miller-Madow correction is applied to the entropies, which otherwise overestimate the information of small samples.
+/// @param x Data of the first column, with one variable for each category of categorical columns.
+/// @param y Data of the second column, with one variable for each category of categorical columns.
+/// @param bins_number Number of bins of numeric columns.
+
+double mutual_information(const Matrix<double>& x, const Matrix<double>& y, const size_t& bins_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(x.get_rows_number() != y.get_rows_number())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Correlations.\n"
+               << "double mutual_information(const Matrix<double>&, const Matrix<double>&, const size_t&) method.\n"
+               << "Rows number of x (" << x.get_rows_number() << ") must be equal to rows number of y (" << y.get_rows_number() << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const size_t rows_number = x.get_rows_number();
+
+    if(rows_number == 0) return 0.0;
+
+    const Vector<size_t> x_labels = discretize(x, bins_number);
+    const Vector<size_t> y_labels = discretize(y, bins_number);
+
+    const size_t x_labels_number = *max_element(x_labels.begin(), x_labels.end()) + 1;
+    const size_t y_labels_number = *max_element(y_labels.begin(), y_labels.end()) + 1;
+
+    Matrix<double> joint_frequencies(x_labels_number, y_labels_number, 0.0);
+
+    Vector<double> x_frequencies(x_labels_number, 0.0);
+    Vector<double> y_frequencies(y_labels_number, 0.0);
+
+    for(size_t i = 0; i < rows_number; i++)
+    {
+        joint_frequencies(x_labels[i], y_labels[i]) += 1.0;
+
+        x_frequencies[x_labels[i]] += 1.0;
+        y_frequencies[y_labels[i]] += 1.0;
+    }
+
+    const double n = static_cast<double>(rows_number);
+
+    double information = 0.0;
+
+    size_t joint_bins_number = 0;
+
+    for(size_t i = 0; i < x_labels_number; i++)
+    {
+        for(size_t j = 0; j < y_labels_number; j++)
+        {
+            if(joint_frequencies(i,j) > 0.0)
+            {
+                information += joint_frequencies(i,j)/n*log(n*joint_frequencies(i,j)/(x_frequencies[i]*y_frequencies[j]));
+
+                joint_bins_number++;
+            }
+        }
+    }
+
+    const double x_bins_number = static_cast<double>(x_frequencies.count_greater_than(0.0));
+    const double y_bins_number = static_cast<double>(y_frequencies.count_greater_than(0.0));
+
+    information += (x_bins_number + y_bins_number - static_cast<double>(joint_bins_number) - 1.0)/(2.0*n);
+
+    return max(information, 0.0);
+}
+
+
+/// Calculates the mutual information, in nats, between two columns of data with missing values.
+/// The rows with a missing value in any of the columns are not taken into account.
+/// @param x Data of the first column, with one variable for each category of categorical columns.
+/// @param y Data of the second column, with one variable for each category of categorical columns.
+/// @param bins_number Number of bins of numeric columns.
+
+double mutual_information_missing_values(const Matrix<double>& x, const Matrix<double>& y, const size_t& bins_number)
+{
+    const size_t rows_number = x.get_rows_number();
+
+    Vector<size_t> not_missing_rows;
+
+    for(size_t i = 0; i < rows_number; i++)
+    {
+        if(!x.has_nan_row(i) && !y.has_nan_row(i)) not_missing_rows.push_back(i);
+    }
+
+    if(not_missing_rows.size() == rows_number) return mutual_information(x, y, bins_number);
+
+    return mutual_information(x.get_submatrix_rows(not_missing_rows), y.get_submatrix_rows(not_missing_rows), bins_number);
+}
+
+
+/// Returns the information coefficient of correlation of a mutual information, sqrt(1-exp(-2*I)).
+/// It lies between 0 and 1, and it is equal to the absolute value of the linear correlation for normally distributed variables,
+/// so that it can be compared with the other correlations.
+/// @param mutual_information Mutual information in nats.
+
+double mutual_information_correlation(const double& mutual_information)
+{
+    return sqrt(1.0 - exp(-2.0*mutual_information));
+}
+
+
 ///Filter the missing values of two vectors
 
 pair <Vector<double>, Vector<double>> filter_missing_values (const Vector<double>& x, const Vector<double>& y)
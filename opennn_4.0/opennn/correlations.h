@@ -217,6 +217,15 @@ struct CorrelationResults
 
     double one_way_anova_correlation(const Matrix<double>& ,const size_t& , const Vector<size_t>& );
 
+    // Mutual information
+
+    Vector<size_t> discretize(const Matrix<double>&, const size_t& = 10);
+
+    double mutual_information(const Matrix<double>&, const Matrix<double>&, const size_t& = 10);
+    double mutual_information_missing_values(const Matrix<double>&, const Matrix<double>&, const size_t& = 10);
+
+    double mutual_information_correlation(const double&);
+
     pair<Vector<double>, Vector<double>> filter_missing_values(const Vector<double>&, const Vector<double>&);
 
 }
@@ -86,6 +86,25 @@ CrossEntropyError::~CrossEntropyError()
 }
 
 
+/// Returns true if the last trainable layer of the neural network is a probabilistic layer with softmax activation, and false otherwise.
+/// In that case the error is the categorical cross entropy, and its gradient is computed together with the softmax.
+
+bool CrossEntropyError::has_softmax_output_layer() const
+{
+    if(!neural_network_pointer) return false;
+
+    const Vector<Layer*> trainable_layers_pointers = neural_network_pointer->get_trainable_layers_pointers();
+
+    if(trainable_layers_pointers.empty()) return false;
+
+    const Layer* output_layer_pointer = trainable_layers_pointers.get_last();
+
+    if(output_layer_pointer->get_type() != Layer::Probabilistic) return false;
+
+    return static_cast<const ProbabilisticLayer*>(output_layer_pointer)->get_activation_function() == ProbabilisticLayer::Softmax;
+}
+
+
 /// This method calculates the cross entropy error of the given batch.
 /// Returns the cross entropy error of this batch.
 /// @param batch_indices Indices of the batch instances corresponding to the dataset.
@@ -105,6 +124,8 @@ check();
 
     const Tensor<double> outputs = neural_network_pointer->calculate_trainable_outputs(inputs);
 
+    if(has_softmax_output_layer()) return categorical_cross_entropy_error(outputs, targets);
+
     return cross_entropy_error(outputs, targets);
 }
 
@@ -124,6 +145,8 @@ check();
 
     const Tensor<double> outputs = neural_network_pointer->calculate_trainable_outputs(inputs, parameters);
 
+    if(has_softmax_output_layer()) return categorical_cross_entropy_error(outputs, targets);
+
     return cross_entropy_error(outputs, targets);
 }
 
@@ -140,6 +163,8 @@ check();
 
 #endif
 
+    if(has_softmax_output_layer()) return calculate_batch_softmax_first_order_loss(batch_indices);
+
     // Data set
 
     const size_t batch_instances_number = batch_indices.size();
@@ -182,8 +207,122 @@ check();
 }
 
 
+/// This method calculates the first order loss for the selected batch when the output layer is a softmax probabilistic layer.
+/// The log-softmax of the output combinations, the categorical cross entropy and the output delta are computed in a single pass.
+/// For one-hot targets the output delta is simply the probabilities minus the targets, so the softmax Jacobian is never built.
+/// @param batch_indices Indices of the batch instances corresponding to the dataset.
+
+LossIndex::FirstOrderLoss CrossEntropyError::calculate_batch_softmax_first_order_loss(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const size_t batch_instances_number = batch_indices.size();
+
+    // Neural network
+
+    const size_t layers_number = neural_network_pointer->get_trainable_layers_number();
+
+    const size_t parameters_number = neural_network_pointer->get_parameters_number();
+
+    const Vector<Layer*> trainable_layers_pointers = neural_network_pointer->get_trainable_layers_pointers();
+
+    // Loss index
+
+    FirstOrderLoss first_order_loss(parameters_number);
+
+    const Tensor<double> inputs = data_set_pointer->get_input_data(batch_indices);
+
+    const Tensor<double> targets = data_set_pointer->get_target_data(batch_indices);
+
+    // Forward propagation of the hidden layers
+
+    Vector<Layer::FirstOrderActivations> forward_propagation(layers_number);
+
+    for(size_t i = 0; i+1 < layers_number; i++)
+    {
+        forward_propagation[i] = trainable_layers_pointers[i]
+                ->calculate_first_order_activations(i == 0 ? inputs : forward_propagation[i-1].activations);
+    }
+
+    const ProbabilisticLayer* probabilistic_layer_pointer = static_cast<ProbabilisticLayer*>(trainable_layers_pointers[layers_number-1]);
+
+    const Tensor<double> combinations
+            = probabilistic_layer_pointer->calculate_combinations(layers_number == 1 ? inputs : forward_propagation[layers_number-2].activations);
+
+    // Softmax cross entropy
+
+    const size_t outputs_number = combinations.get_dimension(1);
+
+    Tensor<double> output_delta(batch_instances_number, outputs_number);
+
+    double error = 0.0;
+
+    for(size_t i = 0; i < batch_instances_number; i++)
+    {
+        double maximum = combinations(i,0);
+
+        for(size_t j = 1; j < outputs_number; j++)
+        {
+            if(combinations(i,j) > maximum) maximum = combinations(i,j);
+        }
+
+        double sum = 0.0;
+
+        for(size_t j = 0; j < outputs_number; j++)
+        {
+            output_delta(i,j) = exp(combinations(i,j) - maximum);
+
+            sum += output_delta(i,j);
+        }
+
+        const double logarithm_sum = log(sum);
+
+        double targets_sum = 0.0;
+
+        for(size_t j = 0; j < outputs_number; j++)
+        {
+            const double target = targets(i,j);
+
+            if(target != 0.0) error -= target*(combinations(i,j) - maximum - logarithm_sum);
+
+            targets_sum += target;
+        }
+
+        for(size_t j = 0; j < outputs_number; j++)
+        {
+            output_delta(i,j) = output_delta(i,j)*targets_sum/sum - targets(i,j);
+        }
+    }
+
+    const Vector<Tensor<double>> layers_delta = calculate_hidden_layers_delta(forward_propagation, output_delta);
+
+    const Vector<double> batch_error_gradient = calculate_error_gradient(inputs, forward_propagation, layers_delta);
+
+    first_order_loss.loss = error;
+
+    first_order_loss.gradient = batch_error_gradient/static_cast<double>(batch_instances_number);
+
+    // Regularization
+
+    if(regularization_method != RegularizationMethod::NoRegularization)
+    {
+        first_order_loss.loss += regularization_weight*calculate_regularization();
+        first_order_loss.gradient += calculate_regularization_gradient()*regularization_weight;
+    }
+
+    return first_order_loss;
+}
+
+
 /// Returns the cross-entropy error function output gradient of a neural network on a data set.
 /// It uses the error back-propagation method.
+/// With softmax outputs, it is the gradient of the categorical cross entropy.
 /// @param outputs Tensor of outputs of the neural network.
 /// @param targets Tensor of targets of the data set.
 
@@ -195,6 +334,20 @@ check();
 
 #endif
 
+    if(has_softmax_output_layer())
+    {
+        Tensor<double> output_gradient(outputs.get_dimensions());
+
+        const size_t size = outputs.size();
+
+        for(size_t i = 0; i < size; i++)
+        {
+            output_gradient[i] = -targets[i]/max(outputs[i], numeric_limits<double>::min());
+        }
+
+        return output_gradient;
+    }
+
     return (targets/outputs)*(-1.0) + (targets*(-1.0) + 1.0)/(outputs*(-1.0) + 1.0);
 }
 
@@ -63,6 +63,10 @@ public:
 
    virtual ~CrossEntropyError();
 
+   // Get methods
+
+   bool has_softmax_output_layer() const;
+
    // Error methods
 
    double calculate_batch_error(const Vector<size_t>&) const;
@@ -71,6 +75,7 @@ public:
    // Gradient methods
 
    FirstOrderLoss calculate_batch_first_order_loss(const Vector<size_t>&) const;
+   FirstOrderLoss calculate_batch_softmax_first_order_loss(const Vector<size_t>&) const;
 
    Tensor<double> calculate_output_gradient(const Tensor<double>&, const Tensor<double>&) const;
 
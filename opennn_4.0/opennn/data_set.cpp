@@ -879,45 +879,92 @@ const Vector<DataSet::InstanceUse>& DataSet::get_instances_uses() const
 
 
 /// Returns a vector, where each element is a vector that contains the indices of the different batches of the training instances.
-/// @param shuffle Is a boleean.
-/// If shuffle is true, then the indices are shuffled into batches, and false otherwise
-/// @todo In forecasting must be false.
+/// @param shuffle_batches_instances If shuffle is true, then the indices are shuffled into batches, and false otherwise.
+/// @param timesteps Number of consecutive instances which make a sequence for recurrent layers.
+/// Sequences are never split between batches, and only their order is shuffled.
 
-Vector<Vector<size_t>> DataSet::get_training_batches(const bool& shuffle_batches_instances) const
+Vector<Vector<size_t>> DataSet::get_training_batches(const bool& shuffle_batches_instances, const size_t& timesteps) const
 {
-    Vector<size_t> training_indices = get_training_instances_indices();
-
-    if(shuffle_batches_instances) random_shuffle(training_indices.begin(), training_indices.end());
-
-    return training_indices.split(batch_instances_number);
+    return split_batches(get_training_instances_indices(), shuffle_batches_instances, timesteps);
 }
 
 
 /// Returns a vector, where each element is a vector that contains the indices of the different batches of the selection instances.
-/// @param shuffle Is a boleean.
-/// If shuffle is true, then the indices are shuffled into batches, and false otherwise
+/// @param shuffle_batches_instances If shuffle is true, then the indices are shuffled into batches, and false otherwise.
+/// @param timesteps Number of consecutive instances which make a sequence for recurrent layers.
 
-Vector<Vector<size_t>> DataSet::get_selection_batches(const bool& shuffle_batches_instances) const
+Vector<Vector<size_t>> DataSet::get_selection_batches(const bool& shuffle_batches_instances, const size_t& timesteps) const
 {
-    Vector<size_t> selection_indices = get_selection_instances_indices();
+    return split_batches(get_selection_instances_indices(), shuffle_batches_instances, timesteps);
+}
+
 
-    if(shuffle_batches_instances) random_shuffle(selection_indices.begin(), selection_indices.end());
+/// Returns a vector, where each element is a vector that contains the indices of the different batches of the testing instances.
+/// @param shuffle_batches_instances If shuffle is true, then the indices are shuffled into batches, and false otherwise.
+/// @param timesteps Number of consecutive instances which make a sequence for recurrent layers.
 
-    return selection_indices.split(batch_instances_number);
+Vector<Vector<size_t>> DataSet::get_testing_batches(const bool& shuffle_batches_instances, const size_t& timesteps) const
+{
+    return split_batches(get_testing_instances_indices(), shuffle_batches_instances, timesteps);
 }
 
 
-/// Returns a vector, where each element is a vector that contains the indices of the different batches of the testing instances.
-/// If shuffle is true, then the indices within batches are shuffle, and false otherwise
-/// @param shuffle_batches_instances Is a boleean.
+/// Splits a set of instances indices into batches of batch_instances_number instances.
+/// The indices are first grouped into sequences of timesteps consecutive instances.
+/// Each batch contains whole sequences, so that recurrent layers can process them in parallel
+/// and reset their states at the beginning of each one.
+/// As with the instances of a batch, the instances which do not fill a whole sequence at the end are left out,
+/// so that every sequence has timesteps instances, and recurrent layers locate them by their position.
+/// Only when there are fewer instances than timesteps, they make a single shorter sequence.
+/// @param instances_indices Indices of the instances to be split.
+/// @param shuffle_batches_instances If shuffle is true, the order of the sequences is shuffled, and false otherwise.
+/// @param timesteps Number of instances in each sequence. One for non recurrent neural networks.
 
-Vector<Vector<size_t>> DataSet::get_testing_batches(const bool& shuffle_batches_instances) const
+Vector<Vector<size_t>> DataSet::split_batches(const Vector<size_t>& instances_indices,
+                                              const bool& shuffle_batches_instances,
+                                              const size_t& timesteps) const
 {
-    Vector<size_t> testing_indices = get_testing_instances_indices();
+    if(timesteps <= 1)
+    {
+        Vector<size_t> indices(instances_indices);
+
+        if(shuffle_batches_instances) shuffle(indices.begin(), indices.end(), get_random_generator());
+
+        return indices.split(batch_instances_number);
+    }
+
+    const Vector<Vector<size_t>> sequences = instances_indices.split(timesteps);
+
+    const size_t sequences_number = sequences.size();
+
+    Vector<size_t> sequences_indices(sequences_number);
+    sequences_indices.initialize_sequential();
+
+    if(shuffle_batches_instances) shuffle(sequences_indices.begin(), sequences_indices.end(), get_random_generator());
 
-    if(shuffle_batches_instances) random_shuffle(testing_indices.begin(), testing_indices.end());
+    const size_t batch_sequences_number = max(batch_instances_number/timesteps, static_cast<size_t>(1));
 
-    return testing_indices.split(batch_instances_number);
+    const Vector<Vector<size_t>> batches_sequences = sequences_indices.split(batch_sequences_number);
+
+    const size_t batches_number = batches_sequences.size();
+
+    Vector<Vector<size_t>> batches(batches_number);
+
+    for(size_t i = 0; i < batches_number; i++)
+    {
+        const size_t current_sequences_number = batches_sequences[i].size();
+
+        Vector<Vector<size_t>> batch_sequences(current_sequences_number);
+
+        for(size_t j = 0; j < current_sequences_number; j++)
+        {
+            batch_sequences[j] = sequences[batches_sequences[i][j]];
+        }
+
+        batches[i] = Vector<size_t>::assemble(batch_sequences);
+    }
+
+    return batches;
 }
 
 
@@ -1299,7 +1346,7 @@ void DataSet::split_instances_random(const double& training_instances_ratio,
    const size_t instances_number = get_instances_number();
 
    Vector<size_t> indices(0, 1, instances_number-1);
-   random_shuffle(indices.begin(), indices.end());
+   shuffle(indices.begin(), indices.end(), get_random_generator());
 
    size_t i = 0;
    size_t index;
@@ -2842,7 +2889,7 @@ Matrix<double> DataSet::get_training_data() const
 
    const Vector<size_t> training_indices = get_training_instances_indices();
 
-   return(data.get_submatrix(training_indices, variables_indices));
+   return(get_data().get_submatrix(training_indices, variables_indices));
 }
 
 
@@ -2874,7 +2921,7 @@ Matrix<double> DataSet::get_selection_data() const
 
    Vector<size_t> variables_indices(0, 1,variables_number-1);
 
-   return(data.get_submatrix(selection_indices, variables_indices));
+   return(get_data().get_submatrix(selection_indices, variables_indices));
 }
 
 
@@ -2905,7 +2952,7 @@ Matrix<double> DataSet::get_testing_data() const
 
    const Vector<size_t> testing_indices = get_testing_instances_indices();
 
-   return(data.get_submatrix(testing_indices, variables_indices));
+   return(get_data().get_submatrix(testing_indices, variables_indices));
 }
 
 
@@ -2937,7 +2984,7 @@ Matrix<double> DataSet::get_input_data() const
 
    const Vector<size_t> inputs_indices = get_input_variables_indices();
 
-   return(data.get_submatrix(indices, inputs_indices));
+   return(get_data().get_submatrix(indices, inputs_indices));
 }
 
 
@@ -2968,7 +3015,7 @@ Matrix<double> DataSet::get_target_data() const
 
    const Vector<size_t> targets_indices = get_target_variables_indices();
 
-   return(data.get_submatrix(indices, targets_indices));
+   return(get_data().get_submatrix(indices, targets_indices));
 }
 
 
@@ -2998,7 +3045,7 @@ Tensor<double> DataSet::get_input_data(const Vector<size_t>& instances_indices)
 
     const Vector<size_t> inputs_indices = get_input_variables_indices();
 
-    return data.get_tensor(instances_indices, inputs_indices, inputs_dimensions);
+    return get_data().get_tensor(instances_indices, inputs_indices, inputs_dimensions);
 }
 
 
@@ -3012,7 +3059,7 @@ Tensor<double> DataSet::get_target_data(const Vector<size_t>& instances_indices)
 
     const Vector<size_t> targets_indices = get_target_variables_indices();
 
-    return data.get_tensor(instances_indices, targets_indices, targets_dimensions);
+    return get_data().get_tensor(instances_indices, targets_indices, targets_dimensions);
 }
 
 
@@ -3022,6 +3069,8 @@ Tensor<double> DataSet::get_target_data(const Vector<size_t>& instances_indices)
 
 Matrix<float> DataSet::get_input_data_float(const Vector<size_t>& instances_indices) const
 {
+    const Matrix<double>& instances_data = get_data();
+
     const Vector<size_t> inputs_indices = get_input_variables_indices();
 
     const size_t instances_number = instances_indices.size();
@@ -3039,7 +3088,7 @@ Matrix<float> DataSet::get_input_data_float(const Vector<size_t>& instances_indi
        for(size_t j = 0; j < inputs_number; j++)
        {
           input_index = inputs_indices[j];
-          inputs_float(i,j) = static_cast<float>(data(instance_index,input_index));
+          inputs_float(i,j) = static_cast<float>(instances_data(instance_index,input_index));
        }
     }
 
@@ -3053,6 +3102,8 @@ Matrix<float> DataSet::get_input_data_float(const Vector<size_t>& instances_indi
 
 Matrix<float> DataSet::get_target_data_float(const Vector<size_t>& instances_indices) const
 {
+    const Matrix<double>& instances_data = get_data();
+
     const Vector<size_t> targets_indices = get_target_variables_indices();
 
     const size_t instances_number = instances_indices.size();
@@ -3072,7 +3123,7 @@ Matrix<float> DataSet::get_target_data_float(const Vector<size_t>& instances_ind
        {
           target_index = targets_indices[j];
 
-          targets_float(i,j) = static_cast<float>(data(instance_index,target_index));
+          targets_float(i,j) = static_cast<float>(instances_data(instance_index,target_index));
        }
     }
 
@@ -3092,7 +3143,7 @@ Tensor<double> DataSet::get_training_input_data() const
 
     const Vector<size_t> inputs_dimensions = get_input_variables_dimensions();
 
-    return data.get_tensor(training_indices, inputs_indices, inputs_dimensions);
+    return get_data().get_tensor(training_indices, inputs_indices, inputs_dimensions);
 }
 
 
@@ -3123,7 +3174,7 @@ Tensor<double> DataSet::get_training_target_data() const
 
    const Vector<size_t> targets_indices = get_target_variables_indices();
 
-   return data.get_tensor(training_indices, targets_indices, get_target_variables_dimensions());
+   return get_data().get_tensor(training_indices, targets_indices, get_target_variables_dimensions());
 }
 
 
@@ -3153,7 +3204,7 @@ Tensor<double> DataSet::get_selection_input_data() const
 
    const Vector<size_t> inputs_indices = get_input_variables_indices();
 
-   return data.get_tensor(selection_indices, inputs_indices, get_input_variables_dimensions());
+   return get_data().get_tensor(selection_indices, inputs_indices, get_input_variables_dimensions());
 }
 
 
@@ -3183,7 +3234,7 @@ Tensor<double> DataSet::get_selection_target_data() const
 
    const Vector<size_t> targets_indices = get_target_variables_indices();
 
-   return data.get_tensor(selection_indices, targets_indices, get_target_variables_dimensions());
+   return get_data().get_tensor(selection_indices, targets_indices, get_target_variables_dimensions());
 }
 
 
@@ -3213,7 +3264,7 @@ Tensor<double> DataSet::get_testing_input_data() const
 
    const Vector<size_t> testing_indices = get_testing_instances_indices();
 
-   return data.get_tensor(testing_indices, inputs_indices, get_input_variables_dimensions());
+   return get_data().get_tensor(testing_indices, inputs_indices, get_input_variables_dimensions());
 }
 
 
@@ -3243,7 +3294,7 @@ Tensor<double> DataSet::get_testing_target_data() const
 
    const Vector<size_t> testing_indices = get_testing_instances_indices();
 
-   return data.get_tensor(testing_indices, targets_indices, get_target_variables_dimensions());
+   return get_data().get_tensor(testing_indices, targets_indices, get_target_variables_dimensions());
 }
 
 
@@ -3287,7 +3338,7 @@ Vector<double> DataSet::get_instance_data(const size_t& index) const
 
    // Get instance
 
-   return data.get_row(index);
+   return get_data().get_row(index);
 }
 
 
@@ -3314,7 +3365,7 @@ Vector<double> DataSet::get_instance_data(const size_t& instance_index, const Ve
 
    #endif
 
-   return data.get_row(instance_index, variables_indices);
+   return get_data().get_row(instance_index, variables_indices);
 }
 
 
@@ -3326,7 +3377,7 @@ Tensor<double> DataSet::get_instance_input_data(const size_t & instance_index) c
     const Vector<size_t> inputs_indices = get_input_variables_indices();
     const Vector<size_t> inputs_dimension = get_input_variables_dimensions();
 
-    return data.get_tensor(Vector<size_t>({instance_index}),inputs_indices,inputs_dimension);
+    return get_data().get_tensor(Vector<size_t>({instance_index}),inputs_indices,inputs_dimension);
 }
 
 
@@ -3338,7 +3389,7 @@ Tensor<double> DataSet::get_instance_target_data(const size_t & instance_index)
     const Vector<size_t> targets_indices = get_target_variables_indices();
     const Vector<size_t> targets_dimension = get_target_variables_dimensions();
 
-    return data.get_tensor(Vector<size_t>({instance_index}),targets_indices,targets_dimension);
+    return get_data().get_tensor(Vector<size_t>({instance_index}),targets_indices,targets_dimension);
 }
 
 
@@ -3403,13 +3454,13 @@ Matrix<double> DataSet::get_column_data(const size_t& column_index) const
 {
     const Vector<size_t> variable_indices = get_variable_indices(column_index);
 
-    return data.get_submatrix_columns(variable_indices);
+    return get_data().get_submatrix_columns(variable_indices);
 }
 
 
 Matrix<double> DataSet::get_column_data(const Vector<size_t>& variables_indices) const
 {
-    return data.get_submatrix_columns(variables_indices);
+    return get_data().get_submatrix_columns(variables_indices);
 }
 
 
@@ -3443,7 +3494,7 @@ Vector<double> DataSet::get_variable_data(const size_t& index) const
 
    #endif
 
-   return data.get_column(index);
+   return get_data().get_column(index);
 }
 
 
@@ -3719,6 +3770,20 @@ void DataSet::set(const size_t& new_instances_number,
 /// @param other_data_set Data set object to be copied.
 
 void DataSet::set(const DataSet& other_data_set)
+{
+   set_metadata(other_data_set);
+
+   data = other_data_set.data;
+
+   time_series_data = other_data_set.time_series_data;
+}
+
+
+/// Sets all the members of this data set object, except the data matrices, with those from another data set object.
+/// It is used by the data set views, which read the data of the other data set instead of copying it.
+/// @param other_data_set Data set object whose columns, instances uses and settings are to be copied.
+
+void DataSet::set_metadata(const DataSet& other_data_set)
 {
    data_file_name = other_data_set.data_file_name;
 
@@ -3728,10 +3793,32 @@ void DataSet::set(const DataSet& other_data_set)
 
    missing_values_label = other_data_set.missing_values_label;
 
-   data = other_data_set.data;
-
    columns = other_data_set.columns;
 
+   inputs_dimensions = other_data_set.inputs_dimensions;
+
+   targets_dimensions = other_data_set.targets_dimensions;
+
+   has_rows_labels = other_data_set.has_rows_labels;
+
+   rows_labels = other_data_set.rows_labels;
+
+   gmt = other_data_set.gmt;
+
+   time_series_columns = other_data_set.time_series_columns;
+
+   lags_number = other_data_set.lags_number;
+
+   steps_ahead = other_data_set.steps_ahead;
+
+   time_index = other_data_set.time_index;
+
+   missing_values_method = other_data_set.missing_values_method;
+
+   instances_uses = other_data_set.instances_uses;
+
+   batch_instances_number = other_data_set.batch_instances_number;
+
    display = other_data_set.display;
 }
 
@@ -4340,6 +4427,8 @@ Vector<BoxPlot> DataSet::calculate_columns_box_plots() const
 
 size_t DataSet::calculate_training_negatives(const size_t& target_index) const
 {
+    const Matrix<double>& instances_data = get_data();
+
     size_t negatives = 0;
 
     const Vector<size_t> training_indices = get_training_instances_indices();
@@ -4350,17 +4439,17 @@ size_t DataSet::calculate_training_negatives(const size_t& target_index) const
     {
         const size_t training_index = training_indices[static_cast<size_t>(i)];
 
-        if(data(training_index, target_index) == 0.0)
+        if(instances_data(training_index, target_index) == 0.0)
         {
             negatives++;
         }
-        else if(data(training_index, target_index) != 1.0)
+        else if(instances_data(training_index, target_index) != 1.0)
         {
             ostringstream buffer;
 
            buffer << "OpenNN Exception: DataSet class.\n"
                   << "size_t calculate_training_negatives(const size_t&) const method.\n"
-                  << "Training instance is neither a positive nor a negative: " << data(training_index, target_index) << endl;
+                  << "Training instance is neither a positive nor a negative: " << instances_data(training_index, target_index) << endl;
 
            throw logic_error(buffer.str());
         }
@@ -4375,6 +4464,8 @@ size_t DataSet::calculate_training_negatives(const size_t& target_index) const
 
 size_t DataSet::calculate_selection_negatives(const size_t& target_index) const
 {
+    const Matrix<double>& instances_data = get_data();
+
     size_t negatives = 0;
 
     const size_t selection_instances_number = get_selection_instances_number();
@@ -4385,17 +4476,17 @@ size_t DataSet::calculate_selection_negatives(const size_t& target_index) const
     {
         const size_t selection_index = selection_indices[static_cast<size_t>(i)];
 
-        if(data(selection_index, target_index) == 0.0)
+        if(instances_data(selection_index, target_index) == 0.0)
         {
             negatives++;
         }
-        else if(data(selection_index, target_index) != 1.0)
+        else if(instances_data(selection_index, target_index) != 1.0)
         {
             ostringstream buffer;
 
            buffer << "OpenNN Exception: DataSet class.\n"
                   << "size_t calculate_selection_negatives(const size_t&) const method.\n"
-                  << "Selection instance is neither a positive nor a negative: " << data(selection_index, target_index) << endl;
+                  << "Selection instance is neither a positive nor a negative: " << instances_data(selection_index, target_index) << endl;
 
            throw logic_error(buffer.str());
         }
@@ -4815,7 +4906,7 @@ Vector<double> DataSet::calculate_training_targets_mean() const
 
     const Vector<size_t> targets_indices = get_target_variables_indices();
 
-    return mean_missing_values(data, training_indices, targets_indices);
+    return mean_missing_values(get_data(), training_indices, targets_indices);
 }
 
 
@@ -4827,7 +4918,7 @@ Vector<double> DataSet::calculate_selection_targets_mean() const
 
     const Vector<size_t> targets_indices = get_target_variables_indices();
 
-    return mean_missing_values(data, selection_indices, targets_indices);
+    return mean_missing_values(get_data(), selection_indices, targets_indices);
 }
 
 
@@ -4839,7 +4930,7 @@ Vector<double> DataSet::calculate_testing_targets_mean() const
 
    const Vector<size_t> targets_indices = get_target_variables_indices();
 
-   return mean_missing_values(data, testing_indices, targets_indices);
+   return mean_missing_values(get_data(), testing_indices, targets_indices);
 }
 
 
@@ -5238,6 +5329,9 @@ Matrix<double> DataSet::calculate_covariance_matrix() const
 
 /// Performs the principal components analysis of the inputs.
 /// It returns a matrix containing the principal components getd in rows.
+/// When some components can be discarded, only the leading ones are computed with a randomized truncated singular value decomposition,
+/// doubling their number until the last one explains less variance than requested.
+/// Otherwise the full covariance matrix is decomposed.
 /// This method deletes the unused instances of the original data set.
 /// @param minimum_explained_variance Minimum percentage of variance used to select a principal component.
 
@@ -5247,71 +5341,90 @@ Matrix<double> DataSet::perform_principal_components_analysis(const double& mini
 
     subtract_inputs_mean();
 
-    // Calculate covariance matrix
+    const Vector<size_t> used_instances_indices = get_used_instances_indices();
+    const Vector<size_t> inputs_indices = get_input_variables_indices();
 
-    const Matrix<double> covariance_matrix = this->calculate_covariance_matrix();
+    const Matrix<double> inputs = data.get_submatrix(used_instances_indices, inputs_indices);
 
-    // Calculate eigenvectors
+    const size_t instances_number = inputs.get_rows_number();
+    const size_t inputs_number = inputs.get_columns_number();
 
-    const Matrix<double> eigenvectors = OpenNN::eigenvectors(covariance_matrix);
+    const size_t maximum_components_number = min(instances_number, inputs_number);
 
-    // Calculate eigenvalues
+    Matrix<double> principal_components;
 
-    const Matrix<double> eigenvalues = OpenNN::eigenvalues(covariance_matrix);
+    if(instances_number < 2 || inputs_number == 0) return principal_components;
 
-    // Calculate explained variance
+    // Total variance, which is the trace of the covariance matrix
 
-    const Vector<double> explained_variance = OpenNN::explained_variance(eigenvalues.get_column(0));
+    double total_variance = 0.0;
 
-    // Sort principal components
+    for(size_t i = 0; i < inputs.size(); i++)
+    {
+        total_variance += inputs[i]*inputs[i];
+    }
 
-    const Vector<size_t> sorted_principal_components_indices = explained_variance.sort_descending_indices();
+    total_variance /= static_cast<double>(instances_number - 1);
 
-    // Choose eigenvectors
+    if(total_variance < numeric_limits<double>::min()) return principal_components;
 
-    const size_t inputs_number = covariance_matrix.get_columns_number();
+    // Calculate leading principal components
 
-    Vector<size_t> principal_components_indices;
+    Vector<double> variances;
 
-    size_t index;
+    size_t components_number = min(static_cast<size_t>(16), maximum_components_number);
 
-    for(size_t i = 0; i < inputs_number; i++)
+    while(true)
     {
-        index = sorted_principal_components_indices[i];
-
-        if(explained_variance[index] >= minimum_explained_variance)
+        if(minimum_explained_variance <= 0.0 || 2*components_number > maximum_components_number)
         {
-            principal_components_indices.push_back(i);
-        }
-        else
-        {
-            continue;
-        }
-    }
+            const Eigen::Map<Eigen::MatrixXd> inputs_eigen((double*)inputs.data(), static_cast<int>(instances_number), static_cast<int>(inputs_number));
 
-    const size_t principal_components_number = principal_components_indices.size();
+            const Eigen::MatrixXd covariance_eigen = inputs_eigen.transpose()*inputs_eigen/static_cast<double>(instances_number - 1);
 
-    // Arrange principal components matrix
+            const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> covariance_solver(covariance_eigen, Eigen::ComputeEigenvectors);
 
-    Matrix<double> principal_components;
+            // Eigenvalues are sorted in ascending order
 
-    if(principal_components_number == 0)
-    {
-        return principal_components;
-    }
-    else
-    {
-        principal_components.set(principal_components_number, inputs_number);
+            principal_components.set(inputs_number, inputs_number);
+
+            variances.set(inputs_number);
+
+            for(size_t i = 0; i < inputs_number; i++)
+            {
+                const int index = static_cast<int>(inputs_number - 1 - i);
+
+                for(size_t j = 0; j < inputs_number; j++)
+                {
+                    principal_components(i,j) = covariance_solver.eigenvectors()(static_cast<int>(j), index);
+                }
+
+                variances[i] = covariance_solver.eigenvalues()(index);
+            }
+
+            break;
+        }
+
+        principal_components = truncated_principal_components(inputs, components_number, variances);
+
+        if(variances.get_last()*100.0/total_variance < minimum_explained_variance) break;
+
+        components_number *= 2;
     }
 
-    for(size_t i = 0; i < principal_components_number; i++)
-    {
-        index = sorted_principal_components_indices[i];
+    // Choose principal components
 
-        principal_components.set_row(i, eigenvectors.get_column(index));
+    Vector<size_t> principal_components_indices;
+
+    for(size_t i = 0; i < variances.size(); i++)
+    {
+        if(variances[i]*100.0/total_variance >= minimum_explained_variance)
+        {
+            principal_components_indices.push_back(i);
+        }
     }
 
-    // Return feature matrix
+    if(principal_components_indices.empty()) return Matrix<double>();
 
     return principal_components.get_submatrix_rows(principal_components_indices);
 }
@@ -5391,12 +5504,11 @@ Matrix<double> DataSet::perform_principal_components_analysis(const Matrix<doubl
 
 
 /// Transforms the data according to the principal components.
+/// All the used instances are projected at once with a single matrix product.
 /// @param principal_components Matrix containing the principal components.
 
 void DataSet::transform_principal_components_data(const Matrix<double>& principal_components)
 {
-    const Matrix<double> targets = get_target_data();
-
     subtract_inputs_mean();
 
     const size_t principal_components_number = principal_components.get_rows_number();
@@ -5407,21 +5519,18 @@ void DataSet::transform_principal_components_data(const Matrix<double>& principa
 
     const size_t new_instances_number = get_used_instances_number();
 
-    const Matrix<double> inputs = get_input_data();
+    const Matrix<double> inputs = data.get_submatrix(used_instances, get_input_variables_indices());
+    const Matrix<double> targets = data.get_submatrix(used_instances, get_target_variables_indices());
 
-    Matrix<double> new_data(new_instances_number, principal_components_number, 0.0);
+    const size_t inputs_number = inputs.get_columns_number();
 
-    size_t instance_index;
+    Matrix<double> new_data(new_instances_number, principal_components_number);
 
-    for(size_t i = 0; i < new_instances_number; i++)
-    {
-        instance_index = used_instances[i];
+    const Eigen::Map<Eigen::MatrixXd> inputs_eigen((double*)inputs.data(), static_cast<int>(new_instances_number), static_cast<int>(inputs_number));
+    const Eigen::Map<Eigen::MatrixXd> principal_components_eigen((double*)principal_components.data(), static_cast<int>(principal_components_number), static_cast<int>(inputs_number));
+    Eigen::Map<Eigen::MatrixXd> new_data_eigen(new_data.data(), static_cast<int>(new_instances_number), static_cast<int>(principal_components_number));
 
-        for(size_t j = 0; j < principal_components_number; j++)
-        {
-            new_data(i,j) = dot(inputs.get_row(instance_index), principal_components.get_row(j));
-        }
-    }
+    new_data_eigen.noalias() = inputs_eigen*principal_components_eigen.transpose();
 
     data = new_data.assemble_columns(targets);
 }
@@ -7219,6 +7328,8 @@ void DataSet::load_time_series_data_binary()
 
 Vector<size_t> DataSet::calculate_target_distribution() const
 {
+   const Matrix<double>& instances_data = get_data();
+
    const size_t instances_number = get_instances_number();
    const size_t targets_number = get_target_variables_number();
    const Vector<size_t> targets_indices = get_target_variables_indices();
@@ -7236,9 +7347,9 @@ Vector<size_t> DataSet::calculate_target_distribution() const
 
       for(int instance_index = 0; instance_index < static_cast<int>(instances_number); instance_index++)
       {
-          if(!::isnan(data(static_cast<size_t>(instance_index),target_index)))
+          if(!::isnan(instances_data(static_cast<size_t>(instance_index),target_index)))
           {
-              if(data(static_cast<size_t>(instance_index),target_index) < 0.5)
+              if(instances_data(static_cast<size_t>(instance_index),target_index) < 0.5)
               {
                   negatives++;
               }
@@ -7262,9 +7373,9 @@ Vector<size_t> DataSet::calculate_target_distribution() const
           {
              for(size_t j = 0; j < targets_number; j++)
              {
-                 if(data(i,targets_indices[j]) == static_cast<double>(NAN)) continue;
+                 if(instances_data(i,targets_indices[j]) == static_cast<double>(NAN)) continue;
 
-                 if(data(i,targets_indices[j]) > 0.5) class_distribution[j]++;
+                 if(instances_data(i,targets_indices[j]) > 0.5) class_distribution[j]++;
              }
           }
       }
@@ -8024,7 +8135,7 @@ void DataSet::generate_data_multiple_classification(const size_t& instances_numb
 
     for(size_t i = 0; i < instances_number; i ++)
     {
-        target_index = static_cast<unsigned>(rand())%outputs_number;
+        target_index = get_random_generator().calculate_index(outputs_number);
 
         targets(i, target_index) = 1.0;
     }
@@ -8038,7 +8149,7 @@ void DataSet::generate_data_multiple_classification(const size_t& instances_numb
 
 bool DataSet::has_data() const
 {
-    if(data.empty())
+    if(get_data().empty())
     {
         return false;
     }
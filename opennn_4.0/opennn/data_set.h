@@ -263,13 +263,15 @@ public:
 
    inline size_t get_batch_instances_number() {return batch_instances_number;}
 
-   Vector<Vector<size_t>> get_training_batches(const bool& = true) const;
-   Vector<Vector<size_t>> get_selection_batches(const bool& = true) const;
-   Vector<Vector<size_t>> get_testing_batches(const bool& = true) const;
+   Vector<Vector<size_t>> get_training_batches(const bool& = true, const size_t& = 1) const;
+   Vector<Vector<size_t>> get_selection_batches(const bool& = true, const size_t& = 1) const;
+   Vector<Vector<size_t>> get_testing_batches(const bool& = true, const size_t& = 1) const;
+
+   Vector<Vector<size_t>> split_batches(const Vector<size_t>&, const bool&, const size_t&) const;
 
    // Data get methods
 
-   const Matrix<double>& get_data() const;
+   virtual const Matrix<double>& get_data() const;
    const Eigen::MatrixXd get_data_eigen() const;
 
    const Matrix<double>& get_time_series_data() const;
@@ -286,8 +288,8 @@ public:
    Matrix<double> get_target_data() const;
    Eigen::MatrixXd get_target_data_eigen() const;
 
-   Tensor<double> get_input_data(const Vector<size_t>&) const;
-   Tensor<double> get_target_data(const Vector<size_t>&) const;
+   virtual Tensor<double> get_input_data(const Vector<size_t>&) const;
+   virtual Tensor<double> get_target_data(const Vector<size_t>&) const;
 
    Matrix<float> get_input_data_float(const Vector<size_t>&) const;
    Matrix<float> get_target_data_float(const Vector<size_t>&) const;
@@ -360,6 +362,8 @@ public:
    void set(const tinyxml2::XMLDocument&);
    void set(const string&);
 
+   void set_metadata(const DataSet&);
+
    void set_default();
 
    // Instances set methods
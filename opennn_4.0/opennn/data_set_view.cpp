@@ -0,0 +1,123 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   S E T   V I E W   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "data_set_view.h"
+
+namespace OpenNN
+{
+
+/// Data set constructor.
+/// It creates a view of a data set with all its input columns.
+/// The columns, instances uses and settings of the data set are copied, but not its data.
+/// @param new_data_set Data set to be viewed. It must outlive the view.
+
+DataSetView::DataSetView(const DataSet& new_data_set) : DataSet()
+{
+    data_set_pointer = &new_data_set;
+
+    set_metadata(new_data_set);
+
+    original_input_columns_indices = get_input_columns_indices();
+
+    inputs_mask.set(original_input_columns_indices.size(), true);
+
+    input_variables_indices = get_input_variables_indices();
+
+    target_variables_indices = get_target_variables_indices();
+}
+
+
+/// Destructor.
+
+DataSetView::~DataSetView()
+{
+}
+
+
+/// Returns a pointer to the data set whose data is viewed.
+
+const DataSet* DataSetView::get_data_set_pointer() const
+{
+    return data_set_pointer;
+}
+
+
+/// Returns the mask of the input columns of the viewed data set which are inputs of the view.
+
+const Vector<bool>& DataSetView::get_inputs_mask() const
+{
+    return inputs_mask;
+}
+
+
+/// Returns a reference to the data matrix of the viewed data set.
+
+const Matrix<double>& DataSetView::get_data() const
+{
+    return data_set_pointer->get_data();
+}
+
+
+/// Returns a tensor with the input variables of the view for some instances.
+/// @param instances_indices Indices of the instances.
+
+Tensor<double> DataSetView::get_input_data(const Vector<size_t>& instances_indices) const
+{
+    return data_set_pointer->get_data().get_tensor(instances_indices, input_variables_indices, get_input_variables_dimensions());
+}
+
+
+/// Returns a tensor with the target variables of the view for some instances.
+/// @param instances_indices Indices of the instances.
+
+Tensor<double> DataSetView::get_target_data(const Vector<size_t>& instances_indices) const
+{
+    return data_set_pointer->get_data().get_tensor(instances_indices, target_variables_indices, get_target_variables_dimensions());
+}
+
+
+/// Selects the input columns of the view.
+/// The other input columns of the viewed data set are unused in the view.
+/// The viewed data set is not modified.
+/// @param new_inputs_mask True for the input columns of the viewed data set which are to be inputs of the view, and false otherwise.
+
+void DataSetView::set_inputs_mask(const Vector<bool>& new_inputs_mask)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_inputs_mask.size() != original_input_columns_indices.size())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSetView class.\n"
+               << "void set_inputs_mask(const Vector<bool>&) method.\n"
+               << "Size of inputs mask (" << new_inputs_mask.size() << ") must be equal to number of input columns (" << original_input_columns_indices.size() << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    Vector<VariableUse> columns_uses = get_columns_uses();
+
+    for(size_t i = 0; i < original_input_columns_indices.size(); i++)
+    {
+        columns_uses[original_input_columns_indices[i]] = new_inputs_mask[i] ? Input : UnusedVariable;
+    }
+
+    set_columns_uses(columns_uses);
+
+    inputs_mask = new_inputs_mask;
+
+    input_variables_indices = get_input_variables_indices();
+}
+
+}
+
+
+
@@ -0,0 +1,97 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   S E T   V I E W   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef DATASETVIEW_H
+#define DATASETVIEW_H
+
+// System includes
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+#include "tensor.h"
+#include "data_set.h"
+
+namespace OpenNN
+{
+
+/// This class represents a view of a data set with a subset of its input columns.
+
+///
+/// The view has its own columns and instances uses, but it reads the data matrix of the viewed data set instead of copying it.
+/// The input columns of the view are selected with a mask over the input columns of the viewed data set,
+/// so that a model can be trained with a candidate subset of inputs without modifying the viewed data set.
+/// The indices of the input and target variables are calculated when the mask is set, and not for each batch,
+/// so the uses of the columns of a view are to be changed only with the set_inputs_mask method.
+/// Several views of the same data set can be used concurrently, as long as its data is not modified.
+
+class DataSetView : public DataSet
+{
+
+public:
+
+   // Constructors
+
+   explicit DataSetView(const DataSet&);
+
+   // Destructor
+
+   virtual ~DataSetView();
+
+   // Get methods
+
+   const DataSet* get_data_set_pointer() const;
+
+   const Vector<bool>& get_inputs_mask() const;
+
+   const Matrix<double>& get_data() const;
+
+   using DataSet::get_input_data;
+   using DataSet::get_target_data;
+
+   Tensor<double> get_input_data(const Vector<size_t>&) const;
+   Tensor<double> get_target_data(const Vector<size_t>&) const;
+
+   // Set methods
+
+   void set_inputs_mask(const Vector<bool>&);
+
+private:
+
+   /// Pointer to the data set whose data is viewed.
+
+   const DataSet* data_set_pointer = nullptr;
+
+   /// Indices of the input columns of the viewed data set.
+
+   Vector<size_t> original_input_columns_indices;
+
+   /// True for the input columns of the viewed data set which are inputs of the view, and false otherwise.
+
+   Vector<bool> inputs_mask;
+
+   /// Indices of the input variables of the view in the data matrix.
+
+   Vector<size_t> input_variables_indices;
+
+   /// Indices of the target variables of the view in the data matrix.
+
+   Vector<size_t> target_variables_indices;
+};
+
+}
+
+#endif
+
+
+
@@ -0,0 +1,307 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   E V A L U A T I O N   C A C H E   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "evaluation_cache.h"
+
+namespace OpenNN
+{
+
+/// Default constructor.
+/// It creates an empty evaluation cache.
+
+EvaluationCache::EvaluationCache()
+{
+}
+
+
+/// Destructor.
+
+EvaluationCache::~EvaluationCache()
+{
+}
+
+
+/// Results constructor.
+/// @param new_training_error Training error of the model.
+/// @param new_selection_error Selection error of the model.
+/// @param new_parameters Parameters of the model.
+
+EvaluationCache::Evaluation::Evaluation(const double& new_training_error,
+                                        const double& new_selection_error,
+                                        const Vector<double>& new_parameters)
+{
+    training_error = new_training_error;
+    selection_error = new_selection_error;
+    parameters = new_parameters;
+}
+
+
+/// Returns the number of models stored in the cache.
+
+size_t EvaluationCache::get_evaluations_number() const
+{
+    return evaluations.size();
+}
+
+
+/// Returns true if a model with the given inputs has been stored, and false otherwise.
+/// @param inputs Inputs of the model.
+
+bool EvaluationCache::contains(const Vector<bool>& inputs) const
+{
+    return evaluations.count(get_key(inputs)) != 0;
+}
+
+
+/// Returns true if a model with the given number of neurons has been stored, and false otherwise.
+/// @param neurons_number Number of neurons of the model.
+
+bool EvaluationCache::contains(const size_t& neurons_number) const
+{
+    return evaluations.count(get_key(neurons_number)) != 0;
+}
+
+
+/// Returns a pointer to the results of the model with the given inputs, or nullptr if it has not been stored.
+/// @param inputs Inputs of the model.
+
+const EvaluationCache::Evaluation* EvaluationCache::find(const Vector<bool>& inputs) const
+{
+    const auto iterator = evaluations.find(get_key(inputs));
+
+    if(iterator == evaluations.end()) return nullptr;
+
+    return &iterator->second;
+}
+
+
+/// Returns a pointer to the results of the model with the given number of neurons, or nullptr if it has not been stored.
+/// @param neurons_number Number of neurons of the model.
+
+const EvaluationCache::Evaluation* EvaluationCache::find(const size_t& neurons_number) const
+{
+    const auto iterator = evaluations.find(get_key(neurons_number));
+
+    if(iterator == evaluations.end()) return nullptr;
+
+    return &iterator->second;
+}
+
+
+/// Stores the results of the model with the given inputs.
+/// If the model was already stored, its results are replaced.
+/// @param inputs Inputs of the model.
+/// @param evaluation Results of the model.
+
+void EvaluationCache::insert(const Vector<bool>& inputs, const Evaluation& evaluation)
+{
+    evaluations[get_key(inputs)] = evaluation;
+}
+
+
+/// Stores the results of the model with the given number of neurons.
+/// If the model was already stored, its results are replaced.
+/// @param neurons_number Number of neurons of the model.
+/// @param evaluation Results of the model.
+
+void EvaluationCache::insert(const size_t& neurons_number, const Evaluation& evaluation)
+{
+    evaluations[get_key(neurons_number)] = evaluation;
+}
+
+
+/// Removes all the models from the cache.
+
+void EvaluationCache::clear()
+{
+    evaluations.clear();
+}
+
+
+/// Saves the cache to a binary file.
+/// @param file_name Name of the binary file.
+
+void EvaluationCache::save(const string& file_name) const
+{
+    ofstream file(file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: EvaluationCache class.\n"
+               << "void save(const string&) const method.\n"
+               << "Cannot open evaluation cache file: " << file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    write(file);
+
+    file.close();
+}
+
+
+/// Loads the cache from a binary file written by the save method.
+/// The models in the file are added to those already in the cache.
+/// @param file_name Name of the binary file.
+
+void EvaluationCache::load(const string& file_name)
+{
+    ifstream file(file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: EvaluationCache class.\n"
+               << "void load(const string&) method.\n"
+               << "Cannot open evaluation cache file: " << file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    read(file);
+
+    file.close();
+}
+
+
+/// Writes the cache to a binary stream.
+/// It is used by the save method, and by the checkpoints of the model selection algorithms.
+/// @param stream Binary output stream.
+
+void EvaluationCache::write(ostream& stream) const
+{
+    size_t evaluations_number = evaluations.size();
+
+    stream.write(reinterpret_cast<const char*>(&evaluations_number), sizeof(size_t));
+
+    for(const auto& item : evaluations)
+    {
+        const string& key = item.first;
+        const Evaluation& evaluation = item.second;
+
+        const size_t key_size = key.size();
+        const size_t parameters_number = evaluation.parameters.size();
+
+        stream.write(reinterpret_cast<const char*>(&key_size), sizeof(size_t));
+        stream.write(key.data(), static_cast<streamsize>(key_size));
+
+        stream.write(reinterpret_cast<const char*>(&evaluation.training_error), sizeof(double));
+        stream.write(reinterpret_cast<const char*>(&evaluation.selection_error), sizeof(double));
+
+        stream.write(reinterpret_cast<const char*>(&parameters_number), sizeof(size_t));
+        stream.write(reinterpret_cast<const char*>(evaluation.parameters.data()), static_cast<streamsize>(parameters_number*sizeof(double)));
+    }
+}
+
+
+/// Reads the cache from a binary stream written by the write method.
+/// The models in the stream are added to those already in the cache.
+/// @param stream Binary input stream.
+
+void EvaluationCache::read(istream& stream)
+{
+    size_t evaluations_number = 0;
+
+    stream.read(reinterpret_cast<char*>(&evaluations_number), sizeof(size_t));
+
+    for(size_t i = 0; i < evaluations_number; i++)
+    {
+        size_t key_size = 0;
+
+        stream.read(reinterpret_cast<char*>(&key_size), sizeof(size_t));
+
+        if(!stream) break;
+
+        string key(key_size, '\0');
+
+        stream.read(&key[0], static_cast<streamsize>(key_size));
+
+        Evaluation evaluation;
+
+        stream.read(reinterpret_cast<char*>(&evaluation.training_error), sizeof(double));
+        stream.read(reinterpret_cast<char*>(&evaluation.selection_error), sizeof(double));
+
+        size_t parameters_number = 0;
+
+        stream.read(reinterpret_cast<char*>(&parameters_number), sizeof(size_t));
+
+        if(!stream) break;
+
+        evaluation.parameters.set(parameters_number);
+
+        stream.read(reinterpret_cast<char*>(evaluation.parameters.data()), static_cast<streamsize>(parameters_number*sizeof(double)));
+
+        if(!stream) break;
+
+        evaluations[key] = evaluation;
+    }
+
+    if(!stream)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: EvaluationCache class.\n"
+               << "void read(istream&) method.\n"
+               << "Evaluation cache data is truncated.\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Returns the key of a subset of inputs.
+/// It contains the number of inputs followed by the inputs packed into bits.
+/// @param inputs Inputs of the model.
+
+string EvaluationCache::get_key(const Vector<bool>& inputs)
+{
+    const size_t inputs_number = inputs.size();
+
+    string key(sizeof(size_t) + (inputs_number + 7)/8, '\0');
+
+    memcpy(&key[0], &inputs_number, sizeof(size_t));
+
+    for(size_t i = 0; i < inputs_number; i++)
+    {
+        if(inputs[i]) key[sizeof(size_t) + i/8] |= static_cast<char>(1 << (i%8));
+    }
+
+    return key;
+}
+
+
+/// Returns the key of a number of neurons.
+/// @param neurons_number Number of neurons of the model.
+
+string EvaluationCache::get_key(const size_t& neurons_number)
+{
+    return string(reinterpret_cast<const char*>(&neurons_number), sizeof(size_t));
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
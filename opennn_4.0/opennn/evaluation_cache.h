@@ -0,0 +1,133 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   E V A L U A T I O N   C A C H E   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef EVALUATIONCACHE_H
+#define EVALUATIONCACHE_H
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstring>
+#include <unordered_map>
+
+// OpenNN includes
+
+#include "vector.h"
+
+namespace OpenNN
+{
+
+/// This class stores the results of the models already trained by a model selection algorithm.
+
+///
+/// Each model is identified by the subset of inputs or by the number of neurons with which it was trained.
+/// The subsets of inputs are packed into a bitset, which is used as the key of a hash table,
+/// so that a candidate which has already been trained is found in constant time.
+/// The cache can be saved to a binary file and loaded again, so that a search can be resumed without repeating the trainings.
+
+class EvaluationCache
+{
+
+public:
+
+   // Constructors
+
+   explicit EvaluationCache();
+
+   // Destructor
+
+   virtual ~EvaluationCache();
+
+   // Structures
+
+   /// This structure contains the results of the training of a model.
+
+   struct Evaluation
+   {
+       /// Default constructor.
+
+       explicit Evaluation() {}
+
+       explicit Evaluation(const double&, const double&, const Vector<double>&);
+
+       virtual ~Evaluation() {}
+
+       /// Training error of the model.
+
+       double training_error = 0.0;
+
+       /// Selection error of the model.
+
+       double selection_error = 0.0;
+
+       /// Parameters of the model.
+
+       Vector<double> parameters;
+   };
+
+   // Get methods
+
+   size_t get_evaluations_number() const;
+
+   bool contains(const Vector<bool>&) const;
+   bool contains(const size_t&) const;
+
+   const Evaluation* find(const Vector<bool>&) const;
+   const Evaluation* find(const size_t&) const;
+
+   // Set methods
+
+   void insert(const Vector<bool>&, const Evaluation&);
+   void insert(const size_t&, const Evaluation&);
+
+   void clear();
+
+   // Serialization methods
+
+   void save(const string&) const;
+   void load(const string&);
+
+   void write(ostream&) const;
+   void read(istream&);
+
+   // Key methods
+
+   static string get_key(const Vector<bool>&);
+   static string get_key(const size_t&);
+
+private:
+
+   /// Results of the trained models, indexed by their key.
+
+   unordered_map<string, Evaluation> evaluations;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
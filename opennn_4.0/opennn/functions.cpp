@@ -467,6 +467,10 @@ Vector<double> exponential_linear(const Vector<double>& x)
 
 // SOFTMAX
 
+/// Returns the softmax of each row of a tensor of two dimensions.
+/// The maximum of each row is subtracted before taking exponentials, so that large combinations do not overflow.
+/// @param x Tensor of combinations, with instances in rows.
+
 Tensor<double> softmax(const Tensor<double>& x)
 {
     const size_t rows_number = x.get_dimension(0);
@@ -476,16 +480,25 @@ Tensor<double> softmax(const Tensor<double>& x)
 
   for(size_t j = 0; j < rows_number; j++)
   {
+      double maximum = x(j,0);
+
+      for(size_t i = 1; i < columns_number; i++)
+      {
+        if(x(j,i) > maximum) maximum = x(j,i);
+      }
+
       double sum = 0.0;
 
       for(size_t i = 0; i < columns_number; i++)
       {
-        sum += exp(x(j,i));
+        softmax(j,i) = exp(x(j,i) - maximum);
+
+        sum += softmax(j,i);
       }
 
       for(size_t i = 0; i < columns_number; i++)
       {
-        softmax(j,i) = exp(x(j,i)) / sum;
+        softmax(j,i) /= sum;
       }
   }
 
@@ -1046,14 +1059,17 @@ Vector<double> softmax(const Vector<double>& x)
 
     Vector<double> softmax(this_size);
 
+    const double maximum = OpenNN::maximum(x);
+
     double sum = 0;
 
     for(size_t i = 0; i < this_size; i++) {
-        sum += exp(x[i]);
+        softmax[i] = exp(x[i] - maximum);
+        sum += softmax[i];
     }
 
     for(size_t i = 0; i < this_size; i++) {
-        softmax[i] = exp(x[i]) / sum;
+        softmax[i] /= sum;
     }
 
     return softmax;
@@ -1070,21 +1086,21 @@ Tensor<double> softmax_derivatives(const Tensor<double>& x)
 
  Tensor<double> y(dimensions);
 
+ const Tensor<double> softmax_values = softmax(x);
+
  for(size_t i = 0; i < n; i ++)
  {
-     const Vector<double> softmax_values = softmax(x.get_matrix(0).get_row(i));
-
      for(size_t j = 0; j < columns_number; j++)
      {
          for(size_t k = 0; k < columns_number; k++)
          {
              if(j == k)
              {
-                 y(j,k,i) = softmax_values[j]*(1.0 - softmax_values[j]);
+                 y(j,k,i) = softmax_values(i,j)*(1.0 - softmax_values(i,j));
              }
              else
              {
-                 y(j,k,i) = -softmax_values[j] * softmax_values[k];
+                 y(j,k,i) = -softmax_values(i,j) * softmax_values(i,k);
              }
          }
      }
@@ -1252,30 +1268,13 @@ Matrix<double> softmax(const Matrix<double>& matrix)
 
 
 /// Returns a random number chosen from a normal distribution.
+/// It is drawn from the random generator of the current thread.
 /// @param mean Mean value of normal distribution.
 /// @param standard_deviation Standard deviation value of normal distribution.
 
 double random_normal(const double &mean, const double &standard_deviation)
 {
-  const double pi = 4.0 * atan(1.0);
-
-  double random_uniform_1;
-
-  do {
-    random_uniform_1 = static_cast<double>(rand()) /(RAND_MAX + 1.0);
-
-  } while(random_uniform_1 == 0.0);
-
-  const double random_uniform_2 = static_cast<double>(rand()) /(RAND_MAX + 1.0);
-
-  // Box-Muller transformation
-
-  const double random_normal = mean +
-                          sqrt(-2.0 * log(random_uniform_1)) *
-                              sin(2.0 * pi * random_uniform_2) *
-                              standard_deviation;
-
-  return(random_normal);
+  return get_random_generator().calculate_normal(mean, standard_deviation);
 }
 
 
@@ -130,6 +130,14 @@ const size_t& GeneticAlgorithm::get_elitism_size() const
 }
 
 
+/// Returns the number of threads which train the individuals of a generation concurrently.
+
+const size_t& GeneticAlgorithm::get_workers_number() const
+{
+    return workers_number;
+}
+
+
 /// Returns the first point used for the crossover.
 
 const size_t& GeneticAlgorithm::get_crossover_first_point() const
@@ -310,6 +318,10 @@ void GeneticAlgorithm::set_default()
 
     incest_prevention_distance = 0;
 
+    // Parallelization
+
+    workers_number = 1;
+
     // inputs selection results
 
     reserve_generation_mean = true;
@@ -663,6 +675,16 @@ void GeneticAlgorithm::set_elitism_size(const size_t& new_elitism_size)
 }
 
 
+/// Sets the number of threads which train the individuals of a generation concurrently.
+/// Each thread holds a copy of the neural network and the training strategy and a view of the data set.
+/// @param new_workers_number Number of threads. If it is 0 or 1, the individuals are trained in a single thread.
+
+void GeneticAlgorithm::set_workers_number(const size_t& new_workers_number)
+{
+    workers_number = max(new_workers_number, static_cast<size_t>(1));
+}
+
+
 /// Sets the point of for the OnePoint and TwoPoint crossover.
 /// If it is set to 0, the algorithm will select it randomly for each crossover.
 /// @param new_crossover_first_point Point for the OnePoint and first point for TwoPoint crossover.
@@ -866,7 +888,7 @@ void GeneticAlgorithm::initialize_random_population()
 
         for(size_t j = 0; j < inputs_number; j++)
         {
-            random = rand()%2;
+            random = get_random_generator().calculate_index(2);
 
             if(random == 0)
             {
@@ -882,7 +904,7 @@ void GeneticAlgorithm::initialize_random_population()
 
         if(zero_ocurrences == inputs_number)
         {
-            inputs[static_cast<size_t>(rand())%inputs_number] = true;
+            inputs[get_random_generator().calculate_index(inputs_number)] = true;
         }
 
         if(population.contains(inputs) && random_loops <= 5)
@@ -985,7 +1007,7 @@ void GeneticAlgorithm::initialize_weighted_population()
 
         if(zero_ocurrences == inputs_number)
         {
-            inputs[static_cast<size_t>(rand())%inputs_number] = true;
+            inputs[get_random_generator().calculate_index(inputs_number)] = true;
         }
 
         if(population.contains(inputs) && random_loops <= 5)
@@ -1007,6 +1029,8 @@ void GeneticAlgorithm::initialize_weighted_population()
 
 /// Evaluate a population.
 /// Training all the neural networks in the population and calculate their fitness.
+/// The population is always evaluated by evaluate_population_parallel, also with one worker,
+/// so that the random numbers are drawn in the same way whatever the number of workers.
 
 void GeneticAlgorithm::evaluate_population()
 {
@@ -1027,59 +1051,123 @@ void GeneticAlgorithm::evaluate_population()
 
 #endif
 
-    // Loss index stuff
+    evaluate_population_parallel();
+}
 
-    const LossIndex* loss_index_pointer = training_strategy_pointer->get_loss_index_pointer();
 
-    // Data set stuff
+/// Evaluates a population training its individuals concurrently, in workers_number threads.
+/// Each thread trains the individuals on its own replica of the model, so the original data set
+/// and neural network are not modified.
+/// Individuals already trained in previous generations are taken from the evaluation cache.
+/// Each new individual is trained with its own random generator, split in the order of the population,
+/// so that the results do not depend on the number of threads.
 
-    DataSet* data_set_pointer = loss_index_pointer->get_data_set_pointer();
-    
-    Vector<DataSet::VariableUse> current_uses(original_uses);
+void GeneticAlgorithm::evaluate_population_parallel()
+{
+    // Individuals which have not been trained yet
 
-    // Neural network stuff
+    Vector<size_t> new_individuals_indices;
 
-    NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
+    unordered_set<string> new_individuals_keys;
 
-    // Optimization algorithm stuff
-
-    Vector<bool> current_inputs;
+    for(size_t i = 0; i < population_size; i++)
+    {
+        if(evaluation_cache.contains(population[i])) continue;
 
-    size_t index;
+        if(new_individuals_keys.insert(EvaluationCache::get_key(population[i])).second)
+        {
+            new_individuals_indices.push_back(i);
+        }
+    }
 
-    Vector<double> errors(2);
+    const size_t new_individuals_number = new_individuals_indices.size();
 
-    loss.set(population_size,2);
+    vector<RandomGenerator> new_individuals_generators;
 
-    for(size_t i = 0; i < population_size; i++)
+    for(size_t i = 0; i < new_individuals_number; i++)
     {
-        current_inputs = population[i];
+        new_individuals_generators.push_back(get_random_generator().split(i));
+    }
 
-        for(size_t j = 0; j < current_inputs.size(); j++)
-        {
-            index = get_input_index(original_uses,j);
+    // Training
 
-            if(current_inputs[j] == false)
+    Vector<Vector<double>> new_individuals_losses(new_individuals_number);
+    Vector<Vector<double>> new_individuals_parameters(new_individuals_number);
+
+    const size_t threads_number = min(workers_number, new_individuals_number);
+
+    atomic<size_t> next_individual(0);
+
+    vector<exception_ptr> workers_exceptions(threads_number);
+
+    vector<thread> workers;
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers.push_back(thread([&, i]()
+        {
+            try
             {
-                current_uses[index] = DataSet::UnusedVariable;
+                ModelReplica replica(*training_strategy_pointer);
+
+                for(size_t j = next_individual++; j < new_individuals_number; j = next_individual++)
+                {
+                    ScopedRandomGenerator individual_generator(new_individuals_generators[j]);
+
+                    new_individuals_losses[j] = calculate_replica_losses(population[new_individuals_indices[j]],
+                                                                         replica,
+                                                                         new_individuals_parameters[j]);
+                }
             }
-            else
+            catch(...)
             {
-                current_uses[index] = DataSet::Input;
+                workers_exceptions[i] = current_exception();
             }
-        }
+        }));
+    }
 
-        data_set_pointer->set_columns_uses(current_uses);
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers[i].join();
+    }
 
-//        data_set_pointer->set_variables_uses(current_uses);
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        if(workers_exceptions[i]) rethrow_exception(workers_exceptions[i]);
+    }
+
+    // History
+
+    for(size_t i = 0; i < new_individuals_number; i++)
+    {
+        inputs_history.push_back(population[new_individuals_indices[i]]);
+
+        training_error_history.push_back(new_individuals_losses[i][0]);
+
+        selection_error_history.push_back(new_individuals_losses[i][1]);
+
+        parameters_history.push_back(new_individuals_parameters[i]);
+
+        evaluation_cache.insert(population[new_individuals_indices[i]],
+                                EvaluationCache::Evaluation(new_individuals_losses[i][0], new_individuals_losses[i][1], new_individuals_parameters[i]));
+
+        if(display)
+        {
+            cout << "Training loss: " << new_individuals_losses[i][0] << endl;
+            cout << "Selection error: " << new_individuals_losses[i][1] << endl << endl;
+        }
+    }
 
-        neural_network_pointer->set_inputs_number(current_inputs.count_equal_to(true));
+    // Losses
 
-        // Training Neural networks
+    loss.set(population_size,2);
 
-        errors = calculate_losses(population[i]);
+    for(size_t i = 0; i < population_size; i++)
+    {
+        const EvaluationCache::Evaluation* evaluation = evaluation_cache.find(population[i]);
 
-        loss.set_row(i, errors);
+        loss(i,0) = evaluation->training_error;
+        loss(i,1) = evaluation->selection_error;
     }
 
     calculate_fitness();
@@ -1177,7 +1265,7 @@ void GeneticAlgorithm::evolve_population()
 
         if(zero_ocurrences == population[i].size())
         {
-            population[i][static_cast<size_t>(rand())%population[i].size()] = true;
+            population[i][get_random_generator().calculate_index(population[i].size())] = true;
         }
     }
 }
@@ -1366,16 +1454,16 @@ void GeneticAlgorithm::perform_1point_crossover()
 
     while(new_population.size() < population_size)
     {
-        parent1_index = static_cast<size_t>(rand())%selected_population;
+        parent1_index = get_random_generator().calculate_index(selected_population);
 
-        parent2_index = static_cast<size_t>(rand())%selected_population;
+        parent2_index = get_random_generator().calculate_index(selected_population);
 
         random_loops = 0;
 
         while(euclidean_distance(population[parent1_index].to_double_vector(), population[parent2_index].to_double_vector())
               <= incest_prevention_distance)
         {
-            parent2_index = static_cast<size_t>(rand())%selected_population;
+            parent2_index = get_random_generator().calculate_index(selected_population);
 
             random_loops++;
 
@@ -1396,7 +1484,7 @@ void GeneticAlgorithm::perform_1point_crossover()
 
         if(crossover_first_point == 0)
         {
-            first_point = 1 + static_cast<size_t>(rand())%(inputs_number-1);
+            first_point = 1 + get_random_generator().calculate_index(inputs_number-1);
         }
 
         for(size_t i = 0; i < inputs_number; i++)
@@ -1451,14 +1539,14 @@ void GeneticAlgorithm::perform_2point_crossover()
 
     while(new_population.size() < population_size)
     {
-        parent1_index = static_cast<size_t>(rand())%selected_population;
-        parent2_index = static_cast<size_t>(rand())%selected_population;
+        parent1_index = get_random_generator().calculate_index(selected_population);
+        parent2_index = get_random_generator().calculate_index(selected_population);
 
         random_loops = 0;
 
         while(euclidean_distance(population[parent1_index].to_double_vector(), population[parent2_index].to_double_vector()) <= incest_prevention_distance)
         {
-            parent2_index = static_cast<size_t>(rand())%selected_population;
+            parent2_index = get_random_generator().calculate_index(selected_population);
             random_loops++;
 
             if(random_loops == 5 && parent1_index != selected_population-1)
@@ -1478,12 +1566,12 @@ void GeneticAlgorithm::perform_2point_crossover()
 
         if(crossover_first_point == 0)
         {
-            first_point = 1 + static_cast<size_t>(rand())%(inputs_number-2);
+            first_point = 1 + get_random_generator().calculate_index(inputs_number-2);
         }
 
         if(crossover_second_point == 0)
         {
-            second_point = first_point + static_cast<size_t>(rand())%(inputs_number-1-first_point);
+            second_point = first_point + get_random_generator().calculate_index(inputs_number-1-first_point);
         }
 
         for(size_t i = 0; i < inputs_number; i++)
@@ -1540,15 +1628,15 @@ void GeneticAlgorithm::perform_uniform_crossover()
 
     while(new_population.size() < population_size)
     {
-        parent1_index = static_cast<size_t>(rand())%selected_population;
-        parent2_index = static_cast<size_t>(rand())%selected_population;
+        parent1_index = get_random_generator().calculate_index(selected_population);
+        parent2_index = get_random_generator().calculate_index(selected_population);
 
         random_loops = 0;
 
         while(euclidean_distance(population[parent1_index].to_double_vector(), population[parent2_index].to_double_vector())
               <= incest_prevention_distance)
         {
-            parent2_index = static_cast<size_t>(rand())%selected_population;
+            parent2_index = get_random_generator().calculate_index(selected_population);
             random_loops++;
 
             if(random_loops == 5 && parent1_index != selected_population-1)
@@ -1727,6 +1815,8 @@ GeneticAlgorithm::GeneticAlgorithmResults* GeneticAlgorithm::perform_inputs_sele
     time_t beginning_time, current_time;
     double elapsed_time = 0.0;
 
+    if(pre_screening) perform_pre_screening();
+
     original_uses = data_set_pointer->get_columns_uses();
 
     current_uses = original_uses;
@@ -1737,9 +1827,42 @@ GeneticAlgorithm::GeneticAlgorithmResults* GeneticAlgorithm::perform_inputs_sele
 
     time(&beginning_time);
 
-    initialize_population();
+    // Checkpoint
+
+    Checkpoint checkpoint;
+
+    size_t first_epoch = 0;
+
+    if(load_checkpoint(checkpoint))
+    {
+        first_epoch = checkpoint.get_size_t("Epoch");
+
+        population = checkpoint.get_bool_vectors("Population");
+
+        loss.set(population.size(), 2);
+        loss.set_column(0, checkpoint.get_vector("PopulationTrainingErrors"));
+        loss.set_column(1, checkpoint.get_vector("PopulationSelectionErrors"));
 
-    for(size_t epoch = 0; epoch < maximum_epochs_number; epoch++)
+        fitness = checkpoint.get_vector("Fitness");
+
+        optimal_inputs = checkpoint.get_bool_vector("OptimalInputs");
+        optimum_training_error = checkpoint.get_double("OptimumTrainingError");
+        optimum_selection_error = checkpoint.get_double("OptimumSelectionError");
+        optimal_generation = checkpoint.get_size_t("OptimalGeneration");
+
+        results->generation_mean_history = checkpoint.get_vector("GenerationMeanHistory");
+        results->generation_standard_deviation_history = checkpoint.get_vector("GenerationStandardDeviationHistory");
+        results->generation_minimum_selection_history = checkpoint.get_vector("GenerationMinimumSelectionHistory");
+        results->generation_optimum_loss_history = checkpoint.get_vector("GenerationOptimumLossHistory");
+
+        beginning_time -= static_cast<time_t>(checkpoint.get_double("ElapsedTime"));
+    }
+    else
+    {
+        initialize_population();
+    }
+
+    for(size_t epoch = first_epoch; epoch < maximum_epochs_number; epoch++)
     {
         if(epoch != 0)
         {
@@ -1862,9 +1985,39 @@ GeneticAlgorithm::GeneticAlgorithmResults* GeneticAlgorithm::perform_inputs_sele
             cout << endl;
         }
 
+        // The next generation is trained on the original inputs of the data set
+
+        data_set_pointer->set_columns_uses(original_uses);
+
         if(end_algortihm == true) break;
+
+        if(is_checkpoint_iteration(epoch))
+        {
+            checkpoint.set_size_t("Epoch", epoch+1);
+
+            checkpoint.set_bool_vectors("Population", population);
+            checkpoint.set_vector("PopulationTrainingErrors", loss.get_column(0));
+            checkpoint.set_vector("PopulationSelectionErrors", loss.get_column(1));
+            checkpoint.set_vector("Fitness", fitness);
+
+            checkpoint.set_bool_vector("OptimalInputs", optimal_inputs);
+            checkpoint.set_double("OptimumTrainingError", optimum_training_error);
+            checkpoint.set_double("OptimumSelectionError", optimum_selection_error);
+            checkpoint.set_size_t("OptimalGeneration", optimal_generation);
+
+            checkpoint.set_vector("GenerationMeanHistory", results->generation_mean_history);
+            checkpoint.set_vector("GenerationStandardDeviationHistory", results->generation_standard_deviation_history);
+            checkpoint.set_vector("GenerationMinimumSelectionHistory", results->generation_minimum_selection_history);
+            checkpoint.set_vector("GenerationOptimumLossHistory", results->generation_optimum_loss_history);
+
+            checkpoint.set_double("ElapsedTime", elapsed_time);
+
+            save_checkpoint(checkpoint);
+        }
     }
 
+    remove_checkpoint();
+
     // Save results
 
     results->inputs_data.set(inputs_history);
@@ -2199,6 +2352,15 @@ Matrix<string> GeneticAlgorithm::to_string_matrix() const
 
    values.push_back(buffer.str());
 
+   // Workers number
+
+   labels.push_back("Workers number");
+
+   buffer.str("");
+   buffer << workers_number;
+
+   values.push_back(buffer.str());
+
    // Crossover first point
 
    labels.push_back("Crossover first point");
@@ -2447,6 +2609,87 @@ tinyxml2::XMLDocument* GeneticAlgorithm::to_XML() const
         element->LinkEndChild(text);
     }
 
+    // Workers number
+    {
+        element = document->NewElement("WorkersNumber");
+        root_element->LinkEndChild(element);
+
+        buffer.str("");
+        buffer << workers_number;
+
+        text = document->NewText(buffer.str().c_str());
+        element->LinkEndChild(text);
+    }
+
+    // Checkpoint file name
+    {
+        element = document->NewElement("CheckpointFileName");
+        root_element->LinkEndChild(element);
+
+        text = document->NewText(checkpoint_file_name.c_str());
+        element->LinkEndChild(text);
+    }
+
+    // Checkpoint period
+    {
+        element = document->NewElement("CheckpointPeriod");
+        root_element->LinkEndChild(element);
+
+        buffer.str("");
+        buffer << checkpoint_period;
+
+        text = document->NewText(buffer.str().c_str());
+        element->LinkEndChild(text);
+    }
+
+    // Resume from checkpoint
+    {
+        element = document->NewElement("ResumeFromCheckpoint");
+        root_element->LinkEndChild(element);
+
+        buffer.str("");
+        buffer << resume_from_checkpoint;
+
+        text = document->NewText(buffer.str().c_str());
+        element->LinkEndChild(text);
+    }
+
+    // Pre-screening
+    {
+        element = document->NewElement("PreScreening");
+        root_element->LinkEndChild(element);
+
+        buffer.str("");
+        buffer << pre_screening;
+
+        text = document->NewText(buffer.str().c_str());
+        element->LinkEndChild(text);
+    }
+
+    // Pre-screening inputs number
+    {
+        element = document->NewElement("PreScreeningInputsNumber");
+        root_element->LinkEndChild(element);
+
+        buffer.str("");
+        buffer << pre_screening_inputs_number;
+
+        text = document->NewText(buffer.str().c_str());
+        element->LinkEndChild(text);
+    }
+
+    // Pre-screening maximum redundancy
+    {
+        element = document->NewElement("PreScreeningMaximumRedundancy");
+        root_element->LinkEndChild(element);
+
+        buffer.str("");
+        buffer << pre_screening_maximum_redundancy;
+
+        text = document->NewText(buffer.str().c_str());
+        element->LinkEndChild(text);
+    }
+
     // Crossover first point
     {
         element = document->NewElement("CrossoverFirstPoint");
@@ -2745,6 +2988,80 @@ void GeneticAlgorithm::write_XML(tinyxml2::XMLPrinter& file_stream) const
 
     file_stream.CloseElement();
 
+    // Workers number
+
+    file_stream.OpenElement("WorkersNumber");
+
+    buffer.str("");
+    buffer << workers_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Checkpoint file name
+
+    file_stream.OpenElement("CheckpointFileName");
+
+    file_stream.PushText(checkpoint_file_name.c_str());
+
+    file_stream.CloseElement();
+
+    // Checkpoint period
+
+    file_stream.OpenElement("CheckpointPeriod");
+
+    buffer.str("");
+    buffer << checkpoint_period;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Resume from checkpoint
+
+    file_stream.OpenElement("ResumeFromCheckpoint");
+
+    buffer.str("");
+    buffer << resume_from_checkpoint;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Pre-screening
+
+    file_stream.OpenElement("PreScreening");
+
+    buffer.str("");
+    buffer << pre_screening;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Pre-screening inputs number
+
+    file_stream.OpenElement("PreScreeningInputsNumber");
+
+    buffer.str("");
+    buffer << pre_screening_inputs_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Pre-screening maximum redundancy
+
+    file_stream.OpenElement("PreScreeningMaximumRedundancy");
+
+    buffer.str("");
+    buffer << pre_screening_maximum_redundancy;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Crossover first point
 
     file_stream.OpenElement("CrossoverFirstPoint");
@@ -3060,6 +3377,139 @@ void GeneticAlgorithm::from_XML(const tinyxml2::XMLDocument& document)
         }
     }
 
+    // Workers number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WorkersNumber");
+
+        if(element)
+        {
+            const size_t new_workers_number = static_cast<size_t>(atoi(element->GetText()));
+
+            try
+            {
+                set_workers_number(new_workers_number);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Checkpoint file name
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("CheckpointFileName");
+
+        if(element)
+        {
+            const string new_checkpoint_file_name = element->GetText() ? element->GetText() : "";
+
+            try
+            {
+                set_checkpoint_file_name(new_checkpoint_file_name);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Checkpoint period
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("CheckpointPeriod");
+
+        if(element)
+        {
+            const size_t new_checkpoint_period = static_cast<size_t>(atoi(element->GetText()));
+
+            try
+            {
+                set_checkpoint_period(new_checkpoint_period);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Resume from checkpoint
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("ResumeFromCheckpoint");
+
+        if(element)
+        {
+            const string new_resume_from_checkpoint = element->GetText();
+
+            try
+            {
+                set_resume_from_checkpoint(new_resume_from_checkpoint != "0");
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Pre-screening
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("PreScreening");
+
+        if(element)
+        {
+            const string new_pre_screening = element->GetText();
+
+            try
+            {
+                set_pre_screening(new_pre_screening != "0");
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Pre-screening inputs number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("PreScreeningInputsNumber");
+
+        if(element)
+        {
+            const size_t new_pre_screening_inputs_number = static_cast<size_t>(atoi(element->GetText()));
+
+            try
+            {
+                set_pre_screening_inputs_number(new_pre_screening_inputs_number);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Pre-screening maximum redundancy
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("PreScreeningMaximumRedundancy");
+
+        if(element)
+        {
+            const double new_pre_screening_maximum_redundancy = atof(element->GetText());
+
+            try
+            {
+                set_pre_screening_maximum_redundancy(new_pre_screening_maximum_redundancy);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
     // Crossover first point
     {
         const tinyxml2::XMLElement* element = root_element->FirstChildElement("CrossoverFirstPoint");
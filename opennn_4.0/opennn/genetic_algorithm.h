@@ -18,6 +18,10 @@
 #include <limits>
 #include <cmath>
 #include <ctime>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <unordered_set>
 
 // OpenNN includes
 
@@ -128,6 +132,8 @@ public:
 
     const size_t& get_elitism_size() const;
 
+    const size_t& get_workers_number() const;
+
     const size_t& get_crossover_first_point() const;
 
     const size_t& get_crossover_second_point() const;
@@ -174,6 +180,8 @@ public:
 
     void set_elitism_size(const size_t&);
 
+    void set_workers_number(const size_t&);
+
     void set_crossover_first_point(const size_t&);
 
     void set_crossover_second_point(const size_t&);
@@ -201,6 +209,7 @@ public:
     void initialize_weighted_population();
 
     void evaluate_population();
+    void evaluate_population_parallel();
 
     void calculate_fitness();
 
@@ -317,6 +326,14 @@ private:
 
     double selective_pressure;
 
+    // Parallelization
+
+    /// Number of threads which train the individuals of a generation concurrently.
+    /// Each of them works on its own copy of the data set, the neural network and the training strategy.
+    /// If it is 1, the individuals are trained sequentially on the original objects.
+
+    size_t workers_number;
+
     // Inputs selection results
 
     /// True if the mean of selection error are to be reserved in each generation.
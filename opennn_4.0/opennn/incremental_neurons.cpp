@@ -162,6 +162,19 @@ IncrementalNeurons::IncrementalNeuronsResults* IncrementalNeurons::perform_neuro
 
     const Vector<Layer*> trainable_layers_pointers = neural_network->get_trainable_layers_pointers();
 
+    // Warm-started candidates are fine-tuned with a copy of the training strategy with a shorter budget
+
+    DataSet* data_set_pointer = training_strategy_pointer->get_loss_index_pointer()->get_data_set_pointer();
+
+    TrainingStrategy fine_tuning_strategy(neural_network, data_set_pointer);
+
+    if(warm_start)
+    {
+        fine_tuning_strategy.set_methods(*training_strategy_pointer);
+
+        fine_tuning_strategy.set_maximum_epochs_number(warm_start_epochs_number);
+    }
+
     // Loss index stuff
 
     double prev_selection_error = numeric_limits<double>::max();
@@ -191,14 +204,98 @@ IncrementalNeurons::IncrementalNeuronsResults* IncrementalNeurons::perform_neuro
 
     time(&beginning_time);
 
+    // Successive halving
+
+    if(successive_halving)
+    {
+        Vector<size_t> candidates_neurons_numbers;
+
+        for(size_t candidate_neurons_number = minimum_order; candidate_neurons_number <= maximum_order; candidate_neurons_number += step)
+        {
+            candidates_neurons_numbers.push_back(candidate_neurons_number);
+        }
+
+        Matrix<double> candidates_losses;
+        Vector<Vector<double>> candidates_parameters;
+
+        const size_t optimal_candidate_index = perform_successive_halving(candidates_neurons_numbers, candidates_losses, candidates_parameters);
+
+        optimal_neurons_number = candidates_neurons_numbers[optimal_candidate_index];
+        optimum_training_loss = candidates_losses(optimal_candidate_index,0);
+        optimum_selection_error = candidates_losses(optimal_candidate_index,1);
+        optimal_parameters = candidates_parameters[optimal_candidate_index];
+
+        results->neurons_data = candidates_neurons_numbers;
+
+        if(reserve_error_data) results->training_loss_data = candidates_losses.get_column(0);
+
+        if(reserve_selection_error_data) results->selection_error_data = candidates_losses.get_column(1);
+
+        iterations = candidates_neurons_numbers.size();
+
+        time(&current_time);
+
+        elapsed_time = difftime(current_time, beginning_time);
+
+        results->stopping_condition = IncrementalNeurons::AlgorithmFinished;
+
+        end = true;
+    }
+
+    // Checkpoint
+
+    Checkpoint checkpoint;
+
+    if(!end && load_checkpoint(checkpoint))
+    {
+        iterations = checkpoint.get_size_t("Iterations");
+        neurons_number = checkpoint.get_size_t("NeuronsNumber");
+
+        current_parameters = checkpoint.get_vector("CurrentParameters");
+
+        optimal_neurons_number = checkpoint.get_size_t("OptimalNeuronsNumber");
+        optimal_parameters = checkpoint.get_vector("OptimalParameters");
+        optimum_training_loss = checkpoint.get_double("OptimumTrainingLoss");
+        optimum_selection_error = checkpoint.get_double("OptimumSelectionError");
+
+        prev_selection_error = checkpoint.get_double("PreviousSelectionError");
+        selection_failures = checkpoint.get_size_t("SelectionFailures");
+
+        results->neurons_data = checkpoint.get_indices("NeuronsData");
+        results->training_loss_data = checkpoint.get_vector("TrainingLossData");
+        results->selection_error_data = checkpoint.get_vector("SelectionErrorData");
+
+        beginning_time -= static_cast<time_t>(checkpoint.get_double("ElapsedTime"));
+
+        // The neural network is left as it was after training the last candidate
+
+        trainable_layers_pointers[trainable_layers_number-2]->set_neurons_number(neurons_number-1);
+        trainable_layers_pointers[trainable_layers_number-1]->set_inputs_number(neurons_number-1);
+
+        neural_network->set_parameters(current_parameters);
+    }
+
     // Main loop
 
-    for(size_t i = 0; i < maximum_order; i++)
+    for(size_t i = iterations; i < maximum_order && !end; i++)
     {
         // Calculate losses
 
-        trainable_layers_pointers[trainable_layers_number-2]->set_neurons_number(neurons_number); // Fix
-        trainable_layers_pointers[trainable_layers_number-1]->set_inputs_number(neurons_number); // Fix
+        const bool warm_started = warm_start && iterations > 0;
+
+        if(warm_started)
+        {
+            // Start from the previous candidate, with fresh weights only for the added neuron
+
+            neural_network->set_parameters(current_parameters);
+
+            neural_network->warm_start_neurons(trainable_layers_number-2, neurons_number);
+        }
+        else
+        {
+            trainable_layers_pointers[trainable_layers_number-2]->set_neurons_number(neurons_number); // Fix
+            trainable_layers_pointers[trainable_layers_number-1]->set_inputs_number(neurons_number); // Fix
+        }
 
         // Loss index stuff
 
@@ -206,11 +303,13 @@ IncrementalNeurons::IncrementalNeuronsResults* IncrementalNeurons::perform_neuro
         double optimum_training_error_trial = numeric_limits<double>::max();
         Vector<double> optimum_parameters_trial;
 
-        for(size_t i = 0; i < trials_number; i++)
-        {
-            neural_network->randomize_parameters_normal();
+        const Vector<OptimizationAlgorithm::Results> trials_results = warm_started
+                ? Vector<OptimizationAlgorithm::Results>(1, fine_tuning_strategy.perform_training())
+                : perform_trials(*neural_network);
 
-            const OptimizationAlgorithm::Results optimization_algorithm_results = training_strategy_pointer->perform_training();
+        for(size_t i = 0; i < trials_results.size(); i++)
+        {
+            const OptimizationAlgorithm::Results& optimization_algorithm_results = trials_results[i];
 
             const double current_training_error_trial = optimization_algorithm_results.final_training_error;
             const double current_selection_error_trial = optimization_algorithm_results.final_selection_error;
@@ -324,8 +423,34 @@ IncrementalNeurons::IncrementalNeuronsResults* IncrementalNeurons::perform_neuro
         if(end) break;
 
         neurons_number++;
+
+        if(is_checkpoint_iteration(i))
+        {
+            checkpoint.set_size_t("Iterations", iterations);
+            checkpoint.set_size_t("NeuronsNumber", neurons_number);
+
+            checkpoint.set_vector("CurrentParameters", current_parameters);
+
+            checkpoint.set_size_t("OptimalNeuronsNumber", optimal_neurons_number);
+            checkpoint.set_vector("OptimalParameters", optimal_parameters);
+            checkpoint.set_double("OptimumTrainingLoss", optimum_training_loss);
+            checkpoint.set_double("OptimumSelectionError", optimum_selection_error);
+
+            checkpoint.set_double("PreviousSelectionError", prev_selection_error);
+            checkpoint.set_size_t("SelectionFailures", selection_failures);
+
+            checkpoint.set_indices("NeuronsData", results->neurons_data);
+            checkpoint.set_vector("TrainingLossData", results->training_loss_data);
+            checkpoint.set_vector("SelectionErrorData", results->selection_error_data);
+
+            checkpoint.set_double("ElapsedTime", elapsed_time);
+
+            save_checkpoint(checkpoint);
+        }
     }
 
+    remove_checkpoint();
+
     if(display)
     {
         cout << endl
@@ -563,6 +688,99 @@ tinyxml2::XMLDocument* IncrementalNeurons::to_XML() const
    element->LinkEndChild(text);
    }
 
+   // Warm start
+   {
+   element = document->NewElement("WarmStart");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << warm_start;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Warm start epochs number
+   {
+   element = document->NewElement("WarmStartEpochsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << warm_start_epochs_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Successive halving
+   {
+   element = document->NewElement("SuccessiveHalving");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << successive_halving;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Successive halving epochs number
+   {
+   element = document->NewElement("SuccessiveHalvingEpochsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << successive_halving_epochs_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Trials workers number
+   {
+   element = document->NewElement("TrialsWorkersNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << trials_workers_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Checkpoint file name
+   {
+   element = document->NewElement("CheckpointFileName");
+   root_element->LinkEndChild(element);
+
+   text = document->NewText(checkpoint_file_name.c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Checkpoint period
+   {
+   element = document->NewElement("CheckpointPeriod");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << checkpoint_period;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Resume from checkpoint
+   {
+   element = document->NewElement("ResumeFromCheckpoint");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << resume_from_checkpoint;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
    // Reserve minimal parameters
 //   {
 //   element = document->NewElement("ReserveMinimalParameters");
@@ -728,6 +946,91 @@ void IncrementalNeurons::write_XML(tinyxml2::XMLPrinter& file_stream) const
 
     file_stream.CloseElement();
 
+    // Warm start
+
+    file_stream.OpenElement("WarmStart");
+
+    buffer.str("");
+    buffer << warm_start;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Warm start epochs number
+
+    file_stream.OpenElement("WarmStartEpochsNumber");
+
+    buffer.str("");
+    buffer << warm_start_epochs_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Successive halving
+
+    file_stream.OpenElement("SuccessiveHalving");
+
+    buffer.str("");
+    buffer << successive_halving;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Successive halving epochs number
+
+    file_stream.OpenElement("SuccessiveHalvingEpochsNumber");
+
+    buffer.str("");
+    buffer << successive_halving_epochs_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Trials workers number
+
+    file_stream.OpenElement("TrialsWorkersNumber");
+
+    buffer.str("");
+    buffer << trials_workers_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Checkpoint file name
+
+    file_stream.OpenElement("CheckpointFileName");
+
+    file_stream.PushText(checkpoint_file_name.c_str());
+
+    file_stream.CloseElement();
+
+    // Checkpoint period
+
+    file_stream.OpenElement("CheckpointPeriod");
+
+    buffer.str("");
+    buffer << checkpoint_period;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Resume from checkpoint
+
+    file_stream.OpenElement("ResumeFromCheckpoint");
+
+    buffer.str("");
+    buffer << resume_from_checkpoint;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Tolerance
 
     file_stream.OpenElement("Tolerance");
@@ -893,6 +1196,158 @@ void IncrementalNeurons::from_XML(const tinyxml2::XMLDocument& document)
         }
     }
 
+    // Warm start
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarmStart");
+
+        if(element)
+        {
+           const string new_warm_start = element->GetText();
+
+           try
+           {
+              set_warm_start(new_warm_start != "0");
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Warm start epochs number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarmStartEpochsNumber");
+
+        if(element)
+        {
+           const size_t new_warm_start_epochs_number = static_cast<size_t>(atoi(element->GetText()));
+
+           try
+           {
+              set_warm_start_epochs_number(new_warm_start_epochs_number);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Successive halving
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("SuccessiveHalving");
+
+        if(element)
+        {
+           const string new_successive_halving = element->GetText();
+
+           try
+           {
+              set_successive_halving(new_successive_halving != "0");
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Successive halving epochs number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("SuccessiveHalvingEpochsNumber");
+
+        if(element)
+        {
+           const size_t new_successive_halving_epochs_number = static_cast<size_t>(atoi(element->GetText()));
+
+           try
+           {
+              set_successive_halving_epochs_number(new_successive_halving_epochs_number);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Trials workers number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("TrialsWorkersNumber");
+
+        if(element)
+        {
+           const size_t new_trials_workers_number = static_cast<size_t>(atoi(element->GetText()));
+
+           try
+           {
+              set_trials_workers_number(new_trials_workers_number);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Checkpoint file name
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("CheckpointFileName");
+
+        if(element)
+        {
+            const string new_checkpoint_file_name = element->GetText() ? element->GetText() : "";
+
+            try
+            {
+                set_checkpoint_file_name(new_checkpoint_file_name);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Checkpoint period
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("CheckpointPeriod");
+
+        if(element)
+        {
+            const size_t new_checkpoint_period = static_cast<size_t>(atoi(element->GetText()));
+
+            try
+            {
+                set_checkpoint_period(new_checkpoint_period);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Resume from checkpoint
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("ResumeFromCheckpoint");
+
+        if(element)
+        {
+            const string new_resume_from_checkpoint = element->GetText();
+
+            try
+            {
+                set_resume_from_checkpoint(new_resume_from_checkpoint != "0");
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
     // Performance calculation method
     {
         const tinyxml2::XMLElement* element = root_element->FirstChildElement("LossCalculationMethod");
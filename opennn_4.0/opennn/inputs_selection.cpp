@@ -84,6 +84,23 @@ TrainingStrategy* InputsSelection::get_training_strategy_pointer() const
 }
 
 
+/// Returns a constant reference to the cache with the results of the neural networks already trained.
+
+const EvaluationCache& InputsSelection::get_evaluation_cache() const
+{
+    return evaluation_cache;
+}
+
+
+/// Returns a pointer to the cache with the results of the neural networks already trained.
+/// It can be used to load the results of a previous search before performing the inputs selection.
+
+EvaluationCache* InputsSelection::get_evaluation_cache_pointer()
+{
+    return &evaluation_cache;
+}
+
+
 /// Returns true if this inputs selection algorithm has a training strategy associated, and false otherwise.
 
 bool InputsSelection::has_training_strategy() const
@@ -107,6 +124,94 @@ const size_t& InputsSelection::get_trials_number() const
 }
 
 
+/// Returns true if the candidates are initialized from the parameters of the previous ones, and false otherwise.
+
+const bool& InputsSelection::get_warm_start() const
+{
+    return warm_start;
+}
+
+
+/// Returns the maximum number of epochs for fine-tuning a warm-started candidate.
+
+const size_t& InputsSelection::get_warm_start_epochs_number() const
+{
+    return warm_start_epochs_number;
+}
+
+
+/// Returns true if the candidates are trained by successive halving, and false otherwise.
+
+const bool& InputsSelection::get_successive_halving() const
+{
+    return successive_halving;
+}
+
+
+/// Returns the number of epochs of the first round of successive halving.
+
+const size_t& InputsSelection::get_successive_halving_epochs_number() const
+{
+    return successive_halving_epochs_number;
+}
+
+
+/// Returns the number of threads which train the trials of a candidate concurrently.
+
+const size_t& InputsSelection::get_trials_workers_number() const
+{
+    return trials_workers_number;
+}
+
+
+/// Returns true if the input columns are filtered before the selection, and false otherwise.
+
+const bool& InputsSelection::get_pre_screening() const
+{
+    return pre_screening;
+}
+
+
+/// Returns the maximum number of input columns kept by the pre-screening.
+
+const size_t& InputsSelection::get_pre_screening_inputs_number() const
+{
+    return pre_screening_inputs_number;
+}
+
+
+/// Returns the maximum absolute correlation between two input columns kept by the pre-screening.
+
+const double& InputsSelection::get_pre_screening_maximum_redundancy() const
+{
+    return pre_screening_maximum_redundancy;
+}
+
+
+/// Returns the name of the binary file where the state of the search is saved.
+
+const string& InputsSelection::get_checkpoint_file_name() const
+{
+    return checkpoint_file_name;
+}
+
+
+/// Returns the number of iterations between two checkpoints.
+
+const size_t& InputsSelection::get_checkpoint_period() const
+{
+    return checkpoint_period;
+}
+
+
+/// Returns true if the search starts from the state saved in the checkpoint file, and false otherwise.
+
+const bool& InputsSelection::get_resume_from_checkpoint() const
+{
+    return resume_from_checkpoint;
+}
+
+
 /// Returns true if the loss index losses are to be reserved, and false otherwise.
 
 const bool& InputsSelection::get_reserve_error_data() const
@@ -214,6 +319,22 @@ void InputsSelection::set_default()
 {
     trials_number = 1;
 
+    warm_start = false;
+    warm_start_epochs_number = 100;
+
+    successive_halving = false;
+    successive_halving_epochs_number = 10;
+
+    trials_workers_number = 1;
+
+    pre_screening = false;
+    pre_screening_inputs_number = 100;
+    pre_screening_maximum_redundancy = 0.95;
+
+    checkpoint_file_name = "";
+    checkpoint_period = 1;
+    resume_from_checkpoint = false;
+
     // Results
 
     reserve_error_data = true;
@@ -260,6 +381,197 @@ void InputsSelection::set_trials_number(const size_t& new_trials_number)
 }
 
 
+/// Sets whether the candidates are initialized from the parameters of the previous ones and fine-tuned,
+/// instead of being trained from scratch.
+/// @param new_warm_start True to warm-start the candidates, false otherwise.
+
+void InputsSelection::set_warm_start(const bool& new_warm_start)
+{
+    warm_start = new_warm_start;
+}
+
+
+/// Sets the maximum number of epochs for fine-tuning a warm-started candidate.
+/// @param new_warm_start_epochs_number Maximum number of epochs.
+
+void InputsSelection::set_warm_start_epochs_number(const size_t& new_warm_start_epochs_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_warm_start_epochs_number == 0)
+    {
+        ostringstream buffer;
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "void set_warm_start_epochs_number(const size_t&) method.\n"
+               << "Number of epochs must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    warm_start_epochs_number = new_warm_start_epochs_number;
+}
+
+
+/// Sets whether the candidates are trained by successive halving instead of each one with the full budget.
+/// @param new_successive_halving True to train the candidates by successive halving, false otherwise.
+
+void InputsSelection::set_successive_halving(const bool& new_successive_halving)
+{
+    successive_halving = new_successive_halving;
+}
+
+
+/// Sets the number of epochs of the first round of successive halving.
+/// It is doubled in each of the following rounds.
+/// @param new_successive_halving_epochs_number Number of epochs.
+
+void InputsSelection::set_successive_halving_epochs_number(const size_t& new_successive_halving_epochs_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_successive_halving_epochs_number == 0)
+    {
+        ostringstream buffer;
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "void set_successive_halving_epochs_number(const size_t&) method.\n"
+               << "Number of epochs must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    successive_halving_epochs_number = new_successive_halving_epochs_number;
+}
+
+
+/// Sets the number of threads which train the trials of a candidate concurrently.
+/// The initial parameters of the trials do not depend on this number, only the wall time of the training does.
+/// @param new_trials_workers_number Number of threads. If it is 1, the trials are trained sequentially.
+
+void InputsSelection::set_trials_workers_number(const size_t& new_trials_workers_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_trials_workers_number == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "void set_trials_workers_number(const size_t&) method.\n"
+               << "Number of workers must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    trials_workers_number = new_trials_workers_number;
+}
+
+
+/// Sets whether the input columns are filtered by their relevance and redundancy before the selection.
+/// @param new_pre_screening True to filter the input columns, false otherwise.
+
+void InputsSelection::set_pre_screening(const bool& new_pre_screening)
+{
+    pre_screening = new_pre_screening;
+}
+
+
+/// Sets the maximum number of input columns kept by the pre-screening.
+/// @param new_pre_screening_inputs_number Number of input columns.
+
+void InputsSelection::set_pre_screening_inputs_number(const size_t& new_pre_screening_inputs_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_pre_screening_inputs_number == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "void set_pre_screening_inputs_number(const size_t&) method.\n"
+               << "Number of inputs must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    pre_screening_inputs_number = new_pre_screening_inputs_number;
+}
+
+
+/// Sets the maximum absolute correlation between two input columns kept by the pre-screening.
+/// @param new_pre_screening_maximum_redundancy Correlation value, between 0 and 1. If it is 1, redundant inputs are not discarded.
+
+void InputsSelection::set_pre_screening_maximum_redundancy(const double& new_pre_screening_maximum_redundancy)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_pre_screening_maximum_redundancy < 0 || new_pre_screening_maximum_redundancy > 1)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "void set_pre_screening_maximum_redundancy(const double&) method.\n"
+               << "Maximum redundancy must be comprised between 0 and 1.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    pre_screening_maximum_redundancy = new_pre_screening_maximum_redundancy;
+}
+
+
+/// Sets the name of the binary file where the state of the search is saved periodically.
+/// @param new_checkpoint_file_name Name of the file. If it is empty, no checkpoints are saved.
+
+void InputsSelection::set_checkpoint_file_name(const string& new_checkpoint_file_name)
+{
+    checkpoint_file_name = new_checkpoint_file_name;
+}
+
+
+/// Sets the number of iterations between two checkpoints.
+/// @param new_checkpoint_period Number of iterations.
+
+void InputsSelection::set_checkpoint_period(const size_t& new_checkpoint_period)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_checkpoint_period == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "void set_checkpoint_period(const size_t&) method.\n"
+               << "Checkpoint period must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    checkpoint_period = new_checkpoint_period;
+}
+
+
+/// Sets whether the search starts from the state saved in the checkpoint file.
+/// If the file does not exist, the search starts from the beginning.
+/// @param new_resume_from_checkpoint True to resume the search, false otherwise.
+
+void InputsSelection::set_resume_from_checkpoint(const bool& new_resume_from_checkpoint)
+{
+    resume_from_checkpoint = new_resume_from_checkpoint;
+}
+
+
 /// Sets the reserve flag for the loss data.
 /// @param new_reserve_error_data Flag value.
 
@@ -458,10 +770,6 @@ Vector<double> InputsSelection::calculate_losses(const Vector<bool> & inputs)
 
 #endif
 
-    // Neural network stuff
-
-    NeuralNetwork* neural_network = training_strategy_pointer->get_neural_network_pointer();
-
     // Optimization algorithm stuff
 
     OptimizationAlgorithm::Results results;
@@ -473,31 +781,15 @@ Vector<double> InputsSelection::calculate_losses(const Vector<bool> & inputs)
 
     Vector<double> optimum_losses(2);
 
-    bool flag_loss = false;
-    bool flag_selection = false;
+    // Check cache
 
-    // Check population
+    const EvaluationCache::Evaluation* evaluation = evaluation_cache.find(inputs);
 
-    for(size_t i = 0; i < inputs_history.size(); i++)
+    if(evaluation)
     {
-        if(inputs_history[i] == inputs)
-        {
-            optimum_losses[0] = training_error_history[i];
-            flag_loss = true;
-        }
-    }
+        optimum_losses[0] = evaluation->training_error;
+        optimum_losses[1] = evaluation->selection_error;
 
-    for(size_t i = 0; i < inputs_history.size(); i++)
-    {
-        if(inputs_history[i] == inputs)
-        {
-            optimum_losses[1] = selection_error_history[i];
-            flag_selection = true;
-        }
-    }
-
-    if(flag_loss && flag_selection)
-    {
         if(display)
         {
             cout << "Training loss: " << optimum_losses[0] << endl;
@@ -507,15 +799,11 @@ Vector<double> InputsSelection::calculate_losses(const Vector<bool> & inputs)
         return optimum_losses;
     }
 
-    neural_network->perturbate_parameters(0.001);
-
-    neural_network->set_inputs_number(inputs);
+    const Vector<OptimizationAlgorithm::Results> trials_results = perform_trials(inputs);
 
     for(size_t i = 0; i < trials_number; i++)
     {
-        neural_network->randomize_parameters_normal();
-
-        results = training_strategy_pointer->perform_training();
+        results = trials_results[i];
 
         const double selection_error = results.final_selection_error;
         const double training_error = results.final_training_error;
@@ -552,6 +840,8 @@ Vector<double> InputsSelection::calculate_losses(const Vector<bool> & inputs)
 
     parameters_history.push_back(optimum_parameters);
 
+    evaluation_cache.insert(inputs, EvaluationCache::Evaluation(optimum_training_error, optimum_selection_error, optimum_parameters));
+
     optimum_losses[0] = optimum_training_error;
     optimum_losses[1] = optimum_selection_error;
 
@@ -559,6 +849,393 @@ Vector<double> InputsSelection::calculate_losses(const Vector<bool> & inputs)
 }
 
 
+/// Creates a view of the data set and copies of the neural network and the training strategy of a given training strategy.
+/// The data of the data set is not copied.
+/// The training strategy of the replica uses the same loss and optimization methods as the original one, without display.
+/// @param other_training_strategy Training strategy to be copied.
+
+InputsSelection::ModelReplica::ModelReplica(const TrainingStrategy& other_training_strategy)
+    : data_set(*other_training_strategy.get_loss_index_pointer()->get_data_set_pointer()),
+      neural_network(*other_training_strategy.get_neural_network_pointer()),
+      training_strategy(&neural_network, &data_set)
+{
+    training_strategy.set_methods(other_training_strategy);
+
+    training_strategy.set_display(false);
+}
+
+
+/// Sets the input columns of the data set view, and sizes the neural network to the resulting number of input variables.
+/// The parameters of the neural network are not initialized.
+/// @param inputs_mask Vector of booleans, true for the columns which are inputs.
+
+void InputsSelection::ModelReplica::set_inputs_mask(const Vector<bool>& inputs_mask)
+{
+    data_set.set_inputs_mask(inputs_mask);
+
+    neural_network.set_inputs_number(data_set.get_input_variables_number());
+}
+
+
+/// Trains a model replica with a given set of inputs trials_number times, and returns the training and selection errors
+/// of the trial with the minimum selection error.
+/// Unlike calculate_losses, this method does not modify the original model or the history, and can be called concurrently on different replicas.
+/// @param inputs Vector of the inputs to be trained with.
+/// @param replica Copy of the model to be trained.
+/// @param optimum_parameters Parameters of the trial with the minimum selection error.
+
+Vector<double> InputsSelection::calculate_replica_losses(const Vector<bool>& inputs,
+                                                         ModelReplica& replica,
+                                                         Vector<double>& optimum_parameters) const
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(inputs.count_equal_to(true) <= 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "Vector<double> calculate_replica_losses(const Vector<bool>&, ModelReplica&, Vector<double>&) const method.\n"
+               << "Number of inputs must be greater or equal than 1.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    replica.set_inputs_mask(inputs);
+
+    OptimizationAlgorithm::Results results;
+
+    Vector<double> optimum_losses(2, numeric_limits<double>::max());
+
+    for(size_t i = 0; i < trials_number; i++)
+    {
+        replica.neural_network.randomize_parameters_normal();
+
+        results = replica.training_strategy.perform_training();
+
+        if(optimum_losses[1] > results.final_selection_error)
+        {
+            optimum_losses[0] = results.final_training_error;
+            optimum_losses[1] = results.final_selection_error;
+
+            optimum_parameters = results.final_parameters;
+        }
+    }
+
+    return optimum_losses;
+}
+
+
+/// Trains a set of candidate inputs by successive halving.
+/// In the first round all the candidates are trained for successive_halving_epochs_number epochs.
+/// Then the worse half of them, by selection error, is dropped, and the rest continue training for twice the epochs.
+/// The last candidate left is trained with the full budget of the training strategy.
+/// Candidates are trained on a replica of the model, so the original data set and neural network are not modified.
+/// Returns the index of the best candidate.
+/// @param candidates_inputs Inputs of each candidate.
+/// @param candidates_losses Training and selection errors of each candidate after its last round.
+/// @param candidates_parameters Parameters of each candidate after its last round.
+
+size_t InputsSelection::perform_successive_halving(const Vector<Vector<bool>>& candidates_inputs,
+                                                   Matrix<double>& candidates_losses,
+                                                   Vector<Vector<double>>& candidates_parameters) const
+{
+    const size_t candidates_number = candidates_inputs.size();
+
+#ifdef __OPENNN_DEBUG__
+
+    if(candidates_number == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "size_t perform_successive_halving(const Vector<Vector<bool>>&, Matrix<double>&, Vector<Vector<double>>&) const method.\n"
+               << "Number of candidates must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    ModelReplica replica(*training_strategy_pointer);
+
+    candidates_losses.set(candidates_number, 2, numeric_limits<double>::max());
+    candidates_parameters.set(candidates_number);
+
+    auto train_candidate = [&](const size_t& candidate_index)
+    {
+        replica.set_inputs_mask(candidates_inputs[candidate_index]);
+
+        if(candidates_parameters[candidate_index].empty())
+        {
+            replica.neural_network.randomize_parameters_normal();
+        }
+        else
+        {
+            replica.neural_network.set_parameters(candidates_parameters[candidate_index]);
+        }
+
+        const OptimizationAlgorithm::Results results = replica.training_strategy.perform_training();
+
+        candidates_losses(candidate_index,0) = results.final_training_error;
+        candidates_losses(candidate_index,1) = results.final_selection_error;
+
+        candidates_parameters[candidate_index] = results.final_parameters;
+    };
+
+    Vector<size_t> survivors_indices(0, 1, candidates_number-1);
+
+    size_t epochs_number = successive_halving_epochs_number;
+
+    while(survivors_indices.size() > 1)
+    {
+        replica.training_strategy.set_maximum_epochs_number(epochs_number);
+
+        const size_t survivors_number = survivors_indices.size();
+
+        Vector<double> survivors_selection_errors(survivors_number);
+
+        for(size_t i = 0; i < survivors_number; i++)
+        {
+            train_candidate(survivors_indices[i]);
+
+            survivors_selection_errors[i] = candidates_losses(survivors_indices[i],1);
+        }
+
+        if(display)
+        {
+            cout << "Successive halving round with " << epochs_number << " epochs" << endl;
+            cout << "Candidates: " << survivors_number << endl;
+            cout << "Minimum selection error: " << minimum(survivors_selection_errors) << endl << endl;
+        }
+
+        const Vector<size_t> sorted_indices = survivors_selection_errors.sort_ascending_indices();
+
+        survivors_indices = survivors_indices.get_subvector(sorted_indices.get_first((survivors_number+1)/2));
+
+        epochs_number *= 2;
+    }
+
+    // Full training of the best candidate
+
+    replica.training_strategy.set_methods(*training_strategy_pointer);
+
+    replica.training_strategy.set_display(false);
+
+    train_candidate(survivors_indices[0]);
+
+    return survivors_indices[0];
+}
+
+
+/// Filters the input columns of the data set before the selection, without training any neural network.
+/// The dependence between two columns is the largest of the absolute linear correlation, for single variable columns,
+/// and the information coefficient of correlation of their mutual information, which also captures non linear
+/// and categorical dependencies. Both are cheap compared with the regressions fitted by calculate_input_target_columns_correlations().
+/// The relevance of each input column is the mean of its dependences with the targets.
+/// The columns are then taken in decreasing order of relevance, discarding those whose dependence
+/// with an already kept column is greater than pre_screening_maximum_redundancy,
+/// until pre_screening_inputs_number columns are kept. The rest are set as unused in the data set.
+/// Returns the indices of the columns set as unused.
+
+Vector<size_t> InputsSelection::perform_pre_screening()
+{
+    DataSet* data_set_pointer = training_strategy_pointer->get_loss_index_pointer()->get_data_set_pointer();
+
+    const size_t input_columns_number = data_set_pointer->get_input_columns_number();
+    const size_t target_columns_number = data_set_pointer->get_target_columns_number();
+
+    const Vector<size_t> input_columns_indices = data_set_pointer->get_input_columns_indices();
+    const Vector<size_t> target_columns_indices = data_set_pointer->get_target_columns_indices();
+
+    Vector<Matrix<double>> inputs(input_columns_number);
+
+    for(size_t i = 0; i < input_columns_number; i++)
+    {
+        inputs[i] = data_set_pointer->get_column_data(input_columns_indices[i]);
+    }
+
+    const auto dependence = [](const Matrix<double>& x, const Matrix<double>& y)
+    {
+        double maximum_dependence = mutual_information_correlation(mutual_information_missing_values(x, y));
+
+        if(x.get_columns_number() == 1 && y.get_columns_number() == 1)
+        {
+            const double correlation = linear_correlation_missing_values(x.get_column(0), y.get_column(0));
+
+            if(!::isnan(correlation)) maximum_dependence = max(maximum_dependence, abs(correlation));
+        }
+
+        return maximum_dependence;
+    };
+
+    // Relevance
+
+    Vector<double> relevances(input_columns_number, 0.0);
+
+    for(size_t j = 0; j < target_columns_number; j++)
+    {
+        const Matrix<double> target = data_set_pointer->get_column_data(target_columns_indices[j]);
+
+#pragma omp parallel for
+
+        for(int i = 0; i < static_cast<int>(input_columns_number); i++)
+        {
+            relevances[static_cast<size_t>(i)] += dependence(inputs[static_cast<size_t>(i)], target)/static_cast<double>(target_columns_number);
+        }
+    }
+
+    const Vector<size_t> relevances_descending_indices = relevances.sort_descending_indices();
+
+    // Redundancy
+
+    Vector<size_t> kept_indices;
+
+    for(size_t i = 0; i < input_columns_number && kept_indices.size() < pre_screening_inputs_number; i++)
+    {
+        const size_t index = relevances_descending_indices[i];
+
+        const size_t kept_number = kept_indices.size();
+
+        Vector<double> redundancies(kept_number, 0.0);
+
+        if(pre_screening_maximum_redundancy < 1.0)
+        {
+#pragma omp parallel for
+
+            for(int j = 0; j < static_cast<int>(kept_number); j++)
+            {
+                redundancies[static_cast<size_t>(j)] = dependence(inputs[index], inputs[kept_indices[static_cast<size_t>(j)]]);
+            }
+        }
+
+        if(kept_number == 0 || maximum(redundancies) <= pre_screening_maximum_redundancy)
+        {
+            kept_indices.push_back(index);
+        }
+    }
+
+    Vector<bool> kept_inputs(input_columns_number, false);
+
+    for(size_t i = 0; i < kept_indices.size(); i++)
+    {
+        kept_inputs[kept_indices[i]] = true;
+    }
+
+    Vector<size_t> unused_columns;
+
+    for(size_t i = 0; i < input_columns_number; i++)
+    {
+        if(!kept_inputs[i])
+        {
+            data_set_pointer->set_column_use(input_columns_indices[i], DataSet::UnusedVariable);
+
+            unused_columns.push_back(input_columns_indices[i]);
+        }
+    }
+
+    if(display)
+    {
+        cout << "Pre-screening: " << kept_indices.size() << " of " << input_columns_number << " inputs kept." << endl;
+    }
+
+    return unused_columns;
+}
+
+
+/// Trains a neural network with a given set of inputs trials_number times, each time from different random initial parameters,
+/// and returns the results of all the trials, in order.
+/// The initial parameters and the random generators of the trials are drawn in the order of the trials before any training starts,
+/// so that the results do not depend on the number of threads.
+/// If trials_workers_number is greater than 1, the trials are trained concurrently, each thread on its own replica of the model.
+/// The data set and the neural network are not modified.
+/// @param inputs Vector of the inputs to be trained with.
+
+Vector<OptimizationAlgorithm::Results> InputsSelection::perform_trials(const Vector<bool>& inputs) const
+{
+    ModelReplica replica(*training_strategy_pointer);
+
+    replica.set_inputs_mask(inputs);
+
+    Vector<Vector<double>> trials_initial_parameters(trials_number);
+
+    vector<RandomGenerator> trials_generators;
+
+    for(size_t i = 0; i < trials_number; i++)
+    {
+        replica.neural_network.randomize_parameters_normal();
+
+        trials_initial_parameters[i] = replica.neural_network.get_parameters();
+
+        trials_generators.push_back(get_random_generator().split(i));
+    }
+
+    Vector<OptimizationAlgorithm::Results> trials_results(trials_number);
+
+    const size_t threads_number = min(trials_workers_number, trials_number);
+
+    if(threads_number <= 1)
+    {
+        for(size_t i = 0; i < trials_number; i++)
+        {
+            ScopedRandomGenerator trial_generator(trials_generators[i]);
+
+            replica.neural_network.set_parameters(trials_initial_parameters[i]);
+
+            trials_results[i] = replica.training_strategy.perform_training();
+        }
+
+        return trials_results;
+    }
+
+    atomic<size_t> next_trial(0);
+
+    vector<exception_ptr> workers_exceptions(threads_number);
+
+    vector<thread> workers;
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers.push_back(thread([&, i]()
+        {
+            try
+            {
+                ModelReplica trial_replica(*training_strategy_pointer);
+
+                trial_replica.set_inputs_mask(inputs);
+
+                for(size_t j = next_trial++; j < trials_number; j = next_trial++)
+                {
+                    ScopedRandomGenerator trial_generator(trials_generators[j]);
+
+                    trial_replica.neural_network.set_parameters(trials_initial_parameters[j]);
+
+                    trials_results[j] = trial_replica.training_strategy.perform_training();
+                }
+            }
+            catch(...)
+            {
+                workers_exceptions[i] = current_exception();
+            }
+        }));
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers[i].join();
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        if(workers_exceptions[i]) rethrow_exception(workers_exceptions[i]);
+    }
+
+    return trials_results;
+}
+
+
 /// Returns the mean of the loss and selection error in trials_number trainings.
 /// @param inputs Vector of the inputs to be trained with.
 
@@ -602,29 +1279,13 @@ Vector<double> InputsSelection::perform_mean_model_evaluation(const Vector<bool>
 
     Vector<double> final_parameters;
 
-    bool flag_loss = false;
-    bool flag_selection = false;
+    const EvaluationCache::Evaluation* evaluation = evaluation_cache.find(inputs);
 
-    for(size_t i = 0; i < inputs_history.size(); i++)
+    if(evaluation)
     {
-        if(inputs_history[i] == inputs)
-        {
-            mean_final[0] = training_error_history[i];
-            flag_loss = true;
-        }
-    }
+        mean_final[0] = evaluation->training_error;
+        mean_final[1] = evaluation->selection_error;
 
-    for(size_t i = 0; i < inputs_history.size(); i++)
-    {
-        if(inputs_history[i] == inputs)
-        {
-            mean_final[1] = selection_error_history[i];
-            flag_selection = true;
-        }
-    }
-
-    if(flag_loss && flag_selection)
-    {
         return(mean_final);
     }
 
@@ -664,15 +1325,8 @@ Vector<double> InputsSelection::perform_mean_model_evaluation(const Vector<bool>
 
 //        current_loss = get_final_losses(results);
 
-        if(!flag_loss)
-        {
-            mean_final[0] += current_loss[0]/trials_number;
-        }
-
-        if(!flag_selection)
-        {
-            mean_final[1] += current_loss[1]/trials_number;
-        }
+        mean_final[0] += current_loss[0]/trials_number;
+        mean_final[1] += current_loss[1]/trials_number;
     }
 
     if(display)
@@ -691,6 +1345,8 @@ Vector<double> InputsSelection::perform_mean_model_evaluation(const Vector<bool>
 
     parameters_history.push_back(final_parameters);
 
+    evaluation_cache.insert(inputs, EvaluationCache::Evaluation(mean_final[0], mean_final[1], final_parameters));
+
     return mean_final;
 }
 
@@ -715,22 +1371,96 @@ Vector<double> InputsSelection::get_parameters_inputs(const Vector<bool>& inputs
 
 #endif
 
-    size_t i;
+    const EvaluationCache::Evaluation* evaluation = evaluation_cache.find(inputs);
+
+    if(evaluation)
+    {
+        return evaluation->parameters;
+    }
+
+    return Vector<double>();
+}
+
 
-    Vector<double> parameters;
+/// Returns true if the state of the search is to be saved after the given iteration, and false otherwise.
+/// @param iteration Index of the iteration.
+
+bool InputsSelection::is_checkpoint_iteration(const size_t& iteration) const
+{
+    return !checkpoint_file_name.empty() && (iteration+1)%checkpoint_period == 0;
+}
+
+
+/// Loads the checkpoint file, if the search is to be resumed and that file exists.
+/// It restores the histories, the evaluation cache and the state of the random number generator,
+/// and returns true, so that the algorithm can restore its own state from the checkpoint.
+/// @param checkpoint Checkpoint where the file is loaded.
+
+bool InputsSelection::load_checkpoint(Checkpoint& checkpoint)
+{
+    if(!resume_from_checkpoint || !Checkpoint::exists(checkpoint_file_name)) return false;
 
-    for(i = 0; i < inputs_history.size(); i++)
+    checkpoint.load(checkpoint_file_name);
+
+    const size_t input_columns_number = training_strategy_pointer->get_loss_index_pointer()->get_data_set_pointer()->get_input_columns_number();
+
+    if(checkpoint.get_size_t("InputColumnsNumber") != input_columns_number)
     {
-        if(inputs_history[i] == inputs)
-        {
-            parameters = parameters_history[i];
+        ostringstream buffer;
 
-            break;
-        }
+        buffer << "OpenNN Exception: InputsSelection class.\n"
+               << "bool load_checkpoint(Checkpoint&) method.\n"
+               << "Number of input columns in checkpoint (" << checkpoint.get_size_t("InputColumnsNumber") << ") "
+               << "is not equal to number of input columns in data set (" << input_columns_number << ").\n";
+
+        throw logic_error(buffer.str());
     }
 
-    return parameters;
+    inputs_history = checkpoint.get_bool_vectors("InputsHistory");
+    training_error_history = checkpoint.get_vector("TrainingErrorHistory");
+    selection_error_history = checkpoint.get_vector("SelectionErrorHistory");
+    parameters_history = checkpoint.get_vectors("ParametersHistory");
+
+    evaluation_cache = checkpoint.get_evaluation_cache();
+
+    get_random_generator() = checkpoint.get_generator("RandomGenerator");
+
+    if(display) cout << "Resuming from checkpoint: " << checkpoint_file_name << endl;
 
+    return true;
+}
+
+
+/// Saves the state of the search to the checkpoint file.
+/// The algorithm sets its own state in the checkpoint, and this method adds the histories, the evaluation cache
+/// and the state of the random number generator.
+/// A resumed search continues with the same random numbers.
+/// @param checkpoint Checkpoint with the state of the algorithm.
+
+void InputsSelection::save_checkpoint(Checkpoint& checkpoint) const
+{
+    checkpoint.set_generator("RandomGenerator", get_random_generator());
+
+    checkpoint.set_size_t("InputColumnsNumber", training_strategy_pointer->get_loss_index_pointer()->get_data_set_pointer()->get_input_columns_number());
+
+    checkpoint.set_bool_vectors("InputsHistory", inputs_history);
+    checkpoint.set_vector("TrainingErrorHistory", training_error_history);
+    checkpoint.set_vector("SelectionErrorHistory", selection_error_history);
+    checkpoint.set_vectors("ParametersHistory", parameters_history);
+
+    checkpoint.set_evaluation_cache(evaluation_cache);
+
+    checkpoint.save(checkpoint_file_name);
+}
+
+
+/// Removes the checkpoint file, once the search has finished.
+
+void InputsSelection::remove_checkpoint() const
+{
+    if(checkpoint_file_name.empty()) return;
+
+    remove(checkpoint_file_name.c_str());
 }
 
 
@@ -744,18 +1474,24 @@ string InputsSelection::write_stopping_condition(const OptimizationAlgorithm::Re
 
 
 /// Delete the history of the selection error values.
+/// The cache of trained neural networks is also cleared, since it can no longer be matched with the history.
 
 void InputsSelection::delete_selection_history()
 {
     selection_error_history.set();
+
+    evaluation_cache.clear();
 }
 
 
 /// Delete the history of the loss values.
+/// The cache of trained neural networks is also cleared, since it can no longer be matched with the history.
 
 void InputsSelection::delete_loss_history()
 {
     training_error_history.set();
+
+    evaluation_cache.clear();
 }
 
 
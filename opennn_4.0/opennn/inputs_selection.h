@@ -17,6 +17,9 @@
 #include <sstream>
 #include <cmath>
 #include <ctime>
+#include <thread>
+#include <atomic>
+#include <exception>
 #include <limits>
 
 // OpenNN includes
@@ -25,6 +28,9 @@
 #include "matrix.h"
 
 #include "training_strategy.h"
+#include "data_set_view.h"
+#include "evaluation_cache.h"
+#include "checkpoint.h"
 
 #include "tinyxml2.h"
 
@@ -128,10 +134,29 @@ public:
 
     TrainingStrategy* get_training_strategy_pointer() const;
 
+    const EvaluationCache& get_evaluation_cache() const;
+    EvaluationCache* get_evaluation_cache_pointer();
+
     bool has_training_strategy() const;
 
     const size_t& get_trials_number() const;
 
+    const bool& get_warm_start() const;
+    const size_t& get_warm_start_epochs_number() const;
+
+    const bool& get_successive_halving() const;
+    const size_t& get_successive_halving_epochs_number() const;
+
+    const size_t& get_trials_workers_number() const;
+
+    const string& get_checkpoint_file_name() const;
+    const size_t& get_checkpoint_period() const;
+    const bool& get_resume_from_checkpoint() const;
+
+    const bool& get_pre_screening() const;
+    const size_t& get_pre_screening_inputs_number() const;
+    const double& get_pre_screening_maximum_redundancy() const;
+
     const bool& get_reserve_error_data() const;
     const bool& get_reserve_selection_error_data() const;
     const bool& get_reserve_minimal_parameters() const;
@@ -155,6 +180,22 @@ public:
 
     void set_trials_number(const size_t&);
 
+    void set_warm_start(const bool&);
+    void set_warm_start_epochs_number(const size_t&);
+
+    void set_successive_halving(const bool&);
+    void set_successive_halving_epochs_number(const size_t&);
+
+    void set_trials_workers_number(const size_t&);
+
+    void set_checkpoint_file_name(const string&);
+    void set_checkpoint_period(const size_t&);
+    void set_resume_from_checkpoint(const bool&);
+
+    void set_pre_screening(const bool&);
+    void set_pre_screening_inputs_number(const size_t&);
+    void set_pre_screening_maximum_redundancy(const double&);
+
     void set_reserve_error_data(const bool&);
     void set_reserve_selection_error_data(const bool&);
     void set_reserve_minimal_parameters(const bool&);
@@ -172,10 +213,34 @@ public:
 
     Vector<double> calculate_losses(const Vector<bool>&);
 
+    Vector<OptimizationAlgorithm::Results> perform_trials(const Vector<bool>&) const;
+
     Vector<double> perform_mean_model_evaluation(const Vector<bool>&);
 
+    /// View of the data set and copies of the neural network and the training strategy of an inputs selection algorithm.
+    /// Candidates are trained on replicas, without modifying the original objects, so that several of them can be trained concurrently.
+
+    struct ModelReplica
+    {
+        explicit ModelReplica(const TrainingStrategy&);
+
+        void set_inputs_mask(const Vector<bool>&);
+
+        DataSetView data_set;
+
+        NeuralNetwork neural_network;
+
+        TrainingStrategy training_strategy;
+    };
+
+    Vector<double> calculate_replica_losses(const Vector<bool>&, ModelReplica&, Vector<double>&) const;
+
     Vector<double> get_parameters_inputs(const Vector<bool>&) const;
 
+    size_t perform_successive_halving(const Vector<Vector<bool>>&, Matrix<double>&, Vector<Vector<double>>&) const;
+
+    Vector<size_t> perform_pre_screening();
+
     string write_stopping_condition(const OptimizationAlgorithm::Results&) const;
 
     // inputs selection methods
@@ -217,10 +282,71 @@ protected:
 
     Vector<Vector<double>> parameters_history;
 
+    /// Training and selection errors and parameters of all the neural networks trained, indexed by their inputs.
+
+    EvaluationCache evaluation_cache;
+
     /// Number of trials for each neural network.
 
     size_t trials_number;
 
+    /// True if each candidate is initialized from the parameters of the previous one, and then fine-tuned in a single trial.
+    /// Only the parameters of the added or removed inputs are changed.
+
+    bool warm_start;
+
+    /// Maximum number of epochs of the fine-tuning of a warm-started candidate.
+
+    size_t warm_start_epochs_number;
+
+    /// True if the candidates are trained by successive halving: all of them for a few epochs,
+    /// then only the better half with twice the epochs, until one is left, which is trained with the full budget.
+
+    bool successive_halving;
+
+    /// Number of epochs of the first round of successive halving.
+
+    size_t successive_halving_epochs_number;
+
+    /// Number of threads which train the trials of a candidate concurrently, each one on its own copy of the neural network.
+    /// If it is 1, the trials are trained sequentially.
+
+    size_t trials_workers_number;
+
+    /// Name of the binary file where the state of the search is saved periodically. If it is empty, no checkpoints are saved.
+
+    string checkpoint_file_name;
+
+    /// Number of iterations between two checkpoints.
+
+    size_t checkpoint_period;
+
+    /// True if the search starts from the state saved in the checkpoint file, when that file exists.
+
+    bool resume_from_checkpoint;
+
+    // Checkpoint methods
+
+    bool is_checkpoint_iteration(const size_t&) const;
+
+    bool load_checkpoint(Checkpoint&);
+    void save_checkpoint(Checkpoint&) const;
+    void remove_checkpoint() const;
+
+    /// True if the input columns are filtered by their correlation and mutual information with the targets before the selection,
+    /// so that the algorithm only searches among the most relevant and least redundant ones.
+
+    bool pre_screening;
+
+    /// Maximum number of input columns kept by the pre-screening.
+
+    size_t pre_screening_inputs_number;
+
+    /// Maximum absolute correlation between two input columns kept by the pre-screening.
+    /// An input column more correlated than this with a more relevant one is discarded.
+
+    double pre_screening_maximum_redundancy;
+
     // Inputs selection results
 
     /// True if the parameters of all neural networks are to be reserved.
@@ -122,6 +122,11 @@ string LearningRateAlgorithm::write_learning_rate_method() const
       {
          return "BrentMethod";
 	   }
+
+      case StrongWolfe:
+      {
+         return "StrongWolfe";
+      }
    }
 
    return string();
@@ -224,7 +229,7 @@ void LearningRateAlgorithm::set_learning_rate_method(const LearningRateAlgorithm
 
 
 /// Sets the method for obtaining the training rate from a string with the name of the method.
-/// @param new_learning_rate_method Name of training rate method("Fixed", "GoldenSection", "BrentMethod").
+/// @param new_learning_rate_method Name of training rate method("Fixed", "GoldenSection", "BrentMethod", "StrongWolfe").
 
 void LearningRateAlgorithm::set_learning_rate_method(const string& new_learning_rate_method)
 {
@@ -240,6 +245,10 @@ void LearningRateAlgorithm::set_learning_rate_method(const string& new_learning_
    {
       learning_rate_method = BrentMethod;
    }
+   else if(new_learning_rate_method == "StrongWolfe")
+   {
+      learning_rate_method = StrongWolfe;
+   }
    else
    {
       ostringstream buffer;
@@ -397,12 +406,44 @@ pair<double,double> LearningRateAlgorithm::calculate_directional_point(const dou
       {
          return calculate_Brent_method_directional_point(loss, training_direction, initial_learning_rate);
       }
+
+      case StrongWolfe:
+      {
+         set_directional_losses(loss, training_direction);
+
+         const double slope = calculate_directional_loss_derivative(training_direction, 0.0).second;
+
+         return calculate_strong_Wolfe_directional_point(loss, slope, training_direction, initial_learning_rate);
+      }
    }
 
    return pair<double,double>();
 }
 
 
+/// Returns a vector with two elements:
+///(i) the training rate calculated by means of the corresponding algorithm, and
+///(ii) the loss for that training rate.
+/// The derivative of the loss along the training direction is known, so that the strong Wolfe method does not need to calculate it.
+/// @param loss Initial Performance value.
+/// @param slope Derivative of the loss along the training direction, which is the dot product of the gradient and the training direction.
+/// @param training_direction Initial training direction.
+/// @param initial_learning_rate Initial training rate to start the algorithm.
+
+pair<double,double> LearningRateAlgorithm::calculate_directional_point(const double& loss,
+                                                                       const double& slope,
+                                                                       const Vector<double>& training_direction,
+                                                                       const double& initial_learning_rate) const
+{
+   if(learning_rate_method == StrongWolfe)
+   {
+      return calculate_strong_Wolfe_directional_point(loss, slope, training_direction, initial_learning_rate);
+   }
+
+   return calculate_directional_point(loss, training_direction, initial_learning_rate);
+}
+
+
 /// Returns bracketing triplet.
 /// This algorithm is used by line minimization algorithms. 
 /// @param loss Initial Performance value.
@@ -414,6 +455,8 @@ LearningRateAlgorithm::Triplet LearningRateAlgorithm::calculate_bracketing_tripl
         const Vector<double>& training_direction,
         const double& initial_learning_rate) const
 {    
+    set_directional_losses(loss, training_direction);
+
     Triplet triplet;
 
     // Left point
@@ -435,7 +478,7 @@ LearningRateAlgorithm::Triplet LearningRateAlgorithm::calculate_bracketing_tripl
 
    triplet.B.first = initial_learning_rate;
 
-   triplet.B.second = loss_index_pointer->calculate_training_loss(training_direction, triplet.B.first);
+   triplet.B.second = calculate_directional_loss(training_direction, triplet.B.first);
    count++;
 
    if(triplet.A.second > triplet.B.second)
@@ -443,7 +486,7 @@ LearningRateAlgorithm::Triplet LearningRateAlgorithm::calculate_bracketing_tripl
        triplet.U = triplet.B;
 
        triplet.B.first *= golden_ratio;
-       triplet.B.second = loss_index_pointer->calculate_training_loss(training_direction, triplet.B.first);
+       triplet.B.second = calculate_directional_loss(training_direction, triplet.B.first);
        count++;
 
        while(triplet.U.second > triplet.B.second)
@@ -452,14 +495,14 @@ LearningRateAlgorithm::Triplet LearningRateAlgorithm::calculate_bracketing_tripl
            triplet.U = triplet.B;
 
            triplet.B.first *= golden_ratio;
-           triplet.B.second = loss_index_pointer->calculate_training_loss(training_direction, triplet.B.first);
+           triplet.B.second = calculate_directional_loss(training_direction, triplet.B.first);
            count++;
        }
    }
    else if(triplet.A.second < triplet.B.second)
    {
        triplet.U.first = triplet.A.first + (triplet.B.first - triplet.A.first)*0.382;
-       triplet.U.second = loss_index_pointer->calculate_training_loss(training_direction, triplet.U.first);
+       triplet.U.second = calculate_directional_loss(training_direction, triplet.U.first);
        count++;
 
        while(triplet.A.second < triplet.U.second)
@@ -467,7 +510,7 @@ LearningRateAlgorithm::Triplet LearningRateAlgorithm::calculate_bracketing_tripl
           triplet.B = triplet.U;
 
           triplet.U.first = triplet.A.first + (triplet.B.first-triplet.A.first)*0.382;
-          triplet.U.second = loss_index_pointer->calculate_training_loss(training_direction, triplet.U.first);
+          triplet.U.second = calculate_directional_loss(training_direction, triplet.U.first);
 
           if(triplet.U.first - triplet.A.first <= loss_tolerance)
           {
@@ -491,12 +534,14 @@ LearningRateAlgorithm::Triplet LearningRateAlgorithm::calculate_bracketing_tripl
 /// @param training_direction Training direction for the directional point.
 /// @param initial_learning_rate Training rate for the directional point.
 
-pair<double,double> LearningRateAlgorithm::calculate_fixed_directional_point(const double&, const Vector<double>& training_direction, const double& initial_learning_rate) const
+pair<double,double> LearningRateAlgorithm::calculate_fixed_directional_point(const double& loss, const Vector<double>& training_direction, const double& initial_learning_rate) const
 {
+   set_directional_losses(loss, training_direction);
+
    pair<double,double> directional_point;
 
    directional_point.first = initial_learning_rate;
-   directional_point.second = loss_index_pointer->calculate_training_loss(training_direction, initial_learning_rate);
+   directional_point.second = calculate_directional_loss(training_direction, initial_learning_rate);
 
    return(directional_point);
 }
@@ -533,7 +578,7 @@ pair<double,double> LearningRateAlgorithm:: calculate_golden_section_directional
       {
          V.first = calculate_golden_section_learning_rate(triplet);
 
-         V.second = loss_index_pointer->calculate_training_loss(training_direction, V.first);
+         V.second = calculate_directional_loss(training_direction, V.first);
 
          // Update points
  
@@ -598,7 +643,7 @@ pair<double,double> LearningRateAlgorithm:: calculate_golden_section_directional
 
       pair<double,double> X;
       X.first = initial_learning_rate;
-      X.second = loss_index_pointer->calculate_training_loss(training_direction, X.first);
+      X.second = calculate_directional_loss(training_direction, X.first);
 
        if(X.second > loss)
 	   {
@@ -653,7 +698,7 @@ pair<double, double> LearningRateAlgorithm::calculate_Brent_method_directional_p
 
          // Calculate loss for V
 
-         V.second = loss_index_pointer->calculate_training_loss(training_direction, V.first);
+         V.second = calculate_directional_loss(training_direction, V.first);
          count++;
 
          // Update points
@@ -718,7 +763,7 @@ pair<double, double> LearningRateAlgorithm::calculate_Brent_method_directional_p
 
       pair<double, double> X;
       X.first = initial_learning_rate;
-      X.second = loss_index_pointer->calculate_training_loss(training_direction, X.first);
+      X.second = calculate_directional_loss(training_direction, X.first);
 
       if(X.second > loss)
 	  {
@@ -731,6 +776,148 @@ pair<double, double> LearningRateAlgorithm::calculate_Brent_method_directional_p
 }
 
 
+/// Returns the training rate by searching in a given direction for a point which satisfies the strong Wolfe conditions:
+/// sufficient decrease of the loss, and sufficient decrease of the absolute value of its derivative along the direction.
+/// The interval containing such a point is bracketed by increasing the learning rate, and then it is reduced by cubic interpolation.
+/// Each trial point is evaluated with a single pass which calculates both the loss and its derivative.
+/// @param loss Neural network loss value.
+/// @param slope Derivative of the loss along the training direction.
+/// @param training_direction Training direction vector.
+/// @param initial_learning_rate Initial training rate in line minimization.
+
+pair<double, double> LearningRateAlgorithm::calculate_strong_Wolfe_directional_point(const double& loss,
+                                                                                    const double& slope,
+                                                                                    const Vector<double>& training_direction,
+                                                                                    const double& initial_learning_rate) const
+{
+   set_directional_losses(loss, training_direction);
+
+   pair<double, double> directional_point(0.0, loss);
+
+   if(slope >= 0.0 || initial_learning_rate <= 0.0 || training_direction == 0.0) return directional_point;
+
+   // Previous point
+
+   double previous_learning_rate = 0.0;
+   double previous_loss = loss;
+   double previous_slope = slope;
+
+   // Interval containing a point which satisfies the strong Wolfe conditions
+
+   double low_learning_rate = 0.0;
+   double low_loss = loss;
+   double low_slope = slope;
+
+   double high_learning_rate = 0.0;
+   double high_loss = loss;
+   double high_slope = slope;
+
+   bool bracketed = false;
+
+   double learning_rate = initial_learning_rate;
+
+   size_t iterations = 0;
+
+   // Bracketing
+
+   while(iterations < maximum_strong_Wolfe_iterations)
+   {
+      const pair<double, double> loss_derivative = calculate_directional_loss_derivative(training_direction, learning_rate);
+      iterations++;
+
+      if(loss_derivative.first > loss + sufficient_decrease_parameter*learning_rate*slope
+      || (previous_learning_rate > 0.0 && loss_derivative.first >= previous_loss))
+      {
+         low_learning_rate = previous_learning_rate;
+         low_loss = previous_loss;
+         low_slope = previous_slope;
+
+         high_learning_rate = learning_rate;
+         high_loss = loss_derivative.first;
+         high_slope = loss_derivative.second;
+
+         bracketed = true;
+
+         break;
+      }
+
+      if(abs(loss_derivative.second) <= -curvature_parameter*slope)
+      {
+         return make_pair(learning_rate, loss_derivative.first);
+      }
+
+      if(loss_derivative.second >= 0.0)
+      {
+         low_learning_rate = learning_rate;
+         low_loss = loss_derivative.first;
+         low_slope = loss_derivative.second;
+
+         high_learning_rate = previous_learning_rate;
+         high_loss = previous_loss;
+         high_slope = previous_slope;
+
+         bracketed = true;
+
+         break;
+      }
+
+      previous_learning_rate = learning_rate;
+      previous_loss = loss_derivative.first;
+      previous_slope = loss_derivative.second;
+
+      if(learning_rate*golden_ratio >= error_learning_rate) break;
+
+      learning_rate *= golden_ratio;
+   }
+
+   if(!bracketed)
+   {
+      return previous_loss < loss ? make_pair(previous_learning_rate, previous_loss) : directional_point;
+   }
+
+   // Zoom
+
+   while(iterations < maximum_strong_Wolfe_iterations)
+   {
+      if(abs(high_learning_rate - low_learning_rate) < numeric_limits<double>::epsilon()*max(1.0, low_learning_rate)) break;
+
+      learning_rate = calculate_cubic_interpolation_learning_rate(low_learning_rate, low_loss, low_slope,
+                                                                  high_learning_rate, high_loss, high_slope);
+
+      const pair<double, double> loss_derivative = calculate_directional_loss_derivative(training_direction, learning_rate);
+      iterations++;
+
+      if(loss_derivative.first > loss + sufficient_decrease_parameter*learning_rate*slope
+      || loss_derivative.first >= low_loss)
+      {
+         high_learning_rate = learning_rate;
+         high_loss = loss_derivative.first;
+         high_slope = loss_derivative.second;
+      }
+      else
+      {
+         if(abs(loss_derivative.second) <= -curvature_parameter*slope)
+         {
+            return make_pair(learning_rate, loss_derivative.first);
+         }
+
+         if(loss_derivative.second*(high_learning_rate - low_learning_rate) >= 0.0)
+         {
+            high_learning_rate = low_learning_rate;
+            high_loss = low_loss;
+            high_slope = low_slope;
+         }
+
+         low_learning_rate = learning_rate;
+         low_loss = loss_derivative.first;
+         low_slope = loss_derivative.second;
+      }
+   }
+
+   return make_pair(low_learning_rate, low_loss);
+}
+
+
 /// Calculates the golden section point within a minimum interval defined by three points.
 /// @param triplet Triplet containing a minimum.
 
@@ -830,6 +1017,132 @@ double LearningRateAlgorithm::calculate_Brent_method_learning_rate(const Triplet
 }
 
 
+/// Returns the minimum of the cubic polynomial which interpolates the losses and their derivatives
+/// along the training direction at two learning rates.
+/// If the cubic has no minimum, or it is too close to the end points of the interval,
+/// the midpoint of the interval is returned.
+/// @param learning_rate_1 First learning rate.
+/// @param loss_1 Loss at the first learning rate.
+/// @param slope_1 Derivative of the loss along the training direction at the first learning rate.
+/// @param learning_rate_2 Second learning rate.
+/// @param loss_2 Loss at the second learning rate.
+/// @param slope_2 Derivative of the loss along the training direction at the second learning rate.
+
+double LearningRateAlgorithm::calculate_cubic_interpolation_learning_rate(const double& learning_rate_1, const double& loss_1, const double& slope_1,
+                                                                          const double& learning_rate_2, const double& loss_2, const double& slope_2) const
+{
+   const double midpoint = 0.5*(learning_rate_1 + learning_rate_2);
+
+   const double interval_length = abs(learning_rate_2 - learning_rate_1);
+
+   if(interval_length < numeric_limits<double>::min()) return learning_rate_1;
+
+   const double d1 = slope_1 + slope_2 - 3.0*(loss_1 - loss_2)/(learning_rate_1 - learning_rate_2);
+
+   const double discriminant = d1*d1 - slope_1*slope_2;
+
+   if(discriminant < 0.0) return midpoint;
+
+   const double d2 = (learning_rate_2 > learning_rate_1 ? 1.0 : -1.0)*sqrt(discriminant);
+
+   const double denominator = slope_2 - slope_1 + 2.0*d2;
+
+   if(abs(denominator) < numeric_limits<double>::min()) return midpoint;
+
+   const double learning_rate = learning_rate_2 - (learning_rate_2 - learning_rate_1)*(slope_2 + d2 - d1)/denominator;
+
+   // Safeguard
+
+   const double lower_bound = min(learning_rate_1, learning_rate_2) + 0.1*interval_length;
+   const double upper_bound = max(learning_rate_1, learning_rate_2) - 0.1*interval_length;
+
+   if(learning_rate < lower_bound || learning_rate > upper_bound) return midpoint;
+
+   return learning_rate;
+}
+
+
+/// Returns the loss for a learning rate along a training direction.
+/// The losses evaluated along the current training direction are kept, so that each learning rate is only evaluated once.
+/// @param training_direction Training direction.
+/// @param learning_rate Learning rate.
+
+double LearningRateAlgorithm::calculate_directional_loss(const Vector<double>& training_direction, const double& learning_rate) const
+{
+   if(training_direction.size() == directional_losses_direction.size() && training_direction == directional_losses_direction)
+   {
+      const map<double, double>::const_iterator iterator = directional_losses.find(learning_rate);
+
+      if(iterator != directional_losses.end()) return iterator->second;
+   }
+
+   const double loss = loss_index_pointer->calculate_training_loss(training_direction, learning_rate);
+
+   if(training_direction.size() == directional_losses_direction.size() && training_direction == directional_losses_direction)
+   {
+      directional_losses[learning_rate] = loss;
+   }
+
+   return loss;
+}
+
+
+/// Returns the loss and its derivative along a training direction for a learning rate.
+/// Both are calculated in a single pass over the training instances when the loss index provides the first order loss.
+/// @param training_direction Training direction.
+/// @param learning_rate Learning rate.
+
+pair<double, double> LearningRateAlgorithm::calculate_directional_loss_derivative(const Vector<double>& training_direction, const double& learning_rate) const
+{
+   NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
+
+   // The parameters are set again when leaving this method, also if the loss throws
+
+   const ScopedParameters scoped_parameters(neural_network_pointer);
+
+   neural_network_pointer->set_parameters(scoped_parameters.get_parameters() + training_direction*learning_rate);
+
+   LossIndex::FirstOrderLoss first_order_loss = loss_index_pointer->calculate_first_order_loss();
+
+   if(first_order_loss.gradient.empty())
+   {
+      first_order_loss.loss = loss_index_pointer->calculate_training_loss();
+      first_order_loss.gradient = loss_index_pointer->calculate_training_loss_gradient();
+   }
+
+   if(training_direction.size() == directional_losses_direction.size() && training_direction == directional_losses_direction)
+   {
+      directional_losses[learning_rate] = first_order_loss.loss;
+   }
+
+   return make_pair(first_order_loss.loss, dot(first_order_loss.gradient, training_direction));
+}
+
+
+/// Starts a new line search along a training direction.
+/// The kept losses are discarded unless the training direction and the initial loss are the same as in the previous line search,
+/// as when a line search is restarted from another learning rate.
+/// @param loss Loss at the current parameters.
+/// @param training_direction Training direction.
+
+void LearningRateAlgorithm::set_directional_losses(const double& loss, const Vector<double>& training_direction) const
+{
+   const map<double, double>::const_iterator iterator = directional_losses.find(0.0);
+
+   if(training_direction.size() != directional_losses_direction.size()
+   || !(training_direction == directional_losses_direction)
+   || iterator == directional_losses.end()
+   || iterator->second != loss)
+   {
+      directional_losses.clear();
+
+      directional_losses_direction = training_direction;
+   }
+
+   directional_losses[0.0] = loss;
+}
+
+
 /// Returns a default string representation in XML-type format of the optimization algorithm object.
 /// This containts the training operators, the training parameters, stopping criteria and other stuff.
 
@@ -15,6 +15,7 @@
 #include <fstream>
 #include <algorithm>
 #include <functional>
+#include <map>
 #include <limits>
 #include <cmath>
 #include <ctime>
@@ -42,7 +43,7 @@ public:
 
    /// Available training operators for obtaining the perform_training rate.
 
-   enum LearningRateMethod{Fixed, GoldenSection, BrentMethod};
+   enum LearningRateMethod{Fixed, GoldenSection, BrentMethod, StrongWolfe};
 
    // Constructors
 
@@ -259,13 +260,21 @@ public:
    double calculate_golden_section_learning_rate(const Triplet&) const;
    double calculate_Brent_method_learning_rate(const Triplet&) const;
 
+   double calculate_cubic_interpolation_learning_rate(const double&, const double&, const double&,
+                                                      const double&, const double&, const double&) const;
+
+   double calculate_directional_loss(const Vector<double>&, const double&) const;
+   pair<double, double> calculate_directional_loss_derivative(const Vector<double>&, const double&) const;
+
    Triplet calculate_bracketing_triplet(const double&, const Vector<double>&, const double&) const;
 
    pair<double, double> calculate_fixed_directional_point(const double&, const Vector<double>&, const double&) const;
    pair<double, double> calculate_golden_section_directional_point(const double&, const Vector<double>&, const double&) const;
    pair<double, double> calculate_Brent_method_directional_point(const double&, const Vector<double>&, const double&) const;
+   pair<double, double> calculate_strong_Wolfe_directional_point(const double&, const double&, const Vector<double>&, const double&) const;
 
    pair<double, double> calculate_directional_point(const double&, const Vector<double>&, const double&) const;
+   pair<double, double> calculate_directional_point(const double&, const double&, const Vector<double>&, const double&) const;
 
    // Serialization methods
 
@@ -308,6 +317,29 @@ protected:
 
    const double golden_ratio = 1.618;
 
+   /// Sufficient decrease constant of the strong Wolfe conditions.
+
+   const double sufficient_decrease_parameter = 1.0e-4;
+
+   /// Curvature constant of the strong Wolfe conditions.
+
+   const double curvature_parameter = 0.9;
+
+   /// Maximum number of loss evaluations in the strong Wolfe line search.
+
+   const size_t maximum_strong_Wolfe_iterations = 20;
+
+   /// Losses already evaluated along the current training direction, indexed by learning rate.
+   /// The same learning rate is not evaluated twice during a line search.
+
+   mutable map<double, double> directional_losses;
+
+   /// Training direction of the directional losses.
+
+   mutable Vector<double> directional_losses_direction;
+
+   void set_directional_losses(const double&, const Vector<double>&) const;
+
 };
 
 }
@@ -0,0 +1,1028 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   L E A R N I N G   R A T E   S C H E D U L E   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "learning_rate_schedule.h"
+
+namespace OpenNN
+{
+
+/// Default constructor.
+/// It creates a learning rate schedule object with the members set to their default values.
+
+LearningRateSchedule::LearningRateSchedule()
+{
+   set_default();
+}
+
+
+/// XML constructor.
+/// It creates a learning rate schedule object and loads its members from a XML document.
+/// @param document TinyXML document with the members of a learning rate schedule object.
+
+LearningRateSchedule::LearningRateSchedule(const tinyxml2::XMLDocument& document)
+{
+   set_default();
+
+   from_XML(document);
+}
+
+
+/// Destructor.
+
+LearningRateSchedule::~LearningRateSchedule()
+{
+}
+
+
+/// Returns the schedule used for the learning rate.
+
+const LearningRateSchedule::ScheduleMethod& LearningRateSchedule::get_schedule_method() const
+{
+   return schedule_method;
+}
+
+
+/// Returns a string with the name of the schedule used for the learning rate.
+
+string LearningRateSchedule::write_schedule_method() const
+{
+   switch(schedule_method)
+   {
+      case Constant:
+      {
+         return "Constant";
+      }
+
+      case Step:
+      {
+         return "Step";
+      }
+
+      case Exponential:
+      {
+         return "Exponential";
+      }
+
+      case CosineAnnealing:
+      {
+         return "CosineAnnealing";
+      }
+
+      case OneCycle:
+      {
+         return "OneCycle";
+      }
+
+      case ReduceOnPlateau:
+      {
+         return "ReduceOnPlateau";
+      }
+   }
+
+   ostringstream buffer;
+
+   buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+          << "string write_schedule_method() const method.\n"
+          << "Unknown schedule method.\n";
+
+   throw logic_error(buffer.str());
+}
+
+
+/// Returns the number of epochs during which the learning rate grows linearly from zero.
+
+const double& LearningRateSchedule::get_warmup_epochs() const
+{
+   return warmup_epochs;
+}
+
+
+/// Returns the number of epochs between two decays of the step schedule.
+
+const double& LearningRateSchedule::get_step_epochs() const
+{
+   return step_epochs;
+}
+
+
+/// Returns the factor by which the learning rate is multiplied at each decay of the step, exponential and plateau schedules.
+
+const double& LearningRateSchedule::get_decay_rate() const
+{
+   return decay_rate;
+}
+
+
+/// Returns the number of epochs of the first cosine annealing period, or of the one cycle schedule.
+
+const double& LearningRateSchedule::get_period_epochs() const
+{
+   return period_epochs;
+}
+
+
+/// Returns the factor by which each cosine annealing period is longer than the previous one.
+
+const double& LearningRateSchedule::get_period_multiplier() const
+{
+   return period_multiplier;
+}
+
+
+/// Returns the lowest fraction of the initial learning rate reached by the cosine annealing, one cycle and plateau schedules.
+
+const double& LearningRateSchedule::get_minimum_factor() const
+{
+   return minimum_factor;
+}
+
+
+/// Returns the peak fraction of the initial learning rate reached by the one cycle schedule.
+
+const double& LearningRateSchedule::get_maximum_factor() const
+{
+   return maximum_factor;
+}
+
+
+/// Returns the number of epochs without improvement of the selection error after which the plateau schedule decays the learning rate.
+
+const size_t& LearningRateSchedule::get_patience() const
+{
+   return patience;
+}
+
+
+/// Sets the members of the learning rate schedule to their default values.
+/// The default schedule keeps the learning rate constant.
+
+void LearningRateSchedule::set_default()
+{
+   schedule_method = Constant;
+
+   warmup_epochs = 0.0;
+   step_epochs = 10.0;
+   decay_rate = 0.5;
+   period_epochs = 100.0;
+   period_multiplier = 1.0;
+   minimum_factor = 0.0;
+   maximum_factor = 10.0;
+   patience = 10;
+
+   reset();
+}
+
+
+/// Sets a new schedule for the learning rate.
+/// @param new_schedule_method Schedule method.
+
+void LearningRateSchedule::set_schedule_method(const ScheduleMethod& new_schedule_method)
+{
+   schedule_method = new_schedule_method;
+}
+
+
+/// Sets a new schedule for the learning rate from a string containing its name.
+/// Possible values are:
+/// <ul>
+/// <li> "Constant"
+/// <li> "Step"
+/// <li> "Exponential"
+/// <li> "CosineAnnealing"
+/// <li> "OneCycle"
+/// <li> "ReduceOnPlateau"
+/// </ul>
+/// @param new_schedule_method_name Name of the schedule method.
+
+void LearningRateSchedule::set_schedule_method(const string& new_schedule_method_name)
+{
+   if(new_schedule_method_name == "Constant")
+   {
+      schedule_method = Constant;
+   }
+   else if(new_schedule_method_name == "Step")
+   {
+      schedule_method = Step;
+   }
+   else if(new_schedule_method_name == "Exponential")
+   {
+      schedule_method = Exponential;
+   }
+   else if(new_schedule_method_name == "CosineAnnealing")
+   {
+      schedule_method = CosineAnnealing;
+   }
+   else if(new_schedule_method_name == "OneCycle")
+   {
+      schedule_method = OneCycle;
+   }
+   else if(new_schedule_method_name == "ReduceOnPlateau")
+   {
+      schedule_method = ReduceOnPlateau;
+   }
+   else
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_schedule_method(const string&) method.\n"
+             << "Unknown schedule method: " << new_schedule_method_name << ".\n";
+
+      throw logic_error(buffer.str());
+   }
+}
+
+
+/// Sets the number of epochs during which the learning rate grows linearly from zero.
+/// Warmup is applied on top of any schedule method.
+/// @param new_warmup_epochs Warmup epochs.
+
+void LearningRateSchedule::set_warmup_epochs(const double& new_warmup_epochs)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_warmup_epochs < 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_warmup_epochs(const double&) method.\n"
+             << "Number of warmup epochs must be equal or greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   warmup_epochs = new_warmup_epochs;
+}
+
+
+/// Sets the number of epochs between two decays of the step schedule.
+/// @param new_step_epochs Step epochs.
+
+void LearningRateSchedule::set_step_epochs(const double& new_step_epochs)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_step_epochs <= 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_step_epochs(const double&) method.\n"
+             << "Number of step epochs must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   step_epochs = new_step_epochs;
+}
+
+
+/// Sets the factor by which the learning rate is multiplied at each decay of the step, exponential and plateau schedules.
+/// @param new_decay_rate Decay rate.
+
+void LearningRateSchedule::set_decay_rate(const double& new_decay_rate)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_decay_rate <= 0.0 || new_decay_rate > 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_decay_rate(const double&) method.\n"
+             << "Decay rate must be greater than 0 and equal or less than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   decay_rate = new_decay_rate;
+}
+
+
+/// Sets the number of epochs of the first cosine annealing period, or of the one cycle schedule.
+/// @param new_period_epochs Period epochs.
+
+void LearningRateSchedule::set_period_epochs(const double& new_period_epochs)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_period_epochs <= 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_period_epochs(const double&) method.\n"
+             << "Number of period epochs must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   period_epochs = new_period_epochs;
+}
+
+
+/// Sets the factor by which each cosine annealing period is longer than the previous one.
+/// A value of one restarts the annealing at regular intervals.
+/// @param new_period_multiplier Period multiplier.
+
+void LearningRateSchedule::set_period_multiplier(const double& new_period_multiplier)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_period_multiplier < 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_period_multiplier(const double&) method.\n"
+             << "Period multiplier must be equal or greater than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   period_multiplier = new_period_multiplier;
+}
+
+
+/// Sets the lowest fraction of the initial learning rate reached by the cosine annealing, one cycle and plateau schedules.
+/// @param new_minimum_factor Minimum factor.
+
+void LearningRateSchedule::set_minimum_factor(const double& new_minimum_factor)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_minimum_factor < 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_minimum_factor(const double&) method.\n"
+             << "Minimum factor must be equal or greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   minimum_factor = new_minimum_factor;
+}
+
+
+/// Sets the peak fraction of the initial learning rate reached by the one cycle schedule.
+/// @param new_maximum_factor Maximum factor.
+
+void LearningRateSchedule::set_maximum_factor(const double& new_maximum_factor)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_maximum_factor < 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void set_maximum_factor(const double&) method.\n"
+             << "Maximum factor must be equal or greater than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   maximum_factor = new_maximum_factor;
+}
+
+
+/// Sets the number of epochs without improvement of the selection error after which the plateau schedule decays the learning rate.
+/// @param new_patience Patience.
+
+void LearningRateSchedule::set_patience(const size_t& new_patience)
+{
+   patience = new_patience;
+}
+
+
+/// Restarts the state of the plateau schedule.
+/// It is called by the optimization algorithms at the beginning of the training.
+
+void LearningRateSchedule::reset()
+{
+   plateau_factor = 1.0;
+
+   minimum_selection_error = numeric_limits<double>::max();
+
+   selection_failures = 0;
+}
+
+
+/// Returns the factor by which the initial learning rate is multiplied at a given epoch.
+/// @param epoch Epoch of the training, which can be fractional to account for the batches already used in that epoch.
+
+double LearningRateSchedule::calculate_learning_rate_factor(const double& epoch) const
+{
+   const double pi = 3.14159265358979323846;
+
+   double factor = 1.0;
+
+   switch(schedule_method)
+   {
+      case Constant:
+      {
+         factor = 1.0;
+
+         break;
+      }
+
+      case Step:
+      {
+         factor = pow(decay_rate, floor(epoch/step_epochs));
+
+         break;
+      }
+
+      case Exponential:
+      {
+         factor = pow(decay_rate, epoch);
+
+         break;
+      }
+
+      case CosineAnnealing:
+      {
+         double period = period_epochs;
+         double period_epoch = epoch;
+
+         if(period_multiplier <= 1.0)
+         {
+            period_epoch = fmod(epoch, period);
+         }
+         else
+         {
+            while(period_epoch >= period)
+            {
+               period_epoch -= period;
+               period *= period_multiplier;
+            }
+         }
+
+         factor = minimum_factor + (1.0 - minimum_factor)*0.5*(1.0 + cos(pi*period_epoch/period));
+
+         break;
+      }
+
+      case OneCycle:
+      {
+         // The learning rate increases during the first 30% of the cycle and then it is annealed
+
+         const double rising_epochs = 0.3*period_epochs;
+
+         if(epoch < rising_epochs)
+         {
+            factor = 1.0 + (maximum_factor - 1.0)*epoch/rising_epochs;
+         }
+         else if(epoch < period_epochs)
+         {
+            const double annealing_fraction = (epoch - rising_epochs)/(period_epochs - rising_epochs);
+
+            factor = minimum_factor + (maximum_factor - minimum_factor)*0.5*(1.0 + cos(pi*annealing_fraction));
+         }
+         else
+         {
+            factor = minimum_factor;
+         }
+
+         break;
+      }
+
+      case ReduceOnPlateau:
+      {
+         factor = plateau_factor;
+
+         break;
+      }
+   }
+
+   if(warmup_epochs > 0.0 && epoch < warmup_epochs)
+   {
+      factor *= epoch/warmup_epochs;
+   }
+
+   return factor;
+}
+
+
+/// Passes the selection error of the last epoch to the schedule.
+/// The plateau schedule decays the learning rate when the selection error has not improved for a number of epochs.
+/// The other schedules ignore it.
+/// @param selection_error Selection error of the neural network at the end of an epoch.
+
+void LearningRateSchedule::update_selection_error(const double& selection_error)
+{
+   if(schedule_method != ReduceOnPlateau) return;
+
+   if(selection_error < minimum_selection_error)
+   {
+      minimum_selection_error = selection_error;
+
+      selection_failures = 0;
+
+      return;
+   }
+
+   selection_failures++;
+
+   if(selection_failures >= patience)
+   {
+      plateau_factor = max(plateau_factor*decay_rate, minimum_factor);
+
+      selection_failures = 0;
+   }
+}
+
+
+/// Writes as matrix of strings the most representative atributes.
+
+Matrix<string> LearningRateSchedule::to_string_matrix() const
+{
+   ostringstream buffer;
+
+   Vector<string> labels;
+   Vector<string> values;
+
+   // Schedule method
+
+   labels.push_back("Learning rate schedule");
+
+   values.push_back(write_schedule_method());
+
+   // Warmup epochs
+
+   labels.push_back("Warmup epochs");
+
+   buffer.str("");
+   buffer << warmup_epochs;
+
+   values.push_back(buffer.str());
+
+   const size_t rows_number = labels.size();
+   const size_t columns_number = 2;
+
+   Matrix<string> string_matrix(rows_number, columns_number);
+
+   string_matrix.set_column(0, labels, "name");
+   string_matrix.set_column(1, values, "value");
+
+   return string_matrix;
+}
+
+
+/// Serializes the learning rate schedule object into a XML document of the TinyXML library.
+/// See the OpenNN manual for more information about the format of this document.
+
+tinyxml2::XMLDocument* LearningRateSchedule::to_XML() const
+{
+   ostringstream buffer;
+
+   tinyxml2::XMLDocument* document = new tinyxml2::XMLDocument;
+
+   tinyxml2::XMLElement* root_element = document->NewElement("LearningRateSchedule");
+
+   document->InsertFirstChild(root_element);
+
+   tinyxml2::XMLElement* element = nullptr;
+   tinyxml2::XMLText* text = nullptr;
+
+   // Schedule method
+
+   element = document->NewElement("ScheduleMethod");
+   root_element->LinkEndChild(element);
+
+   text = document->NewText(write_schedule_method().c_str());
+   element->LinkEndChild(text);
+
+   // Warmup epochs
+
+   element = document->NewElement("WarmupEpochs");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << warmup_epochs;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Step epochs
+
+   element = document->NewElement("StepEpochs");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << step_epochs;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Decay rate
+
+   element = document->NewElement("DecayRate");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << decay_rate;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Period epochs
+
+   element = document->NewElement("PeriodEpochs");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << period_epochs;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Period multiplier
+
+   element = document->NewElement("PeriodMultiplier");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << period_multiplier;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Minimum factor
+
+   element = document->NewElement("MinimumFactor");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << minimum_factor;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Maximum factor
+
+   element = document->NewElement("MaximumFactor");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << maximum_factor;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Patience
+
+   element = document->NewElement("Patience");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << patience;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   return document;
+}
+
+
+/// Serializes the learning rate schedule object into a XML document of the TinyXML library without keep the DOM tree in memory.
+/// See the OpenNN manual for more information about the format of this document.
+
+void LearningRateSchedule::write_XML(tinyxml2::XMLPrinter& file_stream) const
+{
+   ostringstream buffer;
+
+   file_stream.OpenElement("LearningRateSchedule");
+
+   // Schedule method
+
+   file_stream.OpenElement("ScheduleMethod");
+
+   file_stream.PushText(write_schedule_method().c_str());
+
+   file_stream.CloseElement();
+
+   // Warmup epochs
+
+   file_stream.OpenElement("WarmupEpochs");
+
+   buffer.str("");
+   buffer << warmup_epochs;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   // Step epochs
+
+   file_stream.OpenElement("StepEpochs");
+
+   buffer.str("");
+   buffer << step_epochs;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   // Decay rate
+
+   file_stream.OpenElement("DecayRate");
+
+   buffer.str("");
+   buffer << decay_rate;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   // Period epochs
+
+   file_stream.OpenElement("PeriodEpochs");
+
+   buffer.str("");
+   buffer << period_epochs;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   // Period multiplier
+
+   file_stream.OpenElement("PeriodMultiplier");
+
+   buffer.str("");
+   buffer << period_multiplier;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   // Minimum factor
+
+   file_stream.OpenElement("MinimumFactor");
+
+   buffer.str("");
+   buffer << minimum_factor;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   // Maximum factor
+
+   file_stream.OpenElement("MaximumFactor");
+
+   buffer.str("");
+   buffer << maximum_factor;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   // Patience
+
+   file_stream.OpenElement("Patience");
+
+   buffer.str("");
+   buffer << patience;
+
+   file_stream.PushText(buffer.str().c_str());
+
+   file_stream.CloseElement();
+
+   file_stream.CloseElement();
+}
+
+
+/// Loads a learning rate schedule object from a XML document.
+/// @param document TinyXML document containing the members of the object.
+
+void LearningRateSchedule::from_XML(const tinyxml2::XMLDocument& document)
+{
+   const tinyxml2::XMLElement* root_element = document.FirstChildElement("LearningRateSchedule");
+
+   if(!root_element)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LearningRateSchedule class.\n"
+             << "void from_XML(const tinyxml2::XMLDocument&) method.\n"
+             << "Learning rate schedule element is nullptr.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   // Schedule method
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("ScheduleMethod");
+
+      if(element)
+      {
+         const string new_schedule_method = element->GetText();
+
+         try
+         {
+            set_schedule_method(new_schedule_method);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Warmup epochs
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarmupEpochs");
+
+      if(element)
+      {
+         const double new_warmup_epochs = atof(element->GetText());
+
+         try
+         {
+            set_warmup_epochs(new_warmup_epochs);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Step epochs
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("StepEpochs");
+
+      if(element)
+      {
+         const double new_step_epochs = atof(element->GetText());
+
+         try
+         {
+            set_step_epochs(new_step_epochs);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Decay rate
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("DecayRate");
+
+      if(element)
+      {
+         const double new_decay_rate = atof(element->GetText());
+
+         try
+         {
+            set_decay_rate(new_decay_rate);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Period epochs
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("PeriodEpochs");
+
+      if(element)
+      {
+         const double new_period_epochs = atof(element->GetText());
+
+         try
+         {
+            set_period_epochs(new_period_epochs);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Period multiplier
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("PeriodMultiplier");
+
+      if(element)
+      {
+         const double new_period_multiplier = atof(element->GetText());
+
+         try
+         {
+            set_period_multiplier(new_period_multiplier);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Minimum factor
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("MinimumFactor");
+
+      if(element)
+      {
+         const double new_minimum_factor = atof(element->GetText());
+
+         try
+         {
+            set_minimum_factor(new_minimum_factor);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Maximum factor
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumFactor");
+
+      if(element)
+      {
+         const double new_maximum_factor = atof(element->GetText());
+
+         try
+         {
+            set_maximum_factor(new_maximum_factor);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+
+   // Patience
+   {
+      const tinyxml2::XMLElement* element = root_element->FirstChildElement("Patience");
+
+      if(element)
+      {
+         const size_t new_patience = static_cast<size_t>(atoi(element->GetText()));
+
+         try
+         {
+            set_patience(new_patience);
+         }
+         catch(const logic_error& e)
+         {
+            cerr << e.what() << endl;
+         }
+      }
+   }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
@@ -0,0 +1,183 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   L E A R N I N G   R A T E   S C H E D U L E   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef LEARNINGRATESCHEDULE_H
+#define LEARNINGRATESCHEDULE_H
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+#include "tinyxml2.h"
+
+namespace OpenNN
+{
+
+/// This class is used by the stochastic optimization algorithms to vary the learning rate along the training.
+
+///
+/// It returns, for a given epoch, the factor by which the initial learning rate is multiplied.
+/// The epoch can be fractional, so that the learning rate also changes between the batches of an epoch.
+/// Step, exponential, cosine annealing with warm restarts, one cycle and plateau based schedules are implemented,
+/// and any of them can be preceded by a linear warmup.
+///
+/// \cite 1 I. Loshchilov and F. Hutter, "SGDR: Stochastic Gradient Descent with Warm Restarts." arXiv preprint arXiv:1608.03983 (2016).
+///
+/// \cite 2 L. N. Smith and N. Topin, "Super-Convergence: Very Fast Training of Neural Networks Using Large Learning Rates." arXiv preprint arXiv:1708.07120 (2017).
+
+class LearningRateSchedule
+{
+
+public:
+
+   // Enumerations
+
+   /// Available schedules for the learning rate.
+
+   enum ScheduleMethod{Constant, Step, Exponential, CosineAnnealing, OneCycle, ReduceOnPlateau};
+
+   // Constructors
+
+   explicit LearningRateSchedule();
+
+   explicit LearningRateSchedule(const tinyxml2::XMLDocument&);
+
+   // Destructor
+
+   virtual ~LearningRateSchedule();
+
+   // Get methods
+
+   const ScheduleMethod& get_schedule_method() const;
+   string write_schedule_method() const;
+
+   const double& get_warmup_epochs() const;
+   const double& get_step_epochs() const;
+   const double& get_decay_rate() const;
+   const double& get_period_epochs() const;
+   const double& get_period_multiplier() const;
+   const double& get_minimum_factor() const;
+   const double& get_maximum_factor() const;
+   const size_t& get_patience() const;
+
+   // Set methods
+
+   void set_default();
+
+   void set_schedule_method(const ScheduleMethod&);
+   void set_schedule_method(const string&);
+
+   void set_warmup_epochs(const double&);
+   void set_step_epochs(const double&);
+   void set_decay_rate(const double&);
+   void set_period_epochs(const double&);
+   void set_period_multiplier(const double&);
+   void set_minimum_factor(const double&);
+   void set_maximum_factor(const double&);
+   void set_patience(const size_t&);
+
+   // Schedule methods
+
+   void reset();
+
+   double calculate_learning_rate_factor(const double&) const;
+
+   void update_selection_error(const double&);
+
+   // Serialization methods
+
+   Matrix<string> to_string_matrix() const;
+
+   tinyxml2::XMLDocument* to_XML() const;
+   void from_XML(const tinyxml2::XMLDocument&);
+
+   void write_XML(tinyxml2::XMLPrinter&) const;
+
+private:
+
+   /// Schedule used for the learning rate.
+
+   ScheduleMethod schedule_method;
+
+   /// Number of epochs during which the learning rate grows linearly from zero.
+
+   double warmup_epochs;
+
+   /// Number of epochs between two decays of the step schedule.
+
+   double step_epochs;
+
+   /// Factor by which the learning rate is multiplied at each decay of the step, exponential and plateau schedules.
+
+   double decay_rate;
+
+   /// Number of epochs of the first cosine annealing period, or of the one cycle schedule.
+
+   double period_epochs;
+
+   /// Factor by which each cosine annealing period is longer than the previous one.
+
+   double period_multiplier;
+
+   /// Lowest fraction of the initial learning rate reached by the cosine annealing, one cycle and plateau schedules.
+
+   double minimum_factor;
+
+   /// Peak fraction of the initial learning rate reached by the one cycle schedule.
+
+   double maximum_factor;
+
+   /// Number of epochs without improvement of the selection error after which the plateau schedule decays the learning rate.
+
+   size_t patience;
+
+   // Plateau state
+
+   /// Current fraction of the initial learning rate of the plateau schedule.
+
+   double plateau_factor;
+
+   /// Lowest selection error seen by the plateau schedule since the last reset.
+
+   double minimum_selection_error;
+
+   /// Number of epochs since the selection error last improved, or since the last decay.
+
+   size_t selection_failures;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
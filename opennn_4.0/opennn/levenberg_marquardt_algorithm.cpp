@@ -213,6 +213,22 @@ const double& LevenbergMarquardtAlgorithm::get_maximum_damping_parameter() const
 }
 
 
+/// Returns true if the steps are computed without forming the Hessian approximation, and false otherwise.
+
+const bool& LevenbergMarquardtAlgorithm::get_matrix_free() const
+{
+   return(matrix_free);
+}
+
+
+/// Returns the maximum number of conjugate gradient iterations per step in the matrix-free mode.
+
+const size_t& LevenbergMarquardtAlgorithm::get_maximum_conjugate_gradient_iterations() const
+{
+   return(maximum_conjugate_gradient_iterations);
+}
+
+
 /// Sets the following default values for the Levenberg-Marquardt algorithm:
 /// Training parameters:
 /// <ul>
@@ -273,6 +289,9 @@ void LevenbergMarquardtAlgorithm::set_default()
 
    minimum_damping_parameter = 1.0e-6;
    maximum_damping_parameter = 1.0e6;
+
+   matrix_free = false;
+   maximum_conjugate_gradient_iterations = 50;
 }
 
 
@@ -368,6 +387,41 @@ void LevenbergMarquardtAlgorithm::set_maximum_damping_parameter(const double& ne
 }
 
 
+/// Makes the steps to be computed with or without forming the Hessian approximation.
+/// In the matrix-free mode the damped system is solved with preconditioned conjugate gradients,
+/// which only need products by the Jacobian of the error terms of one batch at a time.
+/// @param new_matrix_free True if the Hessian approximation is not to be formed, false otherwise.
+
+void LevenbergMarquardtAlgorithm::set_matrix_free(const bool& new_matrix_free)
+{
+   matrix_free = new_matrix_free;
+}
+
+
+/// Sets a new maximum number of conjugate gradient iterations per step in the matrix-free mode.
+/// @param new_maximum_conjugate_gradient_iterations Maximum number of conjugate gradient iterations.
+
+void LevenbergMarquardtAlgorithm::set_maximum_conjugate_gradient_iterations(const size_t& new_maximum_conjugate_gradient_iterations)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_maximum_conjugate_gradient_iterations == 0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: LevenbergMarquardtAlgorithm class." << endl
+             << "void set_maximum_conjugate_gradient_iterations(const size_t&) method." << endl
+             << "Maximum number of conjugate gradient iterations must be greater than zero." << endl;
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   maximum_conjugate_gradient_iterations = new_maximum_conjugate_gradient_iterations;
+}
+
+
 /// Sets a new value for the parameters vector norm at which a warning message is written to the 
 /// screen. 
 /// @param new_warning_parameters_norm Warning norm of parameters vector value. 
@@ -796,7 +850,23 @@ OptimizationAlgorithm::Results LevenbergMarquardtAlgorithm::perform_training()
 
       // Loss index 
 
-      LossIndex::SecondOrderLoss terms_second_order_loss = loss_index_pointer->calculate_terms_second_order_loss();
+      LossIndex::SecondOrderLoss terms_second_order_loss;
+
+      Vector<double> hessian_diagonal;
+
+      if(matrix_free)
+      {
+          const LossIndex::FirstOrderLoss first_order_loss = loss_index_pointer->calculate_first_order_loss();
+
+          terms_second_order_loss.loss = first_order_loss.loss;
+          terms_second_order_loss.gradient = first_order_loss.gradient;
+
+          hessian_diagonal = loss_index_pointer->calculate_terms_hessian_diagonal();
+      }
+      else
+      {
+          terms_second_order_loss = loss_index_pointer->calculate_terms_second_order_loss();
+      }
 
       training_loss = terms_second_order_loss.loss;
 
@@ -809,9 +879,16 @@ OptimizationAlgorithm::Results LevenbergMarquardtAlgorithm::perform_training()
 
       do
       {        
-         terms_second_order_loss.hessian.sum_diagonal(damping_parameter);
+         if(matrix_free)
+         {
+             parameters_increment = perform_preconditioned_conjugate_gradient(terms_second_order_loss.gradient, hessian_diagonal);
+         }
+         else
+         {
+             terms_second_order_loss.hessian.sum_diagonal(damping_parameter);
 
-         parameters_increment = perform_Householder_QR_decomposition(terms_second_order_loss.hessian, terms_second_order_loss.gradient*(-1.0));
+             parameters_increment = perform_Cholesky_decomposition(terms_second_order_loss.hessian, terms_second_order_loss.gradient*(-1.0));
+         }
 
          const double new_loss = loss_index_pointer->calculate_training_loss(parameters+parameters_increment);
 
@@ -829,7 +906,8 @@ OptimizationAlgorithm::Results LevenbergMarquardtAlgorithm::perform_training()
          }
          else
          {
-             terms_second_order_loss.hessian.sum_diagonal(-damping_parameter);
+             if(!matrix_free) terms_second_order_loss.hessian.sum_diagonal(-damping_parameter);
+
              set_damping_parameter(damping_parameter*damping_parameter_factor);
          }
       }while(damping_parameter < maximum_damping_parameter);
@@ -1155,6 +1233,23 @@ Matrix<string> LevenbergMarquardtAlgorithm::to_string_matrix() const
 
    values.push_back(buffer.str());
 
+   // Matrix free
+
+   labels.push_back("Matrix free");
+
+   buffer.str("");
+
+   if(matrix_free)
+   {
+       buffer << "true";
+   }
+   else
+   {
+       buffer << "false";
+   }
+
+   values.push_back(buffer.str());
+
    // Reserve training error history
 
    labels.push_back("Reserve training error history");
@@ -1282,6 +1377,28 @@ tinyxml2::XMLDocument* LevenbergMarquardtAlgorithm::to_XML() const
       text = document->NewText(buffer.str().c_str());
       element->LinkEndChild(text);
 
+   // Matrix free
+
+   element = document->NewElement("MatrixFree");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << matrix_free;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Maximum conjugate gradient iterations
+
+   element = document->NewElement("MaximumConjugateGradientIterations");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << maximum_conjugate_gradient_iterations;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
    // Warning parameters norm
 
 //   element = document->NewElement("WarningParametersNorm");
@@ -1518,6 +1635,28 @@ void LevenbergMarquardtAlgorithm::write_XML(tinyxml2::XMLPrinter& file_stream) c
            file_stream.CloseElement();
        }
 
+    // Matrix free
+
+    file_stream.OpenElement("MatrixFree");
+
+    buffer.str("");
+    buffer << matrix_free;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Maximum conjugate gradient iterations
+
+    file_stream.OpenElement("MaximumConjugateGradientIterations");
+
+    buffer.str("");
+    buffer << maximum_conjugate_gradient_iterations;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Minimum parameters increment norm
 
     file_stream.OpenElement("MinimumParametersIncrementNorm");
@@ -1818,6 +1957,42 @@ void LevenbergMarquardtAlgorithm::from_XML(const tinyxml2::XMLDocument& document
        }
    }
 
+   // Matrix free
+
+   const tinyxml2::XMLElement* matrix_free_element = root_element->FirstChildElement("MatrixFree");
+
+   if(matrix_free_element)
+   {
+       const string new_matrix_free = matrix_free_element->GetText();
+
+       try
+       {
+           set_matrix_free(new_matrix_free != "0");
+       }
+       catch(const logic_error& e)
+       {
+           cerr << e.what() << endl;
+       }
+   }
+
+   // Maximum conjugate gradient iterations
+
+   const tinyxml2::XMLElement* maximum_conjugate_gradient_iterations_element = root_element->FirstChildElement("MaximumConjugateGradientIterations");
+
+   if(maximum_conjugate_gradient_iterations_element)
+   {
+       const size_t new_maximum_conjugate_gradient_iterations = static_cast<size_t>(atoi(maximum_conjugate_gradient_iterations_element->GetText()));
+
+       try
+       {
+           set_maximum_conjugate_gradient_iterations(new_maximum_conjugate_gradient_iterations);
+       }
+       catch(const logic_error& e)
+       {
+           cerr << e.what() << endl;
+       }
+   }
+
    // Minimum parameters increment norm
 
    const tinyxml2::XMLElement* minimum_parameters_increment_norm_element = root_element->FirstChildElement("MinimumParametersIncrementNorm");
@@ -2073,6 +2248,94 @@ Vector<double> LevenbergMarquardtAlgorithm::perform_Householder_QR_decomposition
     return x;
 }
 
+
+/// Uses Eigen to solve a symmetric positive definite system of equations by means of the Cholesky decomposition.
+/// Only the lower triangle of the matrix is referenced.
+/// If the matrix is not numerically positive definite, the system is solved by means of the Householder QR decomposition.
+
+Vector<double> LevenbergMarquardtAlgorithm::perform_Cholesky_decomposition(const Matrix<double>& A, const Vector<double>& b) const
+{
+    const size_t n = A.get_rows_number();
+
+    Vector<double> x(n);
+
+    const Eigen::Map<Eigen::MatrixXd> A_eigen((double*)A.data(), static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(n));
+    const Eigen::Map<Eigen::VectorXd> b_eigen((double*)b.data(), static_cast<Eigen::Index>(n));
+    Eigen::Map<Eigen::VectorXd> x_eigen(x.data(), static_cast<Eigen::Index>(n));
+
+    const Eigen::LLT<Eigen::MatrixXd, Eigen::Lower> llt(A_eigen);
+
+    if(llt.info() != Eigen::Success) return perform_Householder_QR_decomposition(A, b);
+
+    x_eigen = llt.solve(b_eigen);
+
+    return x;
+}
+
+
+/// Solves the damped Gauss-Newton system (H + lambda*I)*x = -g without forming the Hessian approximation H,
+/// by means of the conjugate gradient method preconditioned with the diagonal of the damped system.
+/// Each iteration needs a product by the Hessian approximation, which the loss index computes from the Jacobian of the error terms.
+/// The iterations stop when the residual norm falls below min(0.5, sqrt(|g|))*|g|,
+/// or after the maximum number of conjugate gradient iterations.
+/// @param gradient Gradient of the loss index.
+/// @param hessian_diagonal Diagonal of the Hessian approximation.
+
+Vector<double> LevenbergMarquardtAlgorithm::perform_preconditioned_conjugate_gradient(const Vector<double>& gradient,
+                                                                                      const Vector<double>& hessian_diagonal) const
+{
+    const size_t parameters_number = gradient.size();
+
+    Vector<double> parameters_increment(parameters_number, 0.0);
+
+    Vector<double> preconditioner(parameters_number);
+
+    for(size_t i = 0; i < parameters_number; i++)
+    {
+        preconditioner[i] = 1.0/(hessian_diagonal[i] + damping_parameter);
+    }
+
+    Vector<double> residual = gradient*(-1.0);
+
+    Vector<double> preconditioned_residual = residual*preconditioner;
+
+    Vector<double> direction = preconditioned_residual;
+
+    double residual_product = dot(residual, preconditioned_residual);
+
+    const double gradient_norm = l2_norm(gradient);
+
+    const double tolerance = min(0.5, sqrt(gradient_norm))*gradient_norm;
+
+    for(size_t i = 0; i < maximum_conjugate_gradient_iterations; i++)
+    {
+        if(l2_norm(residual) <= tolerance) break;
+
+        const Vector<double> hessian_direction
+                = loss_index_pointer->calculate_terms_hessian_product(direction) + direction*damping_parameter;
+
+        const double curvature = dot(direction, hessian_direction);
+
+        if(curvature <= 0.0) break;
+
+        const double step = residual_product/curvature;
+
+        parameters_increment += direction*step;
+
+        residual -= hessian_direction*step;
+
+        preconditioned_residual = residual*preconditioner;
+
+        const double new_residual_product = dot(residual, preconditioned_residual);
+
+        direction = preconditioned_residual + direction*(new_residual_product/residual_product);
+
+        residual_product = new_residual_product;
+    }
+
+    return parameters_increment;
+}
+
 }
 
 // OpenNN: Open Neural Networks Library.
@@ -93,6 +93,9 @@ public:
 
    const Vector<double>& get_damping_parameter_history() const;
 
+   const bool& get_matrix_free() const;
+   const size_t& get_maximum_conjugate_gradient_iterations() const;
+
    // Set methods
 
    void set_default();
@@ -104,6 +107,9 @@ public:
    void set_minimum_damping_parameter(const double&);
    void set_maximum_damping_parameter(const double&);
 
+   void set_matrix_free(const bool&);
+   void set_maximum_conjugate_gradient_iterations(const size_t&);
+
    // Training parameters
 
    void set_warning_parameters_norm(const double&);
@@ -161,6 +167,10 @@ public:
    
    Vector<double> perform_Householder_QR_decomposition(const Matrix<double>&, const Vector<double>&) const;
 
+   Vector<double> perform_Cholesky_decomposition(const Matrix<double>&, const Vector<double>&) const;
+
+   Vector<double> perform_preconditioned_conjugate_gradient(const Vector<double>&, const Vector<double>&) const;
+
 private:
 
    // MEMBERS
@@ -181,6 +191,15 @@ private:
 
    double damping_parameter_factor;
 
+   /// True if the damped system is solved with preconditioned conjugate gradients from products by the Jacobian,
+   /// without forming the Hessian approximation, false otherwise.
+
+   bool matrix_free;
+
+   /// Maximum number of conjugate gradient iterations per step in the matrix-free mode.
+
+   size_t maximum_conjugate_gradient_iterations;
+
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
    double warning_parameters_norm;
@@ -50,6 +50,8 @@ LongShortTermMemoryLayer::LongShortTermMemoryLayer(const size_t& new_inputs_numb
 LongShortTermMemoryLayer::LongShortTermMemoryLayer(const LongShortTermMemoryLayer& other_neuron_layer) : Layer()
 {
    set(other_neuron_layer);
+
+   layer_type = LongShortTermMemory;
 }
 
 
@@ -278,6 +280,22 @@ size_t LongShortTermMemoryLayer::get_timesteps() const
 }
 
 
+/// Returns the hidden states of the layer, which are its outputs for the last instance processed.
+
+Vector<double> LongShortTermMemoryLayer::get_hidden_states() const
+{
+    return hidden_states;
+}
+
+
+/// Returns the cell states of the layer after the last instance processed.
+
+Vector<double> LongShortTermMemoryLayer::get_cell_states() const
+{
+    return cell_states;
+}
+
+
 /// Returns a single vector with all the layer parameters. 
 /// The format is a vector of real values. 
 /// The size is the number of parameters in the layer. 
@@ -1272,57 +1290,131 @@ Tensor<double> LongShortTermMemoryLayer::calculate_activations_states(const Tens
     const size_t instances_number = inputs.get_dimension(0);
     const size_t neurons_number = get_neurons_number();
 
+    const Tensor<double> sequences_states = calculate_sequences_states(inputs, get_biases(), get_weights(), get_recurrent_weights());
+
     // forget activations, input activations, state activations, output activations, state, hidden state
+
     Tensor<double> activations_states(instances_number,neurons_number,6);
 
-    size_t forget_activations_index = 0;
-    size_t input_activations_index = instances_number*neurons_number;
-    size_t state_activations_index = 2*instances_number*neurons_number;
-    size_t output_activations_index = 3*instances_number*neurons_number;
-    size_t states_index = 4*instances_number*neurons_number;
-    size_t hidden_states_index = 5*instances_number*neurons_number;
+    activations_states.set_matrix(0, calculate_recurrent_activations(Tensor<double>(sequences_states.get_matrix(0))).to_matrix());
+    activations_states.set_matrix(1, calculate_recurrent_activations(Tensor<double>(sequences_states.get_matrix(1))).to_matrix());
+    activations_states.set_matrix(2, calculate_activations(Tensor<double>(sequences_states.get_matrix(2))).to_matrix());
+    activations_states.set_matrix(3, calculate_recurrent_activations(Tensor<double>(sequences_states.get_matrix(3))).to_matrix());
+    activations_states.set_matrix(4, sequences_states.get_matrix(4));
+    activations_states.set_matrix(5, sequences_states.get_matrix(5));
+
+    return activations_states;
+}
+
+
+/// Propagates a batch made of independent sequences through the layer.
+/// The rows of the inputs are arranged sequence by sequence, each sequence having timesteps rows
+/// (the last one might be shorter).
+/// The hidden and cell states are reset at the beginning of each sequence,
+/// and all the sequences are propagated together at each time step.
+/// The weights of the four gates are joined, so that each time step needs a single matrix-matrix product for the inputs
+/// and another one for the hidden states.
+/// It returns a tensor with dimensions instances, neurons and 6, which contains the forget, input, state and output combinations,
+/// the cell states and the hidden states.
+/// @param inputs Layer inputs, with one row per time step.
+/// @param new_biases Biases of the layer, with one column per gate.
+/// @param new_weights Weights of the layer, with one matrix per gate.
+/// @param new_recurrent_weights Recurrent weights of the layer, with one matrix per gate.
+
+Tensor<double> LongShortTermMemoryLayer::calculate_sequences_states(const Tensor<double>& inputs,
+                                                                    const Matrix<double>& new_biases,
+                                                                    const Tensor<double>& new_weights,
+                                                                    const Tensor<double>& new_recurrent_weights)
+{
+    const size_t instances_number = inputs.get_dimension(0);
+    const size_t inputs_number = inputs.get_dimension(1);
+
+    const size_t neurons_number = new_biases.get_rows_number();
+
+    Tensor<double> sequences_states(instances_number, neurons_number, 6);
+
+    if(instances_number == 0) return sequences_states;
+
+    const size_t sequences_number = (instances_number + timesteps - 1)/timesteps;
+
+    Matrix<double> gates_weights(inputs_number, 4*neurons_number);
+    copy(new_weights.begin(), new_weights.end(), gates_weights.begin());
+
+    Matrix<double> gates_recurrent_weights(neurons_number, 4*neurons_number);
+    copy(new_recurrent_weights.begin(), new_recurrent_weights.end(), gates_recurrent_weights.begin());
 
-    for(size_t i = 0; i < instances_number; i++)
+    Tensor<double> current_inputs(sequences_number, inputs_number);
+
+    Tensor<double> current_cell_states(Vector<size_t>({sequences_number, neurons_number}), 0.0);
+    Tensor<double> current_hidden_states(Vector<size_t>({sequences_number, neurons_number}), 0.0);
+
+    Tensor<double> forget_combinations(sequences_number, neurons_number);
+    Tensor<double> input_combinations(sequences_number, neurons_number);
+    Tensor<double> state_combinations(sequences_number, neurons_number);
+    Tensor<double> output_combinations(sequences_number, neurons_number);
+
+    size_t instance_index;
+
+    for(size_t step = 0; step < timesteps; step++)
     {
-        if(i%timesteps == 0)
+        // The last sequence might be shorter, and then it is padded with zeros
+
+        for(size_t j = 0; j < inputs_number; j++)
         {
-            hidden_states.initialize(0.0);
-            cell_states.initialize(0.0);
+            for(size_t i = 0; i < sequences_number; i++)
+            {
+                instance_index = i*timesteps+step;
+
+                current_inputs(i,j) = instance_index < instances_number ? inputs(instance_index, j) : 0.0;
+            }
         }
 
-        const Vector<double> current_inputs = inputs.get_row(i);
+        const Tensor<double> gates_combinations = dot(current_inputs, gates_weights) + dot(current_hidden_states, gates_recurrent_weights);
 
-        const Vector<double> forget_combinations = calculate_forget_combinations(current_inputs);
-        const Vector<double> forget_activations = calculate_recurrent_activations(forget_combinations);
+        for(size_t j = 0; j < neurons_number; j++)
+        {
+            for(size_t i = 0; i < sequences_number; i++)
+            {
+                forget_combinations(i,j) = gates_combinations(i, j) + new_biases(j,0);
+                input_combinations(i,j) = gates_combinations(i, neurons_number+j) + new_biases(j,1);
+                state_combinations(i,j) = gates_combinations(i, 2*neurons_number+j) + new_biases(j,2);
+                output_combinations(i,j) = gates_combinations(i, 3*neurons_number+j) + new_biases(j,3);
+            }
+        }
 
-        const Vector<double> input_combinations = calculate_input_combinations(current_inputs);
-        const Vector<double> input_activations = calculate_recurrent_activations(input_combinations);
+        current_cell_states = calculate_recurrent_activations(forget_combinations)*current_cell_states
+                            + calculate_recurrent_activations(input_combinations)*calculate_activations(state_combinations);
 
-        const Vector<double> state_combinations = calculate_state_combinations(current_inputs);
-        const Vector<double> state_activations = calculate_activations(state_combinations);
+        current_hidden_states = calculate_recurrent_activations(output_combinations)*calculate_activations(current_cell_states);
 
-        const Vector<double> output_combinations = calculate_output_combinations(current_inputs);
-        const Vector<double> output_activations = calculate_recurrent_activations(output_combinations);
+        for(size_t j = 0; j < neurons_number; j++)
+        {
+            for(size_t i = 0; i < sequences_number; i++)
+            {
+                instance_index = i*timesteps+step;
 
-        cell_states = forget_activations * cell_states + input_activations * state_activations;
-        hidden_states = output_activations * calculate_activations(cell_states);
+                if(instance_index >= instances_number) continue;
 
-        activations_states.embed(forget_activations_index, forget_activations);
-        activations_states.embed(input_activations_index, input_activations);
-        activations_states.embed(state_activations_index, state_activations);
-        activations_states.embed(output_activations_index, output_activations);
-        activations_states.embed(states_index, cell_states);
-        activations_states.embed(hidden_states_index, hidden_states);
+                sequences_states(instance_index, j, 0) = forget_combinations(i,j);
+                sequences_states(instance_index, j, 1) = input_combinations(i,j);
+                sequences_states(instance_index, j, 2) = state_combinations(i,j);
+                sequences_states(instance_index, j, 3) = output_combinations(i,j);
+                sequences_states(instance_index, j, 4) = current_cell_states(i,j);
+                sequences_states(instance_index, j, 5) = current_hidden_states(i,j);
+            }
+        }
+    }
+
+    cell_states.set(neurons_number);
+    hidden_states.set(neurons_number);
 
-        forget_activations_index ++; //= neurons_number;
-        input_activations_index ++; //= neurons_number;
-        state_activations_index ++; //= neurons_number;
-        output_activations_index ++; //= neurons_number;
-        states_index ++; //= neurons_number;
-        hidden_states_index ++; //= neurons_number;
+    for(size_t j = 0; j < neurons_number; j++)
+    {
+        cell_states[j] = sequences_states(instances_number-1, j, 4);
+        hidden_states[j] = sequences_states(instances_number-1, j, 5);
     }
 
-    return activations_states;
+    return sequences_states;
 }
 
 
@@ -1480,7 +1572,7 @@ Tensor<double> LongShortTermMemoryLayer::calculate_recurrent_activations(const T
 
     const size_t neurons_number = get_neurons_number();
 
-    const size_t combinations_columns_number = combinations.get_dimension(2);
+    const size_t combinations_columns_number = combinations.get_dimension(1);
 
     if(combinations_columns_number != neurons_number)
     {
@@ -1770,6 +1862,79 @@ Vector<double> LongShortTermMemoryLayer::calculate_activations_derivatives(const
     return Vector<double>();
 }
 
+Tensor<double> LongShortTermMemoryLayer::calculate_recurrent_activations_derivatives(const Tensor<double>& combinations) const
+{
+    #ifdef __OPENNN_DEBUG__
+
+    const size_t neurons_number = get_neurons_number();
+
+    const size_t combinations_columns_number = combinations.get_dimension(1);
+
+    if(combinations_columns_number != neurons_number)
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: LongShortTermMemoryLayer class.\n"
+              << "Tensor<double> calculate_recurrent_activations_derivatives(const Tensor<double>&) const method.\n"
+              << "Number of columns("<< combinations_columns_number <<") of combinations must be equal to number of neurons("<<neurons_number<<").\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    switch(recurrent_activation_function)
+    {
+        case Linear:
+        {
+             return linear_derivatives(combinations);
+        }
+        case Logistic:
+        {
+             return logistic_derivatives(combinations);
+        }
+        case HyperbolicTangent:
+        {
+             return hyperbolic_tangent_derivatives(combinations);
+        }
+        case Threshold:
+        {
+             return threshold_derivatives(combinations);
+        }
+        case SymmetricThreshold:
+        {
+             return symmetric_threshold_derivatives(combinations);
+        }
+        case RectifiedLinear:
+        {
+             return rectified_linear_derivatives(combinations);
+        }
+        case ScaledExponentialLinear:
+        {
+             return scaled_exponential_linear_derivatives(combinations);
+        }
+        case SoftPlus:
+        {
+             return soft_plus_derivatives(combinations);
+        }
+        case SoftSign:
+        {
+             return soft_sign_derivatives(combinations);
+        }
+        case HardSigmoid:
+        {
+             return hard_sigmoid_derivatives(combinations);
+        }
+        case ExponentialLinear:
+        {
+             return exponential_linear_derivatives(combinations);
+        }
+    }
+
+    return Tensor<double>();
+}
+
+
 Vector<double> LongShortTermMemoryLayer::calculate_recurrent_activations_derivatives(const Vector<double>& combination) const
 {
     #ifdef __OPENNN_DEBUG__
@@ -1870,7 +2035,7 @@ void LongShortTermMemoryLayer::update_cell_states(const Vector<double>& inputs)
     const Vector<double> input_activations = calculate_recurrent_activations(input_combinations);
 
     const Vector<double> state_combinations = calculate_state_combinations(inputs);
-    const Vector<double> state_activations = calculate_recurrent_activations(state_combinations);
+    const Vector<double> state_activations = calculate_activations(state_combinations);
 
     cell_states = forget_activations * cell_states + input_activations*state_activations;
 }
@@ -1897,7 +2062,7 @@ void LongShortTermMemoryLayer::update_hidden_states(const Vector<double>& inputs
 
     const Vector<double> output_combinations = calculate_output_combinations(inputs);
 
-    const Vector<double> output_activations = calculate_activations(output_combinations);
+    const Vector<double> output_activations = calculate_recurrent_activations(output_combinations);
 
     hidden_states = output_activations*calculate_activations(cell_states);
 }
@@ -1905,6 +2070,22 @@ void LongShortTermMemoryLayer::update_hidden_states(const Vector<double>& inputs
 
 Tensor<double> LongShortTermMemoryLayer::calculate_outputs(const Tensor<double>& inputs)
 {
+    if(inputs.get_dimensions_number() == 3)
+    {
+        if(inputs.get_dimension(1) != timesteps)
+        {
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: LongShortTermMemoryLayer class.\n"
+                   << "Tensor<double> calculate_outputs(const Tensor<double>&) method.\n"
+                   << "Time length of inputs (" << inputs.get_dimension(1) << ") must be equal to timesteps (" << timesteps << ").\n";
+
+            throw logic_error(buffer.str());
+        }
+
+        return calculate_outputs(inputs.sequences_to_rows()).rows_to_sequences(timesteps);
+    }
+
     #ifdef __OPENNN_DEBUG__
 
     const size_t inputs_number = get_inputs_number();
@@ -1923,53 +2104,7 @@ Tensor<double> LongShortTermMemoryLayer::calculate_outputs(const Tensor<double>&
     }
     #endif
 
-    const size_t instances_number = inputs.get_dimension(0);
-
-    const size_t neurons_number = get_neurons_number();
-
-    Tensor<double> outputs(Vector<size_t>({instances_number, neurons_number}));
-
-    Vector<double> forget_combinations;
-    Vector<double> forget_activations;
-    Vector<double> input_combinations;
-    Vector<double> input_activations;
-    Vector<double> state_combinations;
-    Vector<double> state_activations;
-    Vector<double> output_combinations;
-    Vector<double> output_activations;
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(i%timesteps == 0)
-        {
-            hidden_states.initialize(0.0);
-            cell_states.initialize(0.0);
-        }
-
-        const Vector<double> current_inputs = inputs.get_row(i);
-
-#pragma omp parallel
-        {
-            forget_combinations = calculate_forget_combinations(current_inputs);
-            forget_activations = calculate_recurrent_activations(forget_combinations);
-
-            input_combinations = calculate_input_combinations(current_inputs);
-            input_activations  = calculate_recurrent_activations(input_combinations);
-
-            state_combinations = calculate_state_combinations(current_inputs);
-            state_activations  = calculate_activations(state_combinations);
-
-            output_combinations = calculate_output_combinations(current_inputs);
-            output_activations  = calculate_recurrent_activations(output_combinations);
-        }
-
-        cell_states = forget_activations * cell_states + input_activations * state_activations;
-        hidden_states = output_activations * calculate_activations(cell_states);
-
-        outputs.set_row(i, hidden_states);
-      }
-
-    return outputs;
+    return Tensor<double>(calculate_sequences_states(inputs, get_biases(), get_weights(), get_recurrent_weights()).get_matrix(5));
 }
 
 
@@ -2004,79 +2139,30 @@ Tensor<double> LongShortTermMemoryLayer::calculate_outputs(const Tensor<double>&
     }
     #endif
 
-    const size_t instances_number = inputs.get_dimension(0);
     const size_t neurons_number = get_neurons_number();
 
-    const Matrix<double> new_forget_weights = parameters.get_subvector(0, inputs_number * neurons_number - 1).to_matrix(inputs_number, neurons_number);
-    const Matrix<double> new_input_weights = parameters.get_subvector(inputs_number * neurons_number, 2 * inputs_number * neurons_number - 1).to_matrix(inputs_number, neurons_number);
-    const Matrix<double> new_state_weights = parameters.get_subvector(2 * inputs_number * neurons_number, 3 * inputs_number * neurons_number - 1).to_matrix(inputs_number, neurons_number);
-    const Matrix<double> new_output_weights = parameters.get_subvector(3 * inputs_number * neurons_number, 4 * inputs_number * neurons_number - 1).to_matrix(inputs_number, neurons_number);
-
-    const Matrix<double> new_forget_recurrent_weights = parameters.get_subvector(4 * inputs_number * neurons_number,  4 * inputs_number * neurons_number + neurons_number * neurons_number -1).to_matrix(neurons_number, neurons_number);
-    const Matrix<double> new_input_recurrent_weights = parameters.get_subvector(4 * inputs_number * neurons_number + neurons_number * neurons_number, 4 * inputs_number * neurons_number + 2 * neurons_number * neurons_number - 1).to_matrix(neurons_number, neurons_number);
-    const Matrix<double> new_state_recurrent_weights = parameters.get_subvector(4 * inputs_number * neurons_number + 2 * neurons_number * neurons_number , 4 * inputs_number * neurons_number + 3 * neurons_number * neurons_number  - 1).to_matrix(neurons_number, neurons_number);
-    const Matrix<double> new_output_recurrent_weights = parameters.get_subvector(4 * inputs_number * neurons_number + 3 * neurons_number * neurons_number , 4 * inputs_number * neurons_number + 4 * neurons_number * neurons_number  - 1).to_matrix(neurons_number, neurons_number);
-
-    const Vector<double> new_forget_biases = parameters.get_subvector(4 * neurons_number * (inputs_number + neurons_number),  4 * neurons_number * (inputs_number + neurons_number) + neurons_number -1);
-    const Vector<double> new_input_biases = parameters.get_subvector(4 * neurons_number * (inputs_number + neurons_number) + neurons_number, 4 * neurons_number * (inputs_number + neurons_number) + 2 * neurons_number - 1);
-    const Vector<double> new_state_biases = parameters.get_subvector(4 * neurons_number * (inputs_number + neurons_number) + 2 * neurons_number , 4 * neurons_number * (inputs_number + neurons_number) + 3 * neurons_number - 1);
-    const Vector<double> new_output_biases = parameters.get_subvector(4 * neurons_number * (inputs_number + neurons_number) + 3 * neurons_number, 4 * neurons_number * (inputs_number + neurons_number + 1) - 1);
-
-    Tensor<double> outputs(Vector<size_t>({instances_number, neurons_number}));
-
-    Vector<double> forget_combinations;
-    Vector<double> forget_activations;
-
-    Vector<double> input_combinations;
-    Vector<double> input_activations;
-
-    Vector<double> state_combinations;
-    Vector<double> state_activations;
-
-    Vector<double> output_combinations;
-    Vector<double> output_activations;
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(i%timesteps == 0)
-        {
-            hidden_states.initialize(0.0);
-            cell_states.initialize(0.0);
-        }
-
-        const Vector<double> current_inputs = inputs.get_row(i);
-
-#pragma omp parallel
-        {
-            forget_combinations = dot(current_inputs, new_forget_weights) + new_forget_biases + dot(hidden_states, new_forget_recurrent_weights);
-            forget_activations = calculate_recurrent_activations(forget_combinations);
-
-            input_combinations = dot(current_inputs, new_input_weights) + new_input_biases + dot(hidden_states, new_input_recurrent_weights);
-            input_activations = calculate_recurrent_activations(input_combinations);
-
-            state_combinations = dot(current_inputs, new_state_weights) + new_state_biases + dot(hidden_states, new_state_recurrent_weights);
-            state_activations = calculate_activations(state_combinations);
+    const size_t weights_number = 4*inputs_number*neurons_number;
+    const size_t recurrent_weights_number = 4*neurons_number*neurons_number;
 
-            output_combinations = dot(current_inputs, new_output_weights) + new_output_biases + dot(hidden_states, new_output_recurrent_weights);
-            output_activations = calculate_recurrent_activations(output_combinations);
-        }
+    const Tensor<double> new_weights
+            = parameters.get_subvector(0, weights_number-1).to_tensor(Vector<size_t>({inputs_number, neurons_number, 4}));
 
-        cell_states = forget_activations * cell_states + input_activations * state_activations;
-        hidden_states = output_activations * calculate_activations(cell_states);
+    const Tensor<double> new_recurrent_weights
+            = parameters.get_subvector(weights_number, weights_number+recurrent_weights_number-1).to_tensor(Vector<size_t>({neurons_number, neurons_number, 4}));
 
-        outputs.set_row(i, hidden_states);
-      }
+    const Matrix<double> new_biases
+            = parameters.get_subvector(weights_number+recurrent_weights_number, parameters.size()-1).to_matrix(neurons_number, 4);
 
-    return outputs;
+    return Tensor<double>(calculate_sequences_states(inputs, new_biases, new_weights, new_recurrent_weights).get_matrix(5));
 }
 
 
 Tensor<double> LongShortTermMemoryLayer::calculate_outputs(const Tensor<double>& inputs, const Matrix<double>& new_biases, const Tensor<double>& new_weights, const Tensor<double>& new_recurrent_weights)
 {
-    const size_t neurons_number = get_neurons_number();
-
     #ifdef __OPENNN_DEBUG__
 
+    const size_t neurons_number = get_neurons_number();
+
     const size_t inputs_number = get_inputs_number();
 
     const size_t inputs_columns_number = inputs.get_dimension(1);
@@ -2151,70 +2237,7 @@ Tensor<double> LongShortTermMemoryLayer::calculate_outputs(const Tensor<double>&
      }
      #endif
 
-     const Matrix<double> new_forget_weights(new_weights.get_matrix(0));
-     const Matrix<double> new_input_weights(new_weights.get_matrix(1));
-     const Matrix<double> new_state_weights(new_weights.get_matrix(2));
-     const Matrix<double> new_output_weights(new_weights.get_matrix(3));
-
-     const Matrix<double> new_forget_recurrent_weights(new_recurrent_weights.get_matrix(0));
-     const Matrix<double> new_input_recurrent_weights(new_recurrent_weights.get_matrix(1));
-     const Matrix<double> new_state_recurrent_weights(new_recurrent_weights.get_matrix(2));
-     const Matrix<double> new_output_recurrent_weights(new_recurrent_weights.get_matrix(3));
-
-     const Vector<double> new_forget_biases(new_biases.get_column(0));
-     const Vector<double> new_input_biases(new_biases.get_column(1));
-     const Vector<double> new_state_biases(new_biases.get_column(2));
-     const Vector<double> new_output_biases(new_biases.get_column(3));
-
-     const size_t instances_number = inputs.get_dimension(0);
-
-     Tensor<double> outputs(Vector<size_t>({instances_number, neurons_number}));
-
-     Vector<double> forget_combinations;
-     Vector<double> forget_activations;
-
-     Vector<double> input_combinations;
-     Vector<double> input_activations;
-
-     Vector<double> state_combinations;
-     Vector<double> state_activations;
-
-     Vector<double> output_combinations;
-     Vector<double> output_activations;
-
-     for(size_t i = 0; i < instances_number; i++)
-     {
-         if(i%timesteps == 0)
-         {
-             hidden_states.initialize(0.0);
-             cell_states.initialize(0.0);
-         }
-
-         const Vector<double> current_inputs = inputs.get_row(i);
-
- #pragma omp parallel
-         {
-             forget_combinations = dot(current_inputs, new_forget_weights) + new_forget_biases + dot(hidden_states, new_forget_recurrent_weights);
-             forget_activations = calculate_recurrent_activations(forget_combinations);
-
-             input_combinations = dot(current_inputs, new_input_weights) + new_input_biases + dot(hidden_states, new_input_recurrent_weights);
-             input_activations = calculate_recurrent_activations(input_combinations);
-
-             state_combinations = dot(current_inputs, new_state_weights) + new_state_biases + dot(hidden_states, new_state_recurrent_weights);
-             state_activations = calculate_activations(state_combinations);
-
-             output_combinations = dot(current_inputs, new_output_weights) + new_output_biases + dot(hidden_states, new_output_recurrent_weights);
-             output_activations = calculate_recurrent_activations(output_combinations);
-         }
-
-
-         cell_states = forget_activations * cell_states + input_activations * state_activations;
-         hidden_states = output_activations * calculate_activations(cell_states);
-
-         outputs.set_row(i, hidden_states);
-     }
-
-     return outputs;
+    return Tensor<double>(calculate_sequences_states(inputs, new_biases, new_weights, new_recurrent_weights).get_matrix(5));
 }
 
 
@@ -2223,85 +2246,21 @@ Layer::FirstOrderActivations LongShortTermMemoryLayer::calculate_first_order_act
     const size_t instances_number = inputs.get_dimension(0);
     const size_t neurons_number = get_neurons_number();
 
-    Tensor<double> activations(instances_number,neurons_number);
+    const Tensor<double> sequences_states = calculate_sequences_states(inputs, get_biases(), get_weights(), get_recurrent_weights());
 
     // forget, input, state, output and tanh(cell_states) derivatives
-    Tensor<double> activations_derivatives(instances_number,neurons_number, 5);
-    activations_derivatives.initialize(0.0);
 
-    size_t forget_activations_index = 0;
-    size_t input_activations_index = instances_number*neurons_number;
-    size_t state_activations_index = 2*instances_number*neurons_number;
-    size_t output_activations_index = 3*instances_number*neurons_number;
-    size_t hidden_states_index = 4*instances_number*neurons_number;
-
-    Vector<double> forget_combinations;
-    Vector<double> forget_activations;
-    Vector<double> forget_activations_derivatives;
-
-    Vector<double> input_combinations;
-    Vector<double> input_activations;
-    Vector<double> input_activations_derivatives;
-
-    Vector<double> state_combinations;
-    Vector<double> state_activations;
-    Vector<double> state_activations_derivatives;
-
-    Vector<double> output_combinations;
-    Vector<double> output_activations;
-    Vector<double> output_activations_derivatives;
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(i%timesteps == 0)
-        {
-            hidden_states.initialize(0.0);
-            cell_states.initialize(0.0);
-        }
-
-        const Vector<double> current_inputs = inputs.get_row(i);
-
- #pragma omp parallel
-        {
-            forget_combinations = calculate_forget_combinations(current_inputs);
-            forget_activations = calculate_recurrent_activations(forget_combinations);
-            forget_activations_derivatives = calculate_recurrent_activations_derivatives(forget_combinations);
-
-            input_combinations = calculate_input_combinations(current_inputs);
-            input_activations = calculate_recurrent_activations(input_combinations);
-            input_activations_derivatives = calculate_recurrent_activations_derivatives(input_combinations);
-
-            state_combinations = calculate_state_combinations(current_inputs);
-            state_activations = calculate_activations(state_combinations);
-            state_activations_derivatives = calculate_activations_derivatives(state_combinations);
-
-            output_combinations = calculate_output_combinations(current_inputs);
-            output_activations = calculate_recurrent_activations(output_combinations);
-            output_activations_derivatives = calculate_recurrent_activations_derivatives(output_combinations);
-        }
-
-        cell_states = forget_activations * cell_states + input_activations * state_activations;
-        hidden_states = output_activations * calculate_activations(cell_states);
-        const Vector<double> hidden_states_derivatives = calculate_activations_derivatives(cell_states);
-
-        activations.set_row(i,hidden_states);
-
-        activations_derivatives.embed(forget_activations_index, forget_activations_derivatives);
-        activations_derivatives.embed(input_activations_index, input_activations_derivatives);
-        activations_derivatives.embed(state_activations_index, state_activations_derivatives);
-        activations_derivatives.embed(output_activations_index, output_activations_derivatives);
-        activations_derivatives.embed(hidden_states_index, hidden_states_derivatives);
+    Tensor<double> activations_derivatives(instances_number,neurons_number, 5);
 
-        forget_activations_index++;
-        input_activations_index++;
-        state_activations_index++;
-        output_activations_index++;
-        hidden_states_index++;
-    }
+    activations_derivatives.set_matrix(0, calculate_recurrent_activations_derivatives(Tensor<double>(sequences_states.get_matrix(0))).to_matrix());
+    activations_derivatives.set_matrix(1, calculate_recurrent_activations_derivatives(Tensor<double>(sequences_states.get_matrix(1))).to_matrix());
+    activations_derivatives.set_matrix(2, calculate_activations_derivatives(Tensor<double>(sequences_states.get_matrix(2))).to_matrix());
+    activations_derivatives.set_matrix(3, calculate_recurrent_activations_derivatives(Tensor<double>(sequences_states.get_matrix(3))).to_matrix());
+    activations_derivatives.set_matrix(4, calculate_activations_derivatives(Tensor<double>(sequences_states.get_matrix(4))).to_matrix());
 
     Layer::FirstOrderActivations first_order_activations;
 
-    first_order_activations.activations = activations;
+    first_order_activations.activations = Tensor<double>(sequences_states.get_matrix(5));
     first_order_activations.activations_derivatives = activations_derivatives;
 
     return first_order_activations;
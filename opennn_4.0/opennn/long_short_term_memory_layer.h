@@ -87,6 +87,9 @@ public:
 
    size_t get_timesteps() const;
 
+   Vector<double> get_hidden_states() const;
+   Vector<double> get_cell_states() const;
+
    size_t get_parameters_number() const;
    Vector<double> get_parameters() const;
 
@@ -196,6 +199,8 @@ public:
 
    Tensor<double> calculate_activations_states(const Tensor<double>&);
 
+   Tensor<double> calculate_sequences_states(const Tensor<double>&, const Matrix<double>&, const Tensor<double>&, const Tensor<double>&);
+
    // Long short term memory layer activations
 
    Tensor<double> calculate_activations(const Tensor<double>&) const;
@@ -207,6 +212,7 @@ public:
 
    Tensor<double> calculate_activations_derivatives(const Tensor<double>&) const;
    Vector<double> calculate_activations_derivatives(const Vector<double>&) const;
+   Tensor<double> calculate_recurrent_activations_derivatives(const Tensor<double>&) const;
    Vector<double> calculate_recurrent_activations_derivatives(const Vector<double>&) const;
 
    // Long short term memory layer outputs
@@ -493,7 +493,7 @@ Matrix<double> LossIndex::calculate_error_terms_Jacobian(const Tensor<double>& i
    #endif
 
    const size_t parameters_number = neural_network_pointer->get_parameters_number();
-   const size_t instances_number = data_set_pointer->get_instances_number();
+   const size_t instances_number = inputs.get_dimension(0);
 
    const Vector<size_t> layers_parameters_number = neural_network_pointer->get_trainable_layers_parameters_numbers();
 
@@ -516,6 +516,166 @@ Matrix<double> LossIndex::calculate_error_terms_Jacobian(const Tensor<double>& i
 }
 
 
+/// Returns the Jacobian of the error terms of a batch of instances.
+/// Each row contains the partial derivatives of the error term of an instance with respect to the parameters.
+/// It is only defined for the losses which are sums of squared error terms, and it is empty for the rest.
+/// @param batch_indices Indices of the instances in the batch.
+
+Matrix<double> LossIndex::calculate_batch_error_terms_Jacobian(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    const size_t layers_number = neural_network_pointer->get_trainable_layers_number();
+
+    const Tensor<double> inputs = data_set_pointer->get_input_data(batch_indices);
+    const Tensor<double> targets = data_set_pointer->get_target_data(batch_indices);
+
+    const Vector<Layer::FirstOrderActivations> forward_propagation = neural_network_pointer->calculate_trainable_forward_propagation(inputs);
+
+    const Vector<double> error_terms = calculate_training_error_terms(forward_propagation[layers_number-1].activations, targets);
+
+    if(error_terms.empty()) return Matrix<double>();
+
+    const Tensor<double> output_gradient = (forward_propagation[layers_number-1].activations - targets).divide(error_terms, 0);
+
+    const Vector<Tensor<double>> layers_delta = calculate_layers_delta(forward_propagation, output_gradient);
+
+    return calculate_error_terms_Jacobian(inputs, forward_propagation, layers_delta);
+}
+
+
+/// Returns the training instances in batches of consecutive instances, in the order of the data set.
+/// Unlike the training batches, they are not shuffled and the last batch is kept when it is smaller,
+/// so that every product by the Jacobian of the error terms sees all the training instances.
+/// Each batch holds whole sequences of timesteps instances, and the shorter last sequence, if any, is at the end of the last batch.
+
+Vector<Vector<size_t>> LossIndex::get_error_terms_Jacobian_batches() const
+{
+    const Vector<size_t> training_indices = data_set_pointer->get_training_instances_indices();
+
+    const size_t training_instances_number = training_indices.size();
+
+    if(training_instances_number == 0) return Vector<Vector<size_t>>();
+
+    const size_t timesteps = max(neural_network_pointer->get_timesteps(), static_cast<size_t>(1));
+
+    const size_t batch_instances_number = max(data_set_pointer->get_batch_instances_number()/timesteps, static_cast<size_t>(1))*timesteps;
+
+    const size_t batches_number = (training_instances_number + batch_instances_number - 1)/batch_instances_number;
+
+    Vector<Vector<size_t>> batches(batches_number);
+
+    for(size_t i = 0; i < batches_number; i++)
+    {
+        const size_t first_index = i*batch_instances_number;
+        const size_t last_index = min(first_index + batch_instances_number, training_instances_number) - 1;
+
+        batches[i] = training_indices.get_subvector(first_index, last_index);
+    }
+
+    return batches;
+}
+
+
+/// Returns the product of the transpose of the error terms Jacobian by the error terms Jacobian and by a vector, J'*J*d,
+/// summed over the training batches.
+/// The Jacobian of each batch is multiplied first by the vector and then by the result, so that J'*J is never formed.
+/// Only the Jacobian of one batch per thread is held in memory, but it is computed again in every call.
+/// @param direction Vector to be multiplied, with size the number of parameters.
+
+Vector<double> LossIndex::calculate_error_terms_Jacobian_product(const Vector<double>& direction) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    const size_t parameters_number = neural_network_pointer->get_parameters_number();
+
+    const Vector<Vector<size_t>> training_batches = get_error_terms_Jacobian_batches();
+
+    const size_t batches_number = training_batches.size();
+
+    Vector<double> product(parameters_number, 0.0);
+
+    #pragma omp parallel
+    {
+        Vector<double> thread_product(parameters_number, 0.0);
+
+        #pragma omp for
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double> error_terms_Jacobian = calculate_batch_error_terms_Jacobian(training_batches[static_cast<unsigned>(i)]);
+
+            thread_product += dot(dot(error_terms_Jacobian, direction), error_terms_Jacobian);
+        }
+
+        #pragma omp critical
+        {
+            product += thread_product;
+        }
+    }
+
+    return product;
+}
+
+
+/// Returns the squared norms of the columns of the error terms Jacobian, summed over the training batches.
+/// They are the diagonal of J'*J, which is used as preconditioner by matrix-free second order methods.
+
+Vector<double> LossIndex::calculate_error_terms_Jacobian_squared_norms() const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    const size_t parameters_number = neural_network_pointer->get_parameters_number();
+
+    const Vector<Vector<size_t>> training_batches = get_error_terms_Jacobian_batches();
+
+    const size_t batches_number = training_batches.size();
+
+    Vector<double> squared_norms(parameters_number, 0.0);
+
+    #pragma omp parallel
+    {
+        Vector<double> thread_squared_norms(parameters_number, 0.0);
+
+        #pragma omp for
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double> error_terms_Jacobian = calculate_batch_error_terms_Jacobian(training_batches[static_cast<unsigned>(i)]);
+
+            const size_t rows_number = error_terms_Jacobian.get_rows_number();
+
+            for(size_t j = 0; j < parameters_number; j++)
+            {
+                for(size_t k = 0; k < rows_number; k++)
+                {
+                    thread_squared_norms[j] += error_terms_Jacobian(k,j)*error_terms_Jacobian(k,j);
+                }
+            }
+        }
+
+        #pragma omp critical
+        {
+            squared_norms += thread_squared_norms;
+        }
+    }
+
+    return squared_norms;
+}
+
+
 /// Calculates the <i>Jacobian</i> matrix of the error terms of the layer.
 /// Returns the Jacobian of the error terms function, according to the objective type used in the loss index expression.
 /// Note that this function is only defined when the objective can be expressed as a sum of squared terms.
@@ -863,6 +1023,44 @@ Matrix<double> LossIndex::calculate_regularization_hessian(const Vector<double>&
 }
 
 
+/// Returns the product of the <i>Hessian</i> of the regularization by a vector, according to the regularization type.
+/// The Hessian matrix of the regularization is not formed.
+/// @param direction Vector to be multiplied by the Hessian of the regularization.
+
+Vector<double> LossIndex::calculate_regularization_hessian_product(const Vector<double>& direction) const
+{
+    #ifdef __OPENNN_DEBUG__
+
+    check();
+
+    #endif
+
+    const Vector<double> parameters = neural_network_pointer->get_parameters();
+
+    switch(regularization_method)
+    {
+       case L1:
+       {
+            return Vector<double>(parameters.size(), 0.0);
+       }
+       case L2:
+       {
+            const double norm = l2_norm(parameters);
+
+            if(norm == 0.0) return Vector<double>(parameters.size(), 0.0);
+
+            return parameters*(dot(parameters, direction)/(norm*norm*norm));
+       }
+       case NoRegularization:
+       {
+            return Vector<double>(parameters.size(), 0.0);
+       }
+    }
+
+    return Vector<double>();
+}
+
+
 /// Serializes a default error term object into a XML document of the TinyXML library.
 /// See the OpenNN manual for more information about the format of this document.
 
@@ -1069,19 +1267,40 @@ Vector<Tensor<double>> LossIndex::calculate_layers_delta(const Vector<Layer::Fir
 
    #endif
 
-   const Vector<Layer*> trainable_layers_pointers = neural_network_pointer->get_trainable_layers_pointers();
-
-   Vector<Tensor<double>> layers_delta(forward_propagation_size);
+   if(forward_propagation_size == 0) return Vector<Tensor<double>>();
 
-   if(forward_propagation_size == 0) return layers_delta;
+   const Vector<Layer*> trainable_layers_pointers = neural_network_pointer->get_trainable_layers_pointers();
 
    // Output layer
 
-   layers_delta[forward_propagation_size-1] = trainable_layers_pointers[forward_propagation_size-1]
+   const Tensor<double> output_delta = trainable_layers_pointers[forward_propagation_size-1]
            ->calculate_output_delta(forward_propagation[forward_propagation_size-1].activations_derivatives, output_gradient);
 
    // Hidden layers
 
+   return calculate_hidden_layers_delta(forward_propagation, output_delta);
+}
+
+
+/// Back-propagates the delta of the output layer through the hidden layers of the neural network.
+/// It is used by error terms which compute the output delta directly, without the output gradient.
+/// Returns the deltas of all the trainable layers, the last one being the output delta.
+/// @param forward_propagation Activations and activations derivatives of the trainable layers.
+/// @param output_delta Delta of the output layer.
+
+Vector<Tensor<double>> LossIndex::calculate_hidden_layers_delta(const Vector<Layer::FirstOrderActivations>& forward_propagation,
+                                                                const Tensor<double>& output_delta) const
+{
+   const size_t forward_propagation_size = forward_propagation.size();
+
+   const Vector<Layer*> trainable_layers_pointers = neural_network_pointer->get_trainable_layers_pointers();
+
+   Vector<Tensor<double>> layers_delta(forward_propagation_size);
+
+   if(forward_propagation_size == 0) return layers_delta;
+
+   layers_delta[forward_propagation_size-1] = output_delta;
+
    for(int i = static_cast<int>(forward_propagation_size)-2; i >= 0; i--)
    {
        Layer* previous_layer_pointer = trainable_layers_pointers[static_cast<size_t>(i+1)];
@@ -1111,13 +1330,11 @@ check();
 
     //Neural network
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
     const size_t batches_number = training_batches.size();
 
@@ -1146,13 +1363,11 @@ check();
 
     //Neural network
 
-    bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
     const size_t batches_number = training_batches.size();
 
@@ -1184,13 +1399,11 @@ check();
 
     //Neural network
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> selection_batches = data_set_pointer->get_selection_batches(!is_forecasting);
+    const Vector<Vector<size_t>> selection_batches = data_set_pointer->get_selection_batches(true, timesteps);
 
     const size_t batches_number = selection_batches.size();
 
@@ -1208,6 +1421,44 @@ check();
 }
 
 
+/// Calculates the selection error for a given vector of parameters, without modifying the neural network.
+/// It can therefore be called from another thread while the parameters of the neural network are being trained.
+/// If the batches do not contain all the selection instances, the error over the whole selection subset is extrapolated from them.
+/// @param parameters Parameters of the neural network.
+/// @param selection_batches Batches of selection instances on which the error is calculated.
+
+double LossIndex::calculate_selection_error_estimate(const Vector<double>& parameters, const Vector<Vector<size_t>>& selection_batches) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    const size_t batches_number = selection_batches.size();
+
+    double selection_error = 0.0;
+    size_t batches_instances_number = 0;
+
+    #pragma omp parallel for reduction(+ : selection_error, batches_instances_number)
+
+    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    {
+        selection_error += calculate_batch_error(selection_batches[static_cast<size_t>(i)], parameters);
+
+        batches_instances_number += selection_batches[static_cast<size_t>(i)].size();
+    }
+
+    if(batches_instances_number == 0) return 0.0;
+
+    const size_t selection_instances_number = data_set_pointer->get_selection_instances_number();
+
+    selection_error *= static_cast<double>(selection_instances_number)/static_cast<double>(batches_instances_number);
+
+    return selection_error/get_selection_error_normalization();
+}
+
+
 /// This method calculates the error term gradient for batch instances.
 /// It is used for optimization of parameters during training.
 /// Returns the value of the error term gradient.
@@ -1249,13 +1500,11 @@ check();
     // Neural network
 
     const size_t parameters_number = neural_network_pointer->get_parameters_number();
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
     const size_t batches_number = training_batches.size();
 
@@ -223,6 +223,10 @@ public:
 
    virtual double calculate_selection_error() const;
 
+   double calculate_selection_error_estimate(const Vector<double>&, const Vector<Vector<size_t>>&) const;
+
+   virtual double get_selection_error_normalization() const {return 1.0;}
+
    virtual double calculate_batch_error(const Vector<size_t>&) const = 0;
    virtual double calculate_batch_error(const Vector<size_t>&, const Vector<double>&) const = 0;
 
@@ -239,13 +243,23 @@ public:
    // ERROR TERMS METHODS
 
    virtual Vector<double> calculate_batch_error_terms(const Vector<size_t>&) const {return Vector<double>();}
-   virtual Matrix<double> calculate_batch_error_terms_Jacobian(const Vector<size_t>&) const {return Matrix<double>();}
+   virtual Vector<double> calculate_training_error_terms(const Tensor<double>&, const Tensor<double>&) const {return Vector<double>();}
+
+   Matrix<double> calculate_batch_error_terms_Jacobian(const Vector<size_t>&) const;
 
    virtual FirstOrderLoss calculate_batch_first_order_loss(const Vector<size_t>&) const {return FirstOrderLoss();}
 
    virtual FirstOrderLoss calculate_first_order_loss() const {return FirstOrderLoss();}
    virtual SecondOrderLoss calculate_terms_second_order_loss() const {return SecondOrderLoss();}
 
+   virtual Vector<double> calculate_terms_hessian_product(const Vector<double>&) const {return Vector<double>();}
+   virtual Vector<double> calculate_terms_hessian_diagonal() const {return Vector<double>();}
+
+   Vector<Vector<size_t>> get_error_terms_Jacobian_batches() const;
+
+   Vector<double> calculate_error_terms_Jacobian_product(const Vector<double>&) const;
+   Vector<double> calculate_error_terms_Jacobian_squared_norms() const;
+
    // Regularization methods
 
    double calculate_regularization() const;
@@ -256,9 +270,12 @@ public:
    Vector<double> calculate_regularization_gradient(const Vector<double>&) const;
    Matrix<double> calculate_regularization_hessian(const Vector<double>&) const;
 
+   Vector<double> calculate_regularization_hessian_product(const Vector<double>&) const;
+
    // Delta methods
 
    Vector<Tensor<double>> calculate_layers_delta(const Vector<Layer::FirstOrderActivations>&, const Tensor<double>&) const;
+   Vector<Tensor<double>> calculate_hidden_layers_delta(const Vector<Layer::FirstOrderActivations>&, const Tensor<double>&) const;
 
    Vector<double> calculate_error_gradient(const Tensor<double>&, const Vector<Layer::FirstOrderActivations>&, const Vector<Tensor<double>>&) const;
 
@@ -75,6 +75,8 @@ public:
 
    double calculate_selection_error() const;
 
+   double get_selection_error_normalization() const;
+
    double calculate_batch_error(const Vector<size_t>&) const;
    double calculate_batch_error(const Vector<size_t>&, const Vector<double>&) const;
 
@@ -96,6 +98,9 @@ public:
 
    LossIndex::SecondOrderLoss calculate_terms_second_order_loss() const;
 
+   Vector<double> calculate_terms_hessian_product(const Vector<double>&) const;
+   Vector<double> calculate_terms_hessian_diagonal() const;
+
    // Serialization methods
 
    tinyxml2::XMLDocument* to_XML() const;   
@@ -453,6 +453,133 @@ Matrix<double> direct(const Vector<double>& x, const Vector<double>& y)
 }
 
 
+/// Adds to a symmetric matrix the symmetric term a*x*x' + b*y*y' + c*(x*y' + y*x'), in place.
+/// Only the upper triangle is computed, column by column, and each element is then copied to the lower triangle,
+/// so that no temporary matrix is allocated and the matrix is traversed once.
+/// @param matrix Symmetric matrix to be updated.
+/// @param a Coefficient of the outer product of x with itself.
+/// @param x First vector.
+/// @param b Coefficient of the outer product of y with itself.
+/// @param y Second vector.
+/// @param c Coefficient of the symmetrized outer product of x and y.
+
+void symmetric_rank_two_update(Matrix<double>& matrix,
+                               const double& a, const Vector<double>& x,
+                               const double& b, const Vector<double>& y,
+                               const double& c)
+{
+  const size_t size = x.size();
+
+#ifdef __OPENNN_DEBUG__
+
+  if(y.size() != size || matrix.get_rows_number() != size || matrix.get_columns_number() != size)
+  {
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: Metrics functions.\n"
+           << "void symmetric_rank_two_update(Matrix<double>&, const double&, const Vector<double>&, const double&, const Vector<double>&, const double&) method.\n"
+           << "Matrix must be square and its size must be equal to the size of the vectors.\n";
+
+    throw logic_error(buffer.str());
+  }
+
+#endif
+
+  double* data = matrix.data();
+
+   #pragma omp parallel for schedule(dynamic, 64) if(size > 1000)
+
+  for(int j = 0; j < static_cast<int>(size); j++)
+  {
+    const size_t column_index = static_cast<size_t>(j);
+
+    const double a_x_j = a*x[column_index];
+    const double b_y_j = b*y[column_index];
+    const double c_x_j = c*x[column_index];
+    const double c_y_j = c*y[column_index];
+
+    double* column = data + column_index*size;
+
+    for(size_t i = 0; i <= column_index; i++)
+    {
+      column[i] += x[i]*(a_x_j + c_y_j) + y[i]*(b_y_j + c_x_j);
+
+      data[i*size + column_index] = column[i];
+    }
+  }
+}
+
+
+
+/// Adds to the lower triangle of a symmetric matrix the product of the transpose of a factor matrix by itself, in place.
+/// The transpose of the factor is never formed and the upper triangle is not referenced,
+/// so that several updates can be accumulated before filling it once with fill_upper_triangle.
+/// @param matrix Symmetric matrix to be updated. Its size must be the number of columns of the factor.
+/// @param factor Factor matrix, such as the Jacobian of the error terms.
+
+void symmetric_rank_k_update(Matrix<double>& matrix, const Matrix<double>& factor)
+{
+  const size_t rows_number = factor.get_rows_number();
+  const size_t columns_number = factor.get_columns_number();
+
+#ifdef __OPENNN_DEBUG__
+
+  if(matrix.get_rows_number() != columns_number || matrix.get_columns_number() != columns_number)
+  {
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: Metrics functions.\n"
+           << "void symmetric_rank_k_update(Matrix<double>&, const Matrix<double>&) method.\n"
+           << "Matrix must be square and its size must be equal to the number of columns of the factor.\n";
+
+    throw logic_error(buffer.str());
+  }
+
+#endif
+
+  if(rows_number == 0) return;
+
+  Eigen::Map<Eigen::MatrixXd> matrix_eigen(matrix.data(), static_cast<Eigen::Index>(columns_number), static_cast<Eigen::Index>(columns_number));
+  const Eigen::Map<Eigen::MatrixXd> factor_eigen((double*)factor.data(), static_cast<Eigen::Index>(rows_number), static_cast<Eigen::Index>(columns_number));
+
+  matrix_eigen.selfadjointView<Eigen::Lower>().rankUpdate(factor_eigen.transpose());
+}
+
+
+/// Copies the lower triangle of a square matrix into its upper triangle, in place.
+/// @param matrix Square matrix whose lower triangle holds the values.
+
+void fill_upper_triangle(Matrix<double>& matrix)
+{
+  const size_t size = matrix.get_rows_number();
+
+#ifdef __OPENNN_DEBUG__
+
+  if(matrix.get_columns_number() != size)
+  {
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: Metrics functions.\n"
+           << "void fill_upper_triangle(Matrix<double>&) method.\n"
+           << "Matrix must be square.\n";
+
+    throw logic_error(buffer.str());
+  }
+
+#endif
+
+  double* data = matrix.data();
+
+  for(size_t j = 1; j < size; j++)
+  {
+    for(size_t i = 0; i < j; i++)
+    {
+      data[j*size + i] = data[i*size + j];
+    }
+  }
+}
+
+
 /// Returns the determinant of a square matrix.
 
 double determinant(const Matrix<double>& matrix)
@@ -766,6 +893,116 @@ Matrix<double> eigenvectors(const Matrix<double>& matrix)
 }
 
 
+/// Calculates the leading principal components of a data matrix with a randomized truncated singular value decomposition.
+/// Only a subspace slightly larger than the requested components is computed, so that the cost is linear in the number of variables,
+/// instead of cubic as in the eigendecomposition of the full covariance matrix.
+/// @param data Data matrix with the instances in rows and the variables in columns. The columns must be centered.
+/// @param components_number Number of principal components to be computed.
+/// @param variances Vector where the variance along each principal component is returned, in descending order.
+/// Returns a matrix with the principal components arranged in rows.
+
+Matrix<double> truncated_principal_components(const Matrix<double>& data, const size_t& components_number, Vector<double>& variances)
+{
+    const size_t rows_number = data.get_rows_number();
+    const size_t columns_number = data.get_columns_number();
+
+    const size_t maximum_components_number = min(rows_number, columns_number);
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(rows_number < 2)
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: Metrics functions.\n"
+              << "Matrix<double> truncated_principal_components(const Matrix<double>&, const size_t&, Vector<double>&) method.\n"
+              << "Number of rows must be greater than one.\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    if(components_number == 0 || components_number > maximum_components_number)
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: Metrics functions.\n"
+              << "Matrix<double> truncated_principal_components(const Matrix<double>&, const size_t&, Vector<double>&) method.\n"
+              << "Number of components (" << components_number << ") must be between 1 and " << maximum_components_number << ".\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    const size_t oversampling = 10;
+    const size_t power_iterations = 2;
+
+    const size_t sketch_size = min(components_number + oversampling, maximum_components_number);
+
+    const Eigen::Map<Eigen::MatrixXd> data_eigen((double*)data.data(), static_cast<int>(rows_number), static_cast<int>(columns_number));
+
+    Matrix<double> random_matrix(columns_number, sketch_size);
+
+    random_matrix.randomize_normal();
+
+    const Eigen::Map<Eigen::MatrixXd> random_eigen(random_matrix.data(), static_cast<int>(columns_number), static_cast<int>(sketch_size));
+
+    // Orthonormal basis of the range of the data, refined with power iterations
+
+    Eigen::MatrixXd range = data_eigen*random_eigen;
+    Eigen::MatrixXd co_range;
+
+    Eigen::HouseholderQR<Eigen::MatrixXd> qr;
+
+    for(size_t i = 0; i < power_iterations; i++)
+    {
+        qr.compute(range);
+        range = qr.householderQ()*Eigen::MatrixXd::Identity(static_cast<int>(rows_number), static_cast<int>(sketch_size));
+
+        co_range = data_eigen.transpose()*range;
+
+        qr.compute(co_range);
+        co_range = qr.householderQ()*Eigen::MatrixXd::Identity(static_cast<int>(columns_number), static_cast<int>(sketch_size));
+
+        range = data_eigen*co_range;
+    }
+
+    qr.compute(range);
+    range = qr.householderQ()*Eigen::MatrixXd::Identity(static_cast<int>(rows_number), static_cast<int>(sketch_size));
+
+    // Singular value decomposition of the data projected onto that basis
+
+    const Eigen::MatrixXd projection = range.transpose()*data_eigen;
+
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> projection_eigen(projection*projection.transpose(), Eigen::ComputeEigenvectors);
+
+    Matrix<double> principal_components(components_number, columns_number, 0.0);
+
+    variances.set(components_number, 0.0);
+
+    for(size_t i = 0; i < components_number; i++)
+    {
+        const int index = static_cast<int>(sketch_size - 1 - i);
+
+        const double squared_singular_value = projection_eigen.eigenvalues()(index);
+
+        if(squared_singular_value < numeric_limits<double>::min()) continue;
+
+        variances[i] = squared_singular_value/static_cast<double>(rows_number - 1);
+
+        const Eigen::VectorXd principal_component
+                = projection.transpose()*projection_eigen.eigenvectors().col(index)/sqrt(squared_singular_value);
+
+        for(size_t j = 0; j < columns_number; j++)
+        {
+            principal_components(i,j) = principal_component(static_cast<int>(j));
+        }
+    }
+
+    return principal_components;
+}
+
+
 /// Calculates the direct product of this matrix with another matrix.
 /// This product is also known as the Kronecker product.
 /// @param other_matrix Second product term.
@@ -1702,6 +1939,44 @@ double cross_entropy_error(const Tensor<double>& x, const Tensor<double>& y)
 }
 
 
+/// Returns the cross entropy error between a tensor of class probabilities and a tensor of one-hot targets.
+/// Only the probabilities of the target classes contribute to the error, as with softmax outputs.
+/// Probabilities which underflow to zero are replaced by the smallest positive double.
+/// @param x Tensor of probabilities, with instances in rows.
+/// @param y Tensor of targets.
+
+double categorical_cross_entropy_error(const Tensor<double>& x, const Tensor<double>& y)
+{
+    #ifdef __OPENNN_DEBUG__
+
+    if(y.get_dimensions() != x.get_dimensions())
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: Metrics functions.\n"
+              << "double categorical_cross_entropy_error(const Tensor<double>&, const Tensor<double>&) method.\n"
+              << "Dimensions of both tensors must be equal.\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    const size_t size = x.size();
+
+    double cross_entropy_error = 0.0;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        if(y[i] == 0.0) continue;
+
+        cross_entropy_error -= y[i]*log(max(x[i], numeric_limits<double>::min()));
+    }
+
+    return cross_entropy_error;
+}
+
+
 /// Returns the minkowski error between the elements of this tensor and the elements of another tensor.
 /// @param x Tensor.
 /// @param y Other tensor.
@@ -43,6 +43,12 @@ namespace OpenNN
 
      Matrix<double> direct(const Vector<double>&, const Vector<double>&);
 
+     void symmetric_rank_two_update(Matrix<double>&, const double&, const Vector<double>&, const double&, const Vector<double>&, const double&);
+
+     void symmetric_rank_k_update(Matrix<double>&, const Matrix<double>&);
+
+     void fill_upper_triangle(Matrix<double>&);
+
     // DECOMPOSITIONS
 
      // MATRIX EIGENVALUES
@@ -84,6 +90,8 @@ namespace OpenNN
      Matrix<double> eigenvalues(const Matrix<double>&);
      Matrix<double> eigenvectors(const Matrix<double>&);
 
+     Matrix<double> truncated_principal_components(const Matrix<double>&, const size_t&, Vector<double>&);
+
      Matrix<double> direct(const Matrix<double>&, const Matrix<double>&);
 
      Tensor<double> linear_combinations(const Tensor<double>&, const Matrix<double>&, const Vector<double>&);
@@ -126,6 +134,8 @@ namespace OpenNN
 
      double cross_entropy_error(const Tensor<double>&, const Tensor<double>&);
 
+     double categorical_cross_entropy_error(const Tensor<double>&, const Tensor<double>&);
+
      double minkowski_error(const Tensor<double>&, const Tensor<double>&, const double&);
 
      double weighted_sum_squared_error(const Tensor<double>&, const Tensor<double>&, const double&, const double&);
@@ -131,13 +131,11 @@ double MinkowskiError::calculate_training_error() const
 {
     //Neural network
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
     const size_t training_instances_number = data_set_pointer->get_training_instances_number();
 
@@ -176,13 +174,11 @@ double MinkowskiError::calculate_training_error(const Vector<double>& parameters
 {
     //Neural network
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
     const size_t training_instances_number = data_set_pointer->get_training_instances_number();
 
@@ -225,13 +221,11 @@ double MinkowskiError::calculate_selection_error() const
 
         //Neural network
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> selection_batches = data_set_pointer->get_selection_batches(!is_forecasting);
+    const Vector<Vector<size_t>> selection_batches = data_set_pointer->get_selection_batches(true, timesteps);
 
     const size_t batches_number = selection_batches.size();
 
@@ -264,6 +258,14 @@ double MinkowskiError::calculate_selection_error() const
 }
 
 
+/// Returns the number of selection instances, by which the sum of Minkowski errors is divided to obtain the selection error.
+
+double MinkowskiError::get_selection_error_normalization() const
+{
+    return static_cast<double>(data_set_pointer->get_selection_instances_number());
+}
+
+
 /// This method calculates the Minkowski error of the given batch.
 /// Returns the Minkowski error of this batch.
 /// @param batch_indices Indices of the batch instances corresponding to the dataset.
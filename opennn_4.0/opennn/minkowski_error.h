@@ -71,6 +71,8 @@ public:
 
    double calculate_selection_error() const;
 
+   double get_selection_error_normalization() const;
+
    double calculate_batch_error(const Vector<size_t>&) const;
    double calculate_batch_error(const Vector<size_t>&, const Vector<double>&) const;
 
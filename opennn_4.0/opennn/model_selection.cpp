@@ -173,6 +173,14 @@ GeneticAlgorithm* ModelSelection::get_genetic_algorithm_pointer() const
 }
 
 
+/// Returns the number of threads which train the folds of a cross validation concurrently.
+
+const size_t& ModelSelection::get_workers_number() const
+{
+    return workers_number;
+}
+
+
 /// Sets the members of the model selection object to their default values.
 
 void ModelSelection::set_default()
@@ -181,6 +189,8 @@ void ModelSelection::set_default()
 
     set_inputs_selection_method(GROWING_INPUTS);
 
+    workers_number = max(static_cast<size_t>(thread::hardware_concurrency()), static_cast<size_t>(1));
+
     display = true;
 }
 
@@ -431,6 +441,16 @@ void ModelSelection::set_approximation(const bool& new_approximation)
 }
 
 
+/// Sets the number of threads which train the folds of a cross validation concurrently.
+/// Each thread holds a copy of the neural network and a view of the data set.
+/// @param new_workers_number Number of threads. If it is 0 or 1, the folds are trained sequentially.
+
+void ModelSelection::set_workers_number(const size_t& new_workers_number)
+{
+    workers_number = max(new_workers_number, static_cast<size_t>(1));
+}
+
+
 /// Sets a new training strategy pointer.
 /// @param new_training_strategy_pointer Pointer to a training strategy object.
 
@@ -1115,7 +1135,6 @@ Vector<NeuralNetwork> ModelSelection::perform_k_fold_cross_validation(const size
     const Vector<size_t> selection_instances_indices = data_set_pointer->get_selection_instances_indices();
 
     NeuralNetwork* neural_network_pointer = training_strategy_pointer->get_neural_network_pointer();
-    LossIndex* loss_index_pointer = training_strategy_pointer->get_loss_index_pointer();
 
 #ifdef __OPENNN_DEBUG__
 
@@ -1130,7 +1149,7 @@ Vector<NeuralNetwork> ModelSelection::perform_k_fold_cross_validation(const size
        throw logic_error(buffer.str());
     }
 
-    if(!data_set_pointer || data_set_pointer->has_data())
+    if(!data_set_pointer || !data_set_pointer->has_data())
     {
        buffer << "OpenNN Exception: ModelSelection class.\n"
               << "Vector<NeuralNetwork> perform_k_fold_cross_validation(const size_t&).\n"
@@ -1151,35 +1170,38 @@ Vector<NeuralNetwork> ModelSelection::perform_k_fold_cross_validation(const size
 
     //
 
-    const Vector<DataSet::InstanceUse> original_uses = data_set_pointer->get_instances_uses();
-
-    data_set_pointer->split_instances_random(1,0,0);
+    // Instances uses of the folds, set on a view so that the data set is not modified
 
-    Vector<double> minimum_error_parameters;
-    double minimum_error = 1.0;
+    DataSetView folds_data_set(*data_set_pointer);
 
-    Vector<NeuralNetwork> neural_network_ensemble(k);
-    double cross_validation_error = 0.0;
+    Vector<Vector<DataSet::InstanceUse>> folds_instances_uses(k);
 
     for(size_t i = 0; i < k; i++)
     {
-        data_set_pointer->set_k_fold_cross_validation_instances_uses(k,i);
+        folds_data_set.set_k_fold_cross_validation_instances_uses(k,i);
 
-        neural_network_pointer->randomize_parameters_normal();
+        folds_instances_uses[i] = folds_data_set.get_instances_uses();
+    }
 
-        training_strategy_pointer->perform_training();
+    Vector<NeuralNetwork> neural_network_ensemble;
 
-        data_set_pointer->set_testing_to_selection_instances();
+    const Matrix<double> folds_errors = perform_folds_training(folds_instances_uses, neural_network_ensemble);
 
-        const double current_error = loss_index_pointer->calculate_selection_error();
+    Vector<double> minimum_error_parameters;
+    double minimum_error = 1.0;
+
+    double cross_validation_error = 0.0;
+
+    for(size_t i = 0; i < k; i++)
+    {
+        const double current_error = folds_errors(i,1);
 
         if(i == 0 || current_error < minimum_error)
         {
             minimum_error = current_error;
-            minimum_error_parameters = neural_network_pointer->get_parameters();
+            minimum_error_parameters = neural_network_ensemble[i].get_parameters();
         }
 
-        neural_network_ensemble[i].set(*neural_network_pointer);
         cross_validation_error += current_error;
 
         if(display)
@@ -1194,8 +1216,6 @@ Vector<NeuralNetwork> ModelSelection::perform_k_fold_cross_validation(const size
         cout << "Cross validation error: " << cross_validation_error/k << endl;
     }
 
-    data_set_pointer->set_instances_uses(original_uses);
-
     neural_network_pointer->set_parameters(minimum_error_parameters);
 
     return neural_network_ensemble;
@@ -1211,7 +1231,6 @@ Vector<NeuralNetwork> ModelSelection::perform_random_cross_validation(const size
     const Vector<size_t> selection_instances_indices = data_set_pointer->get_selection_instances_indices();
 
     NeuralNetwork* neural_network_pointer = training_strategy_pointer->get_neural_network_pointer();
-    LossIndex* loss_index_pointer = training_strategy_pointer->get_loss_index_pointer();
 
 #ifdef __OPENNN_DEBUG__
 
@@ -1235,7 +1254,7 @@ Vector<NeuralNetwork> ModelSelection::perform_random_cross_validation(const size
        throw logic_error(buffer.str());
     }
 
-    if(!data_set_pointer || data_set_pointer->has_data())
+    if(!data_set_pointer || !data_set_pointer->has_data())
     {
        buffer << "OpenNN Exception: ModelSelection class.\n"
               << "Vector<NeuralNetwork> perform_random_cross_validation(const size_t&, const double&).\n"
@@ -1256,35 +1275,38 @@ Vector<NeuralNetwork> ModelSelection::perform_random_cross_validation(const size
 
     //
 
-    const Vector<DataSet::InstanceUse> original_uses = data_set_pointer->get_instances_uses();
-
-    data_set_pointer->split_instances_random(1,0,0);
+    // Instances uses of the folds, set on a view so that the data set is not modified
 
-    Vector<double> minimum_error_parameters;
-    double minimum_error = 1.0;
+    DataSetView folds_data_set(*data_set_pointer);
 
-    Vector<NeuralNetwork> neural_network_ensemble(k);
-    double cross_validation_error = 0.0;
+    Vector<Vector<DataSet::InstanceUse>> folds_instances_uses(k);
 
     for(size_t i = 0; i < k; i++)
     {
-        data_set_pointer->split_instances_random(1-selection_ratio,0.0,selection_ratio);
+        folds_data_set.split_instances_random(1-selection_ratio,0.0,selection_ratio);
 
-        neural_network_pointer->randomize_parameters_normal();
+        folds_instances_uses[i] = folds_data_set.get_instances_uses();
+    }
 
-        training_strategy_pointer->perform_training();
+    Vector<NeuralNetwork> neural_network_ensemble;
 
-        data_set_pointer->set_testing_to_selection_instances();
+    const Matrix<double> folds_errors = perform_folds_training(folds_instances_uses, neural_network_ensemble);
 
-        const double current_error = loss_index_pointer->calculate_selection_error();
+    Vector<double> minimum_error_parameters;
+    double minimum_error = 1.0;
+
+    double cross_validation_error = 0.0;
+
+    for(size_t i = 0; i < k; i++)
+    {
+        const double current_error = folds_errors(i,1);
 
         if(i == 0 || current_error < minimum_error)
         {
             minimum_error = current_error;
-            minimum_error_parameters = neural_network_pointer->get_parameters();
+            minimum_error_parameters = neural_network_ensemble[i].get_parameters();
         }
 
-        neural_network_ensemble[i].set(*neural_network_pointer);
         cross_validation_error += current_error;
 
         if(display)
@@ -1299,7 +1321,6 @@ Vector<NeuralNetwork> ModelSelection::perform_random_cross_validation(const size
         cout << "Cross validation error: " << cross_validation_error/k << endl;
     }
 
-    data_set_pointer->set_instances_uses(original_uses);
     neural_network_pointer->set_parameters(minimum_error_parameters);
 
     return neural_network_ensemble;
@@ -1314,13 +1335,11 @@ Vector<NeuralNetwork> ModelSelection::perform_positives_cross_validation() const
 
     NeuralNetwork* neural_network_pointer = training_strategy_pointer->get_neural_network_pointer();
 
-    LossIndex* loss_index_pointer = training_strategy_pointer->get_loss_index_pointer();
-
 #ifdef __OPENNN_DEBUG__
 
     ostringstream buffer;
 
-    if(!data_set_pointer || data_set_pointer->has_data())
+    if(!data_set_pointer || !data_set_pointer->has_data())
     {
        buffer << "OpenNN Exception: ModelSelection class.\n"
               << "Vector<NeuralNetwork> perform_positives_cross_validation().\n"
@@ -1341,10 +1360,6 @@ Vector<NeuralNetwork> ModelSelection::perform_positives_cross_validation() const
 
     //
 
-    const Vector<size_t> training_indices = data_set_pointer->get_training_instances_indices();
-
-    const Vector<DataSet::InstanceUse> original_uses = data_set_pointer->get_instances_uses();
-
     const Vector<size_t> inputs_indices = data_set_pointer->get_input_variables_indices();
 
     const size_t target_index = data_set_pointer->get_target_variables_indices()[0];
@@ -1353,12 +1368,30 @@ Vector<NeuralNetwork> ModelSelection::perform_positives_cross_validation() const
 
     const size_t positives_instances_number = positives_instances_indices.size();
 
-    data_set_pointer->split_instances_random(1,0,0);
+    // Instances uses of the folds, set on a view so that the data set is not modified
+
+    DataSetView folds_data_set(*data_set_pointer);
+
+    folds_data_set.split_instances_random(1,0,0);
+
+    Vector<Vector<DataSet::InstanceUse>> folds_instances_uses(positives_instances_number);
+
+    for(size_t i = 0; i < positives_instances_number; i++)
+    {
+        folds_data_set.set_instance_use(positives_instances_indices[i], DataSet::Testing);
+
+        folds_instances_uses[i] = folds_data_set.get_instances_uses();
+
+        folds_data_set.set_instance_use(positives_instances_indices[i], DataSet::Training);
+    }
+
+    Vector<NeuralNetwork> neural_network_ensemble;
+
+    const Matrix<double> folds_errors = perform_folds_training(folds_instances_uses, neural_network_ensemble);
 
     Vector<double> minimum_error_parameters;
     double minimum_error = 1.0;
 
-    Vector<NeuralNetwork> neural_network_ensemble(positives_instances_number);
     double cross_validation_error = 0.0;
 
     for(size_t i = 0; i < positives_instances_number; i++)
@@ -1368,25 +1401,17 @@ Vector<NeuralNetwork> ModelSelection::perform_positives_cross_validation() const
         const double targets = current_selection_instance[target_index];
         const Vector<double> current_inputs_selection_instance = current_selection_instance.get_subvector(inputs_indices);
 
-        data_set_pointer->set_instance_use(current_selection_instance_index, DataSet::Testing);
-        neural_network_pointer->randomize_parameters_normal();
-
-        training_strategy_pointer->perform_training();
-
-        const double outputs = neural_network_pointer->calculate_outputs(current_inputs_selection_instance.to_tensor({1}))(0,0);
+        const double outputs = neural_network_ensemble[i].calculate_outputs(current_inputs_selection_instance.to_tensor({1}))(0,0);
 
         const double current_error = abs(targets-outputs);
-        const double current_loss = loss_index_pointer->calculate_training_loss();
+        const double current_loss = folds_errors(i,0);
 
         if(i == 0 || current_error < minimum_error)
         {
             minimum_error = current_error;
-            minimum_error_parameters = neural_network_pointer->get_parameters();
+            minimum_error_parameters = neural_network_ensemble[i].get_parameters();
         }
 
-        data_set_pointer->set_instance_use(current_selection_instance_index, DataSet::Training);
-
-        neural_network_ensemble[i].set(*neural_network_pointer);
         cross_validation_error += current_error;
 
         if(display)
@@ -1404,7 +1429,6 @@ Vector<NeuralNetwork> ModelSelection::perform_positives_cross_validation() const
         cout << "Cross validation error: " << cross_validation_error/positives_instances_number << endl;
     }
 
-    data_set_pointer->set_instances_uses(original_uses);
     neural_network_pointer->set_parameters(minimum_error_parameters);
 
     return neural_network_ensemble;
@@ -1412,4 +1436,96 @@ Vector<NeuralNetwork> ModelSelection::perform_positives_cross_validation() const
 //    return Vector<NeuralNetwork>();
 
 }
+
+
+/// Trains a copy of the neural network for each fold of a cross validation, in workers_number threads.
+/// The folds share the data of the data set through views which hold their own instances uses,
+/// so that neither the data set nor the neural network are modified.
+/// The initial parameters and the random generators of the copies are drawn sequentially, so that the results do not depend on the number of threads.
+/// Returns a matrix with the training loss and the error on the testing instances of each fold.
+/// @param folds_instances_uses Instances uses of the data set for each fold.
+/// @param neural_network_ensemble Trained neural networks of the folds.
+
+Matrix<double> ModelSelection::perform_folds_training(const Vector<Vector<DataSet::InstanceUse>>& folds_instances_uses,
+                                                      Vector<NeuralNetwork>& neural_network_ensemble) const
+{
+    DataSet* data_set_pointer = training_strategy_pointer->get_loss_index_pointer()->get_data_set_pointer();
+
+    NeuralNetwork* neural_network_pointer = training_strategy_pointer->get_neural_network_pointer();
+
+    const size_t folds_number = folds_instances_uses.size();
+
+    neural_network_ensemble.set(folds_number);
+
+    vector<RandomGenerator> folds_generators;
+
+    for(size_t i = 0; i < folds_number; i++)
+    {
+        neural_network_ensemble[i].set(*neural_network_pointer);
+
+        neural_network_ensemble[i].randomize_parameters_normal();
+
+        folds_generators.push_back(get_random_generator().split(i));
+    }
+
+    Matrix<double> folds_errors(folds_number, 2);
+
+    const size_t threads_number = max(min(workers_number, folds_number), static_cast<size_t>(1));
+
+    atomic<size_t> next_fold(0);
+
+    vector<exception_ptr> workers_exceptions(threads_number);
+
+    vector<thread> workers;
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers.push_back(thread([&, i]()
+        {
+            try
+            {
+                for(size_t j = next_fold++; j < folds_number; j = next_fold++)
+                {
+                    ScopedRandomGenerator fold_generator(folds_generators[j]);
+
+                    DataSetView fold_data_set(*data_set_pointer);
+
+                    fold_data_set.set_instances_uses(folds_instances_uses[j]);
+
+                    TrainingStrategy fold_training_strategy(&neural_network_ensemble[j], &fold_data_set);
+
+                    fold_training_strategy.set_methods(*training_strategy_pointer);
+
+                    fold_training_strategy.set_display(false);
+
+                    fold_training_strategy.perform_training();
+
+                    LossIndex* fold_loss_index_pointer = fold_training_strategy.get_loss_index_pointer();
+
+                    folds_errors(j,0) = fold_loss_index_pointer->calculate_training_loss();
+
+                    fold_data_set.set_testing_to_selection_instances();
+
+                    folds_errors(j,1) = fold_loss_index_pointer->calculate_selection_error();
+                }
+            }
+            catch(...)
+            {
+                workers_exceptions[i] = current_exception();
+            }
+        }));
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers[i].join();
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        if(workers_exceptions[i]) rethrow_exception(workers_exceptions[i]);
+    }
+
+    return folds_errors;
+}
 }
@@ -17,9 +17,13 @@
 #include <sstream>
 #include <cmath>
 #include <ctime>
+#include <thread>
+#include <atomic>
+#include <exception>
 
 // OpenNN includes
 
+#include "data_set_view.h"
 #include "training_strategy.h"
 #include "incremental_neurons.h"
 #include "growing_inputs.h"
@@ -109,6 +113,8 @@ public:
     PruningInputs* get_pruning_inputs_pointer() const;
     GeneticAlgorithm* get_genetic_algorithm_pointer() const;
 
+    const size_t& get_workers_number() const;
+
     // Set methods
 
     void set_default();
@@ -125,6 +131,8 @@ public:
 
     void set_approximation(const bool&);
 
+    void set_workers_number(const size_t&);
+
     // Pointer methods
 
     void destruct_neurons_selection();
@@ -137,6 +145,8 @@ public:
     Vector<NeuralNetwork> perform_random_cross_validation(const size_t& = 4, const double& = 0.25) const;
     Vector<NeuralNetwork> perform_positives_cross_validation() const;
 
+    Matrix<double> perform_folds_training(const Vector<Vector<DataSet::InstanceUse>>&, Vector<NeuralNetwork>&) const;
+
     // Model selection methods
 
     void check() const;
@@ -188,6 +198,10 @@ private:
 
     InputsSelectionMethod inputs_selection_method;
 
+    /// Number of threads which train the folds of a cross validation concurrently.
+
+    size_t workers_number;
+
     /// Display messages to screen.
 
     bool display;
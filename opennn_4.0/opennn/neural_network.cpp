@@ -106,6 +106,21 @@ NeuralNetwork::~NeuralNetwork()
 }
 
 
+/// Assignment operator.
+/// It deep copies the layers of another neural network object, so that the layers are never owned by both objects.
+/// @param other_neural_network Neural network object to be assigned.
+
+NeuralNetwork& NeuralNetwork::operator = (const NeuralNetwork& other_neural_network)
+{
+    if(this != &other_neural_network)
+    {
+        set(other_neural_network);
+    }
+
+    return *this;
+}
+
+
 /// Add a new layer to the Neural Network model.
 /// @param layer The layer that will be added.
 /// @todo break the software.
@@ -659,19 +674,75 @@ void NeuralNetwork::set(const string& file_name)
 
 
 /// Sets the members of this neural network object with those from other neural network object.
+/// The layers are deep copied, so that both neural networks can be trained independently, for instance in different threads.
 /// @param other_neural_network Neural network object to be copied. 
 
 void NeuralNetwork::set(const NeuralNetwork& other_neural_network)
 {
-    layers_pointers.set();
-
     if(this == &other_neural_network) return;
 
+    for(size_t i = 0; i < layers_pointers.size(); i++)
+    {
+        delete layers_pointers[i];
+    }
+
+    layers_pointers.set();
+
     inputs_names = other_neural_network.inputs_names;
 
     outputs_names = other_neural_network.outputs_names;
 
-    layers_pointers = other_neural_network.layers_pointers;
+    const size_t layers_number = other_neural_network.get_layers_number();
+
+    layers_pointers.set(layers_number);
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+        const Layer* layer_pointer = other_neural_network.layers_pointers[i];
+
+        switch(layer_pointer->get_type())
+        {
+            case Layer::Scaling:
+                layers_pointers[i] = new ScalingLayer(*static_cast<const ScalingLayer*>(layer_pointer));
+            break;
+
+            case Layer::Convolutional:
+                layers_pointers[i] = new ConvolutionalLayer(*static_cast<const ConvolutionalLayer*>(layer_pointer));
+            break;
+
+            case Layer::Perceptron:
+                layers_pointers[i] = new PerceptronLayer(*static_cast<const PerceptronLayer*>(layer_pointer));
+            break;
+
+            case Layer::Pooling:
+                layers_pointers[i] = new PoolingLayer(*static_cast<const PoolingLayer*>(layer_pointer));
+            break;
+
+            case Layer::Probabilistic:
+                layers_pointers[i] = new ProbabilisticLayer(*static_cast<const ProbabilisticLayer*>(layer_pointer));
+            break;
+
+            case Layer::LongShortTermMemory:
+                layers_pointers[i] = new LongShortTermMemoryLayer(*static_cast<const LongShortTermMemoryLayer*>(layer_pointer));
+            break;
+
+            case Layer::Recurrent:
+                layers_pointers[i] = new RecurrentLayer(*static_cast<const RecurrentLayer*>(layer_pointer));
+            break;
+
+            case Layer::Unscaling:
+                layers_pointers[i] = new UnscalingLayer(*static_cast<const UnscalingLayer*>(layer_pointer));
+            break;
+
+            case Layer::Bounding:
+                layers_pointers[i] = new BoundingLayer(*static_cast<const BoundingLayer*>(layer_pointer));
+            break;
+
+            case Layer::PrincipalComponents:
+                layers_pointers[i] = new PrincipalComponentsLayer(*static_cast<const PrincipalComponentsLayer*>(layer_pointer));
+            break;
+        }
+    }
 
     display = other_neural_network.display;
 }
@@ -741,6 +812,179 @@ void NeuralNetwork::set_inputs_number(const Vector<bool>& inputs)
 }
 
 
+/// Changes the inputs of this neural network, keeping the synaptic weights of those inputs which it already had.
+/// The synaptic weights of the new inputs are set to zero, and those of the removed inputs are dropped,
+/// so that adding inputs does not change the outputs of the network.
+/// The rest of the parameters are not modified, so that the network can be fine-tuned from its previous state.
+/// If the first trainable layer is not a perceptron layer, all its parameters are initialized at random,
+/// and the other layers keep theirs.
+/// @param previous_inputs_indices Indices of the variables which are the current inputs, in order.
+/// @param new_inputs_indices Indices of the variables which are to be the new inputs, in order.
+
+void NeuralNetwork::warm_start_inputs(const Vector<size_t>& previous_inputs_indices, const Vector<size_t>& new_inputs_indices)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(previous_inputs_indices.size() != get_inputs_number())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: NeuralNetwork class.\n"
+               << "void warm_start_inputs(const Vector<size_t>&, const Vector<size_t>&) method.\n"
+               << "Size of previous inputs indices (" << previous_inputs_indices.size() << ") must be equal to number of inputs (" << get_inputs_number() << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const Vector<Layer*> trainable_layers_pointers = get_trainable_layers_pointers();
+
+    if(trainable_layers_pointers.empty() || trainable_layers_pointers[0]->get_type() != Layer::Perceptron)
+    {
+        set_inputs_number(new_inputs_indices.size());
+
+        if(!trainable_layers_pointers.empty()) trainable_layers_pointers[0]->randomize_parameters_normal(0.0, 1.0);
+
+        return;
+    }
+
+    PerceptronLayer* perceptron_layer_pointer = static_cast<PerceptronLayer*>(trainable_layers_pointers[0]);
+
+    const Vector<double> biases = perceptron_layer_pointer->get_biases();
+    const Matrix<double> previous_synaptic_weights = perceptron_layer_pointer->get_synaptic_weights();
+
+    const size_t neurons_number = perceptron_layer_pointer->get_neurons_number();
+
+    set_inputs_number(new_inputs_indices.size());
+
+    Matrix<double> synaptic_weights(new_inputs_indices.size(), neurons_number, 0.0);
+
+    for(size_t i = 0; i < new_inputs_indices.size(); i++)
+    {
+        const Vector<size_t> previous_index = previous_inputs_indices.get_indices_equal_to(new_inputs_indices[i]);
+
+        if(previous_index.empty()) continue;
+
+        for(size_t j = 0; j < neurons_number; j++)
+        {
+            synaptic_weights(i,j) = previous_synaptic_weights(previous_index[0],j);
+        }
+    }
+
+    perceptron_layer_pointer->set_biases(biases);
+    perceptron_layer_pointer->set_synaptic_weights(synaptic_weights);
+}
+
+
+/// Changes the number of neurons of a trainable layer, keeping the parameters of the neurons which it already had.
+/// New neurons get random synaptic weights and biases, and their synaptic weights in the next layer are set to zero,
+/// so that the outputs of the network are initially those of the previous one.
+/// Removed neurons are taken from the end of the layer.
+/// If the layer is not a perceptron layer followed by a perceptron or a probabilistic layer,
+/// the parameters of that layer and of the next one are initialized at random, and the other layers keep theirs.
+/// @param layer_index Index of the trainable layer.
+/// @param new_neurons_number New number of neurons of that layer.
+
+void NeuralNetwork::warm_start_neurons(const size_t& layer_index, const size_t& new_neurons_number)
+{
+    const Vector<Layer*> trainable_layers_pointers = get_trainable_layers_pointers();
+
+#ifdef __OPENNN_DEBUG__
+
+    const size_t trainable_layers_number = trainable_layers_pointers.size();
+
+    if(layer_index+1 >= trainable_layers_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: NeuralNetwork class.\n"
+               << "void warm_start_neurons(const size_t&, const size_t&) method.\n"
+               << "Layer index (" << layer_index << ") must be less than number of trainable layers minus one (" << trainable_layers_number-1 << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    Layer* layer_pointer = trainable_layers_pointers[layer_index];
+    Layer* next_layer_pointer = trainable_layers_pointers[layer_index+1];
+
+    const Layer::LayerType next_layer_type = next_layer_pointer->get_type();
+
+    if(layer_pointer->get_type() != Layer::Perceptron
+    ||(next_layer_type != Layer::Perceptron && next_layer_type != Layer::Probabilistic))
+    {
+        layer_pointer->set_neurons_number(new_neurons_number);
+        next_layer_pointer->set_inputs_number(new_neurons_number);
+
+        layer_pointer->randomize_parameters_normal(0.0, 1.0);
+        next_layer_pointer->randomize_parameters_normal(0.0, 1.0);
+
+        return;
+    }
+
+    PerceptronLayer* perceptron_layer_pointer = static_cast<PerceptronLayer*>(layer_pointer);
+
+    const size_t previous_neurons_number = perceptron_layer_pointer->get_neurons_number();
+    const size_t inputs_number = perceptron_layer_pointer->get_inputs_number();
+
+    const size_t kept_neurons_number = min(previous_neurons_number, new_neurons_number);
+
+    const Vector<double> previous_biases = perceptron_layer_pointer->get_biases();
+    const Matrix<double> previous_synaptic_weights = perceptron_layer_pointer->get_synaptic_weights();
+
+    const Matrix<double> previous_next_synaptic_weights = next_layer_type == Layer::Perceptron
+            ? static_cast<PerceptronLayer*>(next_layer_pointer)->get_synaptic_weights()
+            : static_cast<ProbabilisticLayer*>(next_layer_pointer)->get_synaptic_weights();
+
+    const size_t next_neurons_number = previous_next_synaptic_weights.get_columns_number();
+
+    // Layer
+
+    perceptron_layer_pointer->set_neurons_number(new_neurons_number);
+
+    perceptron_layer_pointer->randomize_parameters_normal(0.0, 1.0);
+
+    Vector<double> biases = perceptron_layer_pointer->get_biases();
+    Matrix<double> synaptic_weights = perceptron_layer_pointer->get_synaptic_weights();
+
+    for(size_t j = 0; j < kept_neurons_number; j++)
+    {
+        biases[j] = previous_biases[j];
+
+        for(size_t i = 0; i < inputs_number; i++)
+        {
+            synaptic_weights(i,j) = previous_synaptic_weights(i,j);
+        }
+    }
+
+    perceptron_layer_pointer->set_biases(biases);
+    perceptron_layer_pointer->set_synaptic_weights(synaptic_weights);
+
+    // Next layer
+
+    Matrix<double> next_synaptic_weights(new_neurons_number, next_neurons_number, 0.0);
+
+    for(size_t i = 0; i < kept_neurons_number; i++)
+    {
+        for(size_t j = 0; j < next_neurons_number; j++)
+        {
+            next_synaptic_weights(i,j) = previous_next_synaptic_weights(i,j);
+        }
+    }
+
+    if(next_layer_type == Layer::Perceptron)
+    {
+        static_cast<PerceptronLayer*>(next_layer_pointer)->set_synaptic_weights(next_synaptic_weights);
+    }
+    else
+    {
+        static_cast<ProbabilisticLayer*>(next_layer_pointer)->set_synaptic_weights(next_synaptic_weights);
+    }
+}
+
+
 /// Sets those members which are not pointer to their default values.
 
 void NeuralNetwork::set_default()
@@ -835,6 +1079,30 @@ Vector<size_t> NeuralNetwork::get_architecture() const
 }
 
 
+/// Returns the number of consecutive instances which make a sequence for the recurrent layers of the neural network.
+/// The batches of the data set must keep these sequences whole.
+/// If the neural network has neither a recurrent nor a long short term memory layer, it returns one.
+
+size_t NeuralNetwork::get_timesteps() const
+{
+    const size_t layers_number = get_layers_number();
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+        if(layers_pointers[i]->get_type() == Layer::Recurrent)
+        {
+            return dynamic_cast<RecurrentLayer*>(layers_pointers[i])->get_timesteps();
+        }
+        else if(layers_pointers[i]->get_type() == Layer::LongShortTermMemory)
+        {
+            return dynamic_cast<LongShortTermMemoryLayer*>(layers_pointers[i])->get_timesteps();
+        }
+    }
+
+    return 1;
+}
+
+
 /// Returns the number of parameters in the neural network
 /// The number of parameters is the sum of all the neural network parameters(biases and synaptic weights) and independent parameters.
 
@@ -1158,6 +1426,99 @@ void NeuralNetwork::perturbate_parameters(const double& perturbation)
 }
 
 
+/// Prepares the neural network for deployment by folding its affine scaling and unscaling into the adjacent layers.
+/// The scaling layer is folded into the synaptic weights and biases of the first perceptron or probabilistic layer,
+/// and an affine unscaling layer into those of a linear output perceptron layer.
+/// The folded layers are removed, so that the outputs are computed without their passes over the data.
+/// Non affine steps, such as logarithmic unscaling and bounding, are kept at the end of the neural network.
+/// The neural network should not be trained any more after this transformation.
+
+void NeuralNetwork::fuse_for_inference()
+{
+    // Scaling layer
+
+    if(get_layers_number() > 1 && layers_pointers[0]->get_type() == Layer::Scaling
+    &&(layers_pointers[1]->get_type() == Layer::Perceptron || layers_pointers[1]->get_type() == Layer::Probabilistic))
+    {
+        const ScalingLayer* scaling_layer_pointer = static_cast<ScalingLayer*>(layers_pointers[0]);
+
+        const Vector<double> scales = scaling_layer_pointer->calculate_scales();
+        const Vector<double> offsets = scaling_layer_pointer->calculate_offsets();
+
+        Matrix<double> synaptic_weights;
+        Vector<double> biases;
+
+        if(layers_pointers[1]->get_type() == Layer::Perceptron)
+        {
+            synaptic_weights = static_cast<PerceptronLayer*>(layers_pointers[1])->get_synaptic_weights();
+            biases = static_cast<PerceptronLayer*>(layers_pointers[1])->get_biases();
+        }
+        else
+        {
+            synaptic_weights = static_cast<ProbabilisticLayer*>(layers_pointers[1])->get_synaptic_weights();
+            biases = static_cast<ProbabilisticLayer*>(layers_pointers[1])->get_biases();
+        }
+
+        biases += dot(offsets, synaptic_weights);
+
+        const size_t inputs_number = synaptic_weights.get_rows_number();
+        const size_t neurons_number = synaptic_weights.get_columns_number();
+
+        for(size_t j = 0; j < neurons_number; j++)
+        {
+            for(size_t i = 0; i < inputs_number; i++)
+            {
+                synaptic_weights(i,j) *= scales[i];
+            }
+        }
+
+        if(layers_pointers[1]->get_type() == Layer::Perceptron)
+        {
+            static_cast<PerceptronLayer*>(layers_pointers[1])->set_synaptic_weights(synaptic_weights);
+            static_cast<PerceptronLayer*>(layers_pointers[1])->set_biases(biases);
+        }
+        else
+        {
+            static_cast<ProbabilisticLayer*>(layers_pointers[1])->set_synaptic_weights(synaptic_weights);
+            static_cast<ProbabilisticLayer*>(layers_pointers[1])->set_biases(biases);
+        }
+
+        delete layers_pointers[0];
+
+        layers_pointers = layers_pointers.delete_index(0);
+    }
+
+    // Unscaling layer
+
+    const size_t layers_number = get_layers_number();
+
+    for(size_t i = 1; i < layers_number; i++)
+    {
+        if(layers_pointers[i]->get_type() != Layer::Unscaling) continue;
+
+        const UnscalingLayer* unscaling_layer_pointer = static_cast<UnscalingLayer*>(layers_pointers[i]);
+
+        if(!unscaling_layer_pointer->is_affine() || layers_pointers[i-1]->get_type() != Layer::Perceptron) break;
+
+        PerceptronLayer* perceptron_layer_pointer = static_cast<PerceptronLayer*>(layers_pointers[i-1]);
+
+        if(perceptron_layer_pointer->get_activation_function() != PerceptronLayer::Linear) break;
+
+        const Vector<double> scales = unscaling_layer_pointer->calculate_scales();
+        const Vector<double> offsets = unscaling_layer_pointer->calculate_offsets();
+
+        perceptron_layer_pointer->set_synaptic_weights(perceptron_layer_pointer->get_synaptic_weights().multiply_rows(scales));
+        perceptron_layer_pointer->set_biases(perceptron_layer_pointer->get_biases()*scales + offsets);
+
+        delete layers_pointers[i];
+
+        layers_pointers = layers_pointers.delete_index(i);
+
+        break;
+    }
+}
+
+
 /// Calculates the outputs vector from the neural network in response to an inputs vector.
 /// The activity for that is the following:
 /// <ul>
@@ -3489,6 +3850,35 @@ Layer* NeuralNetwork::get_layer_pointer(const size_t& index) const
     return layers_pointers[index];
 }
 
+
+/// Constructor.
+/// It keeps the current parameters of a neural network.
+/// @param new_neural_network_pointer Pointer to the neural network.
+
+ScopedParameters::ScopedParameters(NeuralNetwork* new_neural_network_pointer)
+{
+    neural_network_pointer = new_neural_network_pointer;
+
+    parameters = neural_network_pointer->get_parameters();
+}
+
+
+/// Destructor.
+/// It sets again the kept parameters of the neural network.
+
+ScopedParameters::~ScopedParameters()
+{
+    neural_network_pointer->set_parameters(parameters);
+}
+
+
+/// Returns the parameters of the neural network when this object was created.
+
+const Vector<double>& ScopedParameters::get_parameters() const
+{
+    return parameters;
+}
+
 }
 
 // OpenNN: Open Neural Networks Library.
@@ -75,6 +75,10 @@ public:
 
    virtual ~NeuralNetwork();
 
+   // Assignment operator
+
+   NeuralNetwork& operator = (const NeuralNetwork&);
+
    // APPENDING LAYERS
 
    void add_layer(Layer*);
@@ -135,6 +139,9 @@ public:
    void set_inputs_number(const size_t&);
    void set_inputs_number(const Vector<bool>&);
 
+   void warm_start_inputs(const Vector<size_t>&, const Vector<size_t>&);
+   void warm_start_neurons(const size_t&, const size_t&);
+
    virtual void set_default();
 
    void set_layers_pointers(Vector<Layer*>&);
@@ -157,6 +164,8 @@ public:
 
    Vector<size_t> get_architecture() const;
 
+   size_t get_timesteps() const;
+
    // Parameters
 
    size_t get_parameters_number() const;
@@ -185,6 +194,10 @@ public:
 
    void perturbate_parameters(const double&);
 
+   // Inference
+
+   void fuse_for_inference();
+
    // Output 
 
    Tensor<double> calculate_outputs(const Tensor<double>&);
@@ -258,6 +271,44 @@ protected:
    bool display = true;
 };
 
+
+/// This class keeps the parameters of a neural network while it exists.
+///
+/// It is used to evaluate a network at other parameters, as in a line search.
+/// The kept parameters are set again when this object is destroyed, also when an exception is thrown.
+
+class ScopedParameters
+{
+
+public:
+
+   // Constructors
+
+   explicit ScopedParameters(NeuralNetwork*);
+
+   ScopedParameters(const ScopedParameters&) = delete;
+
+   ScopedParameters& operator = (const ScopedParameters&) = delete;
+
+   // Destructor
+
+   virtual ~ScopedParameters();
+
+   // Get methods
+
+   const Vector<double>& get_parameters() const;
+
+private:
+
+   /// Pointer to the neural network whose parameters are kept.
+
+   NeuralNetwork* neural_network_pointer;
+
+   /// Parameters of the neural network when this object was created.
+
+   Vector<double> parameters;
+};
+
 }
 
 #endif
@@ -84,6 +84,23 @@ TrainingStrategy* NeuronsSelection::get_training_strategy_pointer() const
 }
 
 
+/// Returns a constant reference to the cache with the results of the neural networks already trained.
+
+const EvaluationCache& NeuronsSelection::get_evaluation_cache() const
+{
+    return evaluation_cache;
+}
+
+
+/// Returns a pointer to the cache with the results of the neural networks already trained.
+/// It can be used to load the results of a previous search before performing the neurons selection.
+
+EvaluationCache* NeuronsSelection::get_evaluation_cache_pointer()
+{
+    return &evaluation_cache;
+}
+
+
 /// Returns true if this order selection algorithm has a training strategy associated, and false otherwise.
 
 bool NeuronsSelection::has_training_strategy() const
@@ -123,6 +140,70 @@ const size_t& NeuronsSelection::get_trials_number() const
 }
 
 
+/// Returns true if the candidates are initialized from the parameters of the previous ones, and false otherwise.
+
+const bool& NeuronsSelection::get_warm_start() const
+{
+    return warm_start;
+}
+
+
+/// Returns the maximum number of epochs for fine-tuning a warm-started candidate.
+
+const size_t& NeuronsSelection::get_warm_start_epochs_number() const
+{
+    return warm_start_epochs_number;
+}
+
+
+/// Returns true if the candidates are trained by successive halving, and false otherwise.
+
+const bool& NeuronsSelection::get_successive_halving() const
+{
+    return successive_halving;
+}
+
+
+/// Returns the number of epochs of the first round of successive halving.
+
+const size_t& NeuronsSelection::get_successive_halving_epochs_number() const
+{
+    return successive_halving_epochs_number;
+}
+
+
+/// Returns the number of threads which train the trials of a candidate concurrently.
+
+const size_t& NeuronsSelection::get_trials_workers_number() const
+{
+    return trials_workers_number;
+}
+
+
+/// Returns the name of the binary file where the state of the search is saved.
+
+const string& NeuronsSelection::get_checkpoint_file_name() const
+{
+    return checkpoint_file_name;
+}
+
+
+/// Returns the number of iterations between two checkpoints.
+
+const size_t& NeuronsSelection::get_checkpoint_period() const
+{
+    return checkpoint_period;
+}
+
+
+/// Returns true if the search starts from the state saved in the checkpoint file, and false otherwise.
+
+const bool& NeuronsSelection::get_resume_from_checkpoint() const
+{
+    return resume_from_checkpoint;
+}
+
+
 /// Returns true if the loss index losses are to be reserved, and false otherwise.
 
 const bool& NeuronsSelection::get_reserve_error_data() const
@@ -224,6 +305,18 @@ void NeuronsSelection::set_default()
     maximum_order = 2*(inputs_number + outputs_number);
     trials_number = 1;
 
+    warm_start = false;
+    warm_start_epochs_number = 100;
+
+    successive_halving = false;
+    successive_halving_epochs_number = 10;
+
+    trials_workers_number = 1;
+
+    checkpoint_file_name = "";
+    checkpoint_period = 1;
+    resume_from_checkpoint = false;
+
     // Order selection results
 
     reserve_error_data = true;
@@ -335,6 +428,140 @@ void NeuronsSelection::set_trials_number(const size_t& new_trials_number)
 }
 
 
+/// Sets whether the candidates are initialized from the parameters of the previous ones and fine-tuned,
+/// instead of being trained from scratch.
+/// @param new_warm_start True to warm-start the candidates, false otherwise.
+
+void NeuronsSelection::set_warm_start(const bool& new_warm_start)
+{
+    warm_start = new_warm_start;
+}
+
+
+/// Sets the maximum number of epochs for fine-tuning a warm-started candidate.
+/// @param new_warm_start_epochs_number Maximum number of epochs.
+
+void NeuronsSelection::set_warm_start_epochs_number(const size_t& new_warm_start_epochs_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_warm_start_epochs_number == 0)
+    {
+        ostringstream buffer;
+        buffer << "OpenNN Exception: NeuronsSelection class.\n"
+               << "void set_warm_start_epochs_number(const size_t&) method.\n"
+               << "Number of epochs must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    warm_start_epochs_number = new_warm_start_epochs_number;
+}
+
+
+/// Sets whether the candidates are trained by successive halving instead of each one with the full budget.
+/// @param new_successive_halving True to train the candidates by successive halving, false otherwise.
+
+void NeuronsSelection::set_successive_halving(const bool& new_successive_halving)
+{
+    successive_halving = new_successive_halving;
+}
+
+
+/// Sets the number of epochs of the first round of successive halving.
+/// It is doubled in each of the following rounds.
+/// @param new_successive_halving_epochs_number Number of epochs.
+
+void NeuronsSelection::set_successive_halving_epochs_number(const size_t& new_successive_halving_epochs_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_successive_halving_epochs_number == 0)
+    {
+        ostringstream buffer;
+        buffer << "OpenNN Exception: NeuronsSelection class.\n"
+               << "void set_successive_halving_epochs_number(const size_t&) method.\n"
+               << "Number of epochs must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    successive_halving_epochs_number = new_successive_halving_epochs_number;
+}
+
+
+/// Sets the number of threads which train the trials of a candidate concurrently.
+/// The initial parameters of the trials do not depend on this number, only the wall time of the training does.
+/// @param new_trials_workers_number Number of threads. If it is 1, the trials are trained sequentially.
+
+void NeuronsSelection::set_trials_workers_number(const size_t& new_trials_workers_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_trials_workers_number == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: NeuronsSelection class.\n"
+               << "void set_trials_workers_number(const size_t&) method.\n"
+               << "Number of workers must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    trials_workers_number = new_trials_workers_number;
+}
+
+
+/// Sets the name of the binary file where the state of the search is saved periodically.
+/// @param new_checkpoint_file_name Name of the file. If it is empty, no checkpoints are saved.
+
+void NeuronsSelection::set_checkpoint_file_name(const string& new_checkpoint_file_name)
+{
+    checkpoint_file_name = new_checkpoint_file_name;
+}
+
+
+/// Sets the number of iterations between two checkpoints.
+/// @param new_checkpoint_period Number of iterations.
+
+void NeuronsSelection::set_checkpoint_period(const size_t& new_checkpoint_period)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_checkpoint_period == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: NeuronsSelection class.\n"
+               << "void set_checkpoint_period(const size_t&) method.\n"
+               << "Checkpoint period must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    checkpoint_period = new_checkpoint_period;
+}
+
+
+/// Sets whether the search starts from the state saved in the checkpoint file.
+/// If the file does not exist, the search starts from the beginning.
+/// @param new_resume_from_checkpoint True to resume the search, false otherwise.
+
+void NeuronsSelection::set_resume_from_checkpoint(const bool& new_resume_from_checkpoint)
+{
+    resume_from_checkpoint = new_resume_from_checkpoint;
+}
+
+
 /// Sets the reserve flag for the loss data.
 /// @param new_reserve_error_data Flag value.
 
@@ -522,40 +749,24 @@ Vector<double> NeuronsSelection::calculate_losses(const size_t& neurons_number,
 
     Vector<double> final_parameters;
 
-    bool flag_training = false;
-    bool flag_selection = false;
+    const EvaluationCache::Evaluation* evaluation = evaluation_cache.find(neurons_number);
 
-    for(size_t i = 0; i < order_history.size(); i++)
+    if(evaluation)
     {
-        if(order_history[i] == neurons_number)
-        {
-            final_losses[0] = training_loss_history[i];
-            flag_training = true;
-        }
-    }
+        final_losses[0] = evaluation->training_error;
+        final_losses[1] = evaluation->selection_error;
 
-    for(size_t i = 0; i < order_history.size(); i++)
-    {
-        if(order_history[i] == neurons_number)
-        {
-            final_losses[1] = selection_error_history[i];
-            flag_selection = true;
-        }
-    }
-
-    if(flag_training && flag_selection)
-    {
         return final_losses;
     }
 
     trainable_layers_pointers[trainable_layers_number-2]->set_neurons_number(neurons_number); // Fix
     trainable_layers_pointers[trainable_layers_number-1]->set_inputs_number(neurons_number); // Fix
 
+    const Vector<OptimizationAlgorithm::Results> trials_results = perform_trials(neural_network);
+
     for(size_t i = 0; i < trials_number; i++)
     {
-        neural_network.randomize_parameters_normal();
-
-        const OptimizationAlgorithm::Results optimization_algorithm_results = training_strategy_pointer->perform_training();
+        const OptimizationAlgorithm::Results& optimization_algorithm_results = trials_results[i];
 
         const double current_training_error = optimization_algorithm_results.final_training_error;
         const double current_selection_error = optimization_algorithm_results.final_selection_error;
@@ -591,10 +802,216 @@ Vector<double> NeuronsSelection::calculate_losses(const size_t& neurons_number,
 
     parameters_history.push_back(optimum_parameters);
 
+    evaluation_cache.insert(neurons_number, EvaluationCache::Evaluation(final_losses[0], final_losses[1], optimum_parameters));
+
     return final_losses;
 }
 
 
+/// Trains the neural network trials_number times, each time from different random initial parameters,
+/// and returns the results of all the trials, in order.
+/// The initial parameters and the random generators of the trials are drawn in the order of the trials before any training starts,
+/// so that the results do not depend on the number of threads.
+/// If trials_workers_number is greater than 1, the trials are trained concurrently, each thread on its own copy of the neural network,
+/// and the neural network is left with the initial parameters of the last trial.
+/// @param neural_network Neural network of the training strategy, with the number of hidden neurons of the candidate.
+
+Vector<OptimizationAlgorithm::Results> NeuronsSelection::perform_trials(NeuralNetwork& neural_network) const
+{
+    Vector<Vector<double>> trials_initial_parameters(trials_number);
+
+    vector<RandomGenerator> trials_generators;
+
+    for(size_t i = 0; i < trials_number; i++)
+    {
+        neural_network.randomize_parameters_normal();
+
+        trials_initial_parameters[i] = neural_network.get_parameters();
+
+        trials_generators.push_back(get_random_generator().split(i));
+    }
+
+    Vector<OptimizationAlgorithm::Results> trials_results(trials_number);
+
+    const size_t threads_number = min(trials_workers_number, trials_number);
+
+    if(threads_number <= 1)
+    {
+        for(size_t i = 0; i < trials_number; i++)
+        {
+            ScopedRandomGenerator trial_generator(trials_generators[i]);
+
+            neural_network.set_parameters(trials_initial_parameters[i]);
+
+            trials_results[i] = training_strategy_pointer->perform_training();
+        }
+
+        return trials_results;
+    }
+
+    DataSet* data_set_pointer = training_strategy_pointer->get_loss_index_pointer()->get_data_set_pointer();
+
+    atomic<size_t> next_trial(0);
+
+    vector<exception_ptr> workers_exceptions(threads_number);
+
+    vector<thread> workers;
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers.push_back(thread([&, i]()
+        {
+            try
+            {
+                NeuralNetwork trial_neural_network(neural_network);
+
+                TrainingStrategy trial_training_strategy(&trial_neural_network, data_set_pointer);
+
+                trial_training_strategy.set_methods(*training_strategy_pointer);
+
+                trial_training_strategy.set_display(false);
+
+                for(size_t j = next_trial++; j < trials_number; j = next_trial++)
+                {
+                    ScopedRandomGenerator trial_generator(trials_generators[j]);
+
+                    trial_neural_network.set_parameters(trials_initial_parameters[j]);
+
+                    trials_results[j] = trial_training_strategy.perform_training();
+                }
+            }
+            catch(...)
+            {
+                workers_exceptions[i] = current_exception();
+            }
+        }));
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        workers[i].join();
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        if(workers_exceptions[i]) rethrow_exception(workers_exceptions[i]);
+    }
+
+    return trials_results;
+}
+
+
+/// Trains a set of candidate numbers of hidden neurons by successive halving.
+/// In the first round all the candidates are trained for successive_halving_epochs_number epochs.
+/// Then the worse half of them, by selection error, is dropped, and the rest continue training for twice the epochs.
+/// The last candidate left is trained with the full budget of the training strategy.
+/// The neural network is left with the architecture and parameters of the last candidate trained.
+/// Returns the index of the best candidate.
+/// @param candidates_neurons_numbers Number of neurons in the last hidden layer of each candidate.
+/// @param candidates_losses Training and selection errors of each candidate after its last round.
+/// @param candidates_parameters Parameters of each candidate after its last round.
+
+size_t NeuronsSelection::perform_successive_halving(const Vector<size_t>& candidates_neurons_numbers,
+                                                    Matrix<double>& candidates_losses,
+                                                    Vector<Vector<double>>& candidates_parameters)
+{
+    const size_t candidates_number = candidates_neurons_numbers.size();
+
+#ifdef __OPENNN_DEBUG__
+
+    if(candidates_number == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: NeuronsSelection class.\n"
+               << "size_t perform_successive_halving(const Vector<size_t>&, Matrix<double>&, Vector<Vector<double>>&) method.\n"
+               << "Number of candidates must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    NeuralNetwork* neural_network_pointer = training_strategy_pointer->get_neural_network_pointer();
+
+    const size_t trainable_layers_number = neural_network_pointer->get_trainable_layers_number();
+
+    const Vector<Layer*> trainable_layers_pointers = neural_network_pointer->get_trainable_layers_pointers();
+
+    // Rounds are trained with a copy of the training strategy, so that its budget can be changed
+
+    DataSet* data_set_pointer = training_strategy_pointer->get_loss_index_pointer()->get_data_set_pointer();
+
+    TrainingStrategy round_training_strategy(neural_network_pointer, data_set_pointer);
+
+    round_training_strategy.set_methods(*training_strategy_pointer);
+
+    candidates_losses.set(candidates_number, 2, numeric_limits<double>::max());
+    candidates_parameters.set(candidates_number);
+
+    auto train_candidate = [&](const size_t& candidate_index, TrainingStrategy& training_strategy)
+    {
+        trainable_layers_pointers[trainable_layers_number-2]->set_neurons_number(candidates_neurons_numbers[candidate_index]);
+        trainable_layers_pointers[trainable_layers_number-1]->set_inputs_number(candidates_neurons_numbers[candidate_index]);
+
+        if(candidates_parameters[candidate_index].empty())
+        {
+            neural_network_pointer->randomize_parameters_normal();
+        }
+        else
+        {
+            neural_network_pointer->set_parameters(candidates_parameters[candidate_index]);
+        }
+
+        const OptimizationAlgorithm::Results results = training_strategy.perform_training();
+
+        candidates_losses(candidate_index,0) = results.final_training_error;
+        candidates_losses(candidate_index,1) = results.final_selection_error;
+
+        candidates_parameters[candidate_index] = results.final_parameters;
+    };
+
+    Vector<size_t> survivors_indices(0, 1, candidates_number-1);
+
+    size_t epochs_number = successive_halving_epochs_number;
+
+    while(survivors_indices.size() > 1)
+    {
+        round_training_strategy.set_maximum_epochs_number(epochs_number);
+
+        const size_t survivors_number = survivors_indices.size();
+
+        Vector<double> survivors_selection_errors(survivors_number);
+
+        for(size_t i = 0; i < survivors_number; i++)
+        {
+            train_candidate(survivors_indices[i], round_training_strategy);
+
+            survivors_selection_errors[i] = candidates_losses(survivors_indices[i],1);
+        }
+
+        if(display)
+        {
+            cout << "Successive halving round with " << epochs_number << " epochs" << endl;
+            cout << "Candidates: " << survivors_number << endl;
+            cout << "Minimum selection error: " << minimum(survivors_selection_errors) << endl << endl;
+        }
+
+        const Vector<size_t> sorted_indices = survivors_selection_errors.sort_ascending_indices();
+
+        survivors_indices = survivors_indices.get_subvector(sorted_indices.get_first((survivors_number+1)/2));
+
+        epochs_number *= 2;
+    }
+
+    // Full training of the best candidate
+
+    train_candidate(survivors_indices[0], *training_strategy_pointer);
+
+    return survivors_indices[0];
+}
+
+
 /// Return final training loss and final selection error depending on the training method.
 /// @param results Results of the perform_training method.
 /*
@@ -665,6 +1082,72 @@ Vector<double> NeuronsSelection::get_final_losses(const OptimizationAlgorithm::R
 */
 
 
+/// Returns true if the state of the search is to be saved after the given iteration, and false otherwise.
+/// @param iteration Index of the iteration.
+
+bool NeuronsSelection::is_checkpoint_iteration(const size_t& iteration) const
+{
+    return !checkpoint_file_name.empty() && (iteration+1)%checkpoint_period == 0;
+}
+
+
+/// Loads the checkpoint file, if the search is to be resumed and that file exists.
+/// It restores the histories, the evaluation cache and the state of the random number generator,
+/// and returns true, so that the algorithm can restore its own state from the checkpoint.
+/// @param checkpoint Checkpoint where the file is loaded.
+
+bool NeuronsSelection::load_checkpoint(Checkpoint& checkpoint)
+{
+    if(!resume_from_checkpoint || !Checkpoint::exists(checkpoint_file_name)) return false;
+
+    checkpoint.load(checkpoint_file_name);
+
+    order_history = checkpoint.get_indices("OrderHistory");
+    training_loss_history = checkpoint.get_vector("TrainingLossHistory");
+    selection_error_history = checkpoint.get_vector("SelectionErrorHistory");
+    parameters_history = checkpoint.get_vectors("ParametersHistory");
+
+    evaluation_cache = checkpoint.get_evaluation_cache();
+
+    get_random_generator() = checkpoint.get_generator("RandomGenerator");
+
+    if(display) cout << "Resuming from checkpoint: " << checkpoint_file_name << endl;
+
+    return true;
+}
+
+
+/// Saves the state of the search to the checkpoint file.
+/// The algorithm sets its own state in the checkpoint, and this method adds the histories, the evaluation cache
+/// and the state of the random number generator.
+/// A resumed search continues with the same random numbers.
+/// @param checkpoint Checkpoint with the state of the algorithm.
+
+void NeuronsSelection::save_checkpoint(Checkpoint& checkpoint) const
+{
+    checkpoint.set_generator("RandomGenerator", get_random_generator());
+
+    checkpoint.set_indices("OrderHistory", order_history);
+    checkpoint.set_vector("TrainingLossHistory", training_loss_history);
+    checkpoint.set_vector("SelectionErrorHistory", selection_error_history);
+    checkpoint.set_vectors("ParametersHistory", parameters_history);
+
+    checkpoint.set_evaluation_cache(evaluation_cache);
+
+    checkpoint.save(checkpoint_file_name);
+}
+
+
+/// Removes the checkpoint file, once the search has finished.
+
+void NeuronsSelection::remove_checkpoint() const
+{
+    if(checkpoint_file_name.empty()) return;
+
+    remove(checkpoint_file_name.c_str());
+}
+
+
 /// Return a string with the stopping condition of the training depending on the training method.
 /// @param results Results of the perform_training method.
 
@@ -675,18 +1158,24 @@ string NeuronsSelection::write_stopping_condition(const OptimizationAlgorithm::R
 
 
 /// Delete the history of the selection error values.
+/// The cache of trained neural networks is also cleared, since it can no longer be matched with the history.
 
 void NeuronsSelection::delete_selection_history()
 {
     selection_error_history.set();
+
+    evaluation_cache.clear();
 }
 
 
 /// Delete the history of the loss values.
+/// The cache of trained neural networks is also cleared, since it can no longer be matched with the history.
 
 void NeuronsSelection::delete_training_loss_history()
 {
     training_loss_history.set();
+
+    evaluation_cache.clear();
 }
 
 
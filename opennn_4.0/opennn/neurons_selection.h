@@ -17,6 +17,9 @@
 #include <sstream>
 #include <cmath>
 #include <ctime>
+#include <thread>
+#include <atomic>
+#include <exception>
 
 // OpenNN includes
 
@@ -24,6 +27,8 @@
 #include "matrix.h"
 
 #include "training_strategy.h"
+#include "evaluation_cache.h"
+#include "checkpoint.h"
 
 #include "tinyxml2.h"
 
@@ -120,12 +125,27 @@ public:
 
     TrainingStrategy* get_training_strategy_pointer() const;
 
+    const EvaluationCache& get_evaluation_cache() const;
+    EvaluationCache* get_evaluation_cache_pointer();
+
     bool has_training_strategy() const;
 
     const size_t& get_maximum_order() const;
     const size_t& get_minimum_order() const;
     const size_t& get_trials_number() const;
 
+    const bool& get_warm_start() const;
+    const size_t& get_warm_start_epochs_number() const;
+
+    const bool& get_successive_halving() const;
+    const size_t& get_successive_halving_epochs_number() const;
+
+    const size_t& get_trials_workers_number() const;
+
+    const string& get_checkpoint_file_name() const;
+    const size_t& get_checkpoint_period() const;
+    const bool& get_resume_from_checkpoint() const;
+
     const bool& get_reserve_error_data() const;
     const bool& get_reserve_selection_error_data() const;
     const bool& get_reserve_minimal_parameters() const;
@@ -147,6 +167,18 @@ public:
     void set_minimum_order(const size_t&);
     void set_trials_number(const size_t&);
 
+    void set_warm_start(const bool&);
+    void set_warm_start_epochs_number(const size_t&);
+
+    void set_successive_halving(const bool&);
+    void set_successive_halving_epochs_number(const size_t&);
+
+    void set_trials_workers_number(const size_t&);
+
+    void set_checkpoint_file_name(const string&);
+    void set_checkpoint_period(const size_t&);
+    void set_resume_from_checkpoint(const bool&);
+
     void set_reserve_error_data(const bool&);
     void set_reserve_selection_error_data(const bool&);
     void set_reserve_minimal_parameters(const bool&);
@@ -162,6 +194,10 @@ public:
 
     Vector<double> calculate_losses(const size_t&, NeuralNetwork&);
 
+    Vector<OptimizationAlgorithm::Results> perform_trials(NeuralNetwork&) const;
+
+    size_t perform_successive_halving(const Vector<size_t>&, Matrix<double>&, Vector<Vector<double>>&);
+
     string write_stopping_condition(const OptimizationAlgorithm::Results&) const;
 
     // order order selection methods
@@ -194,6 +230,10 @@ protected:
 
     Vector<Vector<double>> parameters_history;
 
+    /// Training and selection errors and parameters of all the neural networks trained, indexed by their number of hidden neurons.
+
+    EvaluationCache evaluation_cache;
+
     /// Minimum number of hidden neurons.
 
     size_t minimum_order;
@@ -206,6 +246,49 @@ protected:
 
     size_t trials_number;
 
+    /// True if each candidate is initialized from the parameters of the previous one, and then fine-tuned in a single trial.
+    /// Only the parameters of the added or removed hidden neurons are changed.
+
+    bool warm_start;
+
+    /// Maximum number of epochs of the fine-tuning of a warm-started candidate.
+
+    size_t warm_start_epochs_number;
+
+    /// True if the candidates are trained by successive halving: all of them for a few epochs,
+    /// then only the better half with twice the epochs, until one is left, which is trained with the full budget.
+
+    bool successive_halving;
+
+    /// Number of epochs of the first round of successive halving.
+
+    size_t successive_halving_epochs_number;
+
+    /// Number of threads which train the trials of a candidate concurrently, each one on its own copy of the neural network.
+    /// If it is 1, the trials are trained sequentially.
+
+    size_t trials_workers_number;
+
+    /// Name of the binary file where the state of the search is saved periodically. If it is empty, no checkpoints are saved.
+
+    string checkpoint_file_name;
+
+    /// Number of iterations between two checkpoints.
+
+    size_t checkpoint_period;
+
+    /// True if the search starts from the state saved in the checkpoint file, when that file exists.
+
+    bool resume_from_checkpoint;
+
+    // Checkpoint methods
+
+    bool is_checkpoint_iteration(const size_t&) const;
+
+    bool load_checkpoint(Checkpoint&);
+    void save_checkpoint(Checkpoint&) const;
+    void remove_checkpoint() const;
+
     // Order selection results
 
     /// True if the loss of all neural networks are to be reserved.
@@ -66,6 +66,7 @@ public:
    // Get methods
 
     double get_normalization_coefficient() const;
+    double get_selection_normalization_coefficient() const;
 
    // Set methods
 
@@ -88,6 +89,8 @@ public:
 
    double calculate_selection_error() const;
 
+   double get_selection_error_normalization() const;
+
    double calculate_batch_error(const Vector<size_t>&) const;
    double calculate_batch_error(const Vector<size_t>&, const Vector<double>&) const;
 
@@ -112,6 +115,9 @@ public:
 
    LossIndex::SecondOrderLoss calculate_terms_second_order_loss() const;
 
+   Vector<double> calculate_terms_hessian_product(const Vector<double>&) const;
+   Vector<double> calculate_terms_hessian_diagonal() const;
+
    string get_error_type() const;
    string get_error_type_text() const;
 
@@ -9,11 +9,13 @@
 #ifndef OPENNN_H
 #define OPENNN_H
 
+#include "random.h"
 #include "statistics.h"
 
 // Data set
 
 #include "data_set.h"
+#include "data_set_view.h"
 
 // Neural network
 
@@ -46,12 +48,15 @@
 #include "quasi_newton_method.h"
 #include "optimization_algorithm.h"
 #include "learning_rate_algorithm.h"
+#include "learning_rate_schedule.h"
 
 // Model selection
 
 #include "model_selection.h"
 #include "neurons_selection.h"
 #include "incremental_neurons.h"
+#include "evaluation_cache.h"
+#include "checkpoint.h"
 #include "inputs_selection.h"
 #include "growing_inputs.h"
 #include "pruning_inputs.h"
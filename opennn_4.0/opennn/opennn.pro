@@ -49,6 +49,7 @@ INCLUDEPATH += eigen
 
 HEADERS += \
     tinyxml2.h \
+    random.h \
     vector.h \
     matrix.h \
     tensor.h \
@@ -73,6 +74,7 @@ HEADERS += \
     principal_components_layer.h \
     loss_index.h \
     data_set.h \
+    data_set_view.h \
     neural_network.h \
     sum_squared_error.h\
     normalized_squared_error.h\
@@ -83,6 +85,9 @@ HEADERS += \
     training_strategy.h \
     optimization_algorithm.h \
     learning_rate_algorithm.h \
+    learning_rate_schedule.h \
+    evaluation_cache.h \
+    checkpoint.h \
     quasi_newton_method.h \
     levenberg_marquardt_algorithm.h\
     gradient_descent.h \
@@ -103,6 +108,7 @@ HEADERS += \
 
 SOURCES += \
     tinyxml2.cpp \
+    random.cpp \
     functions.cpp \
     statistics.cpp \
     opennn_strings.cpp \
@@ -124,6 +130,7 @@ SOURCES += \
     principal_components_layer.cpp \
     loss_index.cpp \
     data_set.cpp \
+    data_set_view.cpp \
     neural_network.cpp \
     sum_squared_error.cpp \
     normalized_squared_error.cpp \
@@ -134,6 +141,9 @@ SOURCES += \
     training_strategy.cpp \
     optimization_algorithm.cpp \
     learning_rate_algorithm.cpp \
+    learning_rate_schedule.cpp \
+    evaluation_cache.cpp \
+    checkpoint.cpp \
     quasi_newton_method.cpp \
     levenberg_marquardt_algorithm.cpp \
     gradient_descent.cpp \
@@ -37,6 +37,8 @@ PrincipalComponentsLayer::PrincipalComponentsLayer(const size_t& new_inputs_numb
 PrincipalComponentsLayer::PrincipalComponentsLayer(const PrincipalComponentsLayer& new_principal_components_layer) : Layer()
 {
     set(new_principal_components_layer);
+
+    layer_type = Layer::PrincipalComponents;
 }
 
 
@@ -161,78 +163,57 @@ size_t PrincipalComponentsLayer::get_neurons_number() const
 
 
 /// Performs the principal component analysis to produce a reduced data set.
+/// The centered inputs are projected onto the principal components with a single matrix product.
 /// @param inputs Set of inputs to the principal components layer.
 
 Tensor<double> PrincipalComponentsLayer::calculate_outputs(const Tensor<double>& inputs)
 {
-/*
-    const size_t inputs_number = inputs.get_columns_number();    
+    const size_t points_number = inputs.get_dimension(0);
+    const size_t inputs_number = inputs.get_dimension(1);
 
     #ifdef __OPENNN_DEBUG__
 
-    ostringstream buffer;
-
-    if(principal_components.get_rows_number() != inputs_number)
+    if(principal_components.get_columns_number() != inputs_number)
     {
+       ostringstream buffer;
+
        buffer << "OpenNN Exception: PrincipalComponentsLayer class.\n"
-              << "Matrix<double> calculate_outputs(Matrix Vector<double>&) const method.\n"
-              << "Size of inputs must be equal to the number of rows of the principal components matrix.\n";
+              << "Tensor<double> calculate_outputs(const Tensor<double>&) method.\n"
+              << "Size of inputs must be equal to the number of columns of the principal components matrix.\n";
 
        throw logic_error(buffer.str());
     }
 
     #endif
 
-    if(write_principal_components_method() != "PrincipalComponents")
+    if(principal_components_method == NoPrincipalComponents)
     {
         return inputs;
     }
 
-        const Vector<size_t> principal_components_indices(0, 1.0, get_principal_components_number()-1);
-
-        const Vector<size_t> inputs_indices(0, 1.0, inputs_number-1);
-
-        const Matrix<double> used_principal_components = principal_components.get_submatrix(principal_components_indices, inputs_indices);
+    const size_t principal_components_number = get_principal_components_number();
 
-        const Matrix<double> inputs_adjust = inputs.subtract_rows(means);
+    Tensor<double> inputs_adjust(inputs);
 
-        return dot(inputs_adjust, used_principal_components.calculate_transpose());
+    for(size_t j = 0; j < inputs_number; j++)
+    {
+        double* column = inputs_adjust.data() + j*points_number;
 
-        for(size_t i = 0;  i < points_number; i++)
+        for(size_t i = 0; i < points_number; i++)
         {
-            const Vector<size_t> principal_components_indices(0, 1.0, get_principal_components_number()-1);
-
-            const Vector<size_t> inputs_indices(0, 1.0, inputs_number-1);
-
-            const Matrix<double> used_principal_components = principal_components.get_submatrix(principal_components_indices, inputs_indices);
-
-            // Data adjust
-
-            const Matrix<double> inputs_adjust = inputs.subtract_rows(means);
-
-//            Vector<double> inputs_adjust(inputs_number);
-
-//            for(size_t j = 0; j < inputs_number; j++)
-//            {
-//                inputs_adjust[j] = inputs[j] - means[j];
-//            }
-
-            // Outputs
-
-            const size_t principal_components_number = used_principal_components.get_rows_number();
+            column[i] -= means[j];
+        }
+    }
 
-            Matrix<double> outputs(points_number, principal_components_number);
+    Tensor<double> outputs(points_number, principal_components_number);
 
-            for(size_t j = 0; j < principal_components_number; j++)
-            {
-                outputs(i,j) = inputs_adjust.dot(used_principal_components.get_row(j));
-            }
+    const Eigen::Map<Eigen::MatrixXd> inputs_eigen(inputs_adjust.data(), static_cast<int>(points_number), static_cast<int>(inputs_number));
+    const Eigen::Map<Eigen::MatrixXd> principal_components_eigen((double*)principal_components.data(), static_cast<int>(principal_components.get_rows_number()), static_cast<int>(inputs_number));
+    Eigen::Map<Eigen::MatrixXd> outputs_eigen(outputs.data(), static_cast<int>(points_number), static_cast<int>(principal_components_number));
 
-        }
+    outputs_eigen.noalias() = inputs_eigen*principal_components_eigen.topRows(static_cast<int>(principal_components_number)).transpose();
 
-        return outputs;
-    */
-    return Tensor<double>();
+    return outputs;
 }
 
 
@@ -43,6 +43,8 @@ ProbabilisticLayer::ProbabilisticLayer(const size_t& new_inputs_number, const si
 ProbabilisticLayer::ProbabilisticLayer(const ProbabilisticLayer& other_probabilistic_layer)
 {
     set(other_probabilistic_layer);
+
+    layer_type = Probabilistic;
 }
 
 
@@ -208,14 +208,12 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
 
     DataSet* data_set_pointer = loss_index_pointer->get_data_set_pointer();
 
-    const size_t inputs_number = data_set_pointer->get_input_columns_number();
+    if(pre_screening) perform_pre_screening();
 
-    const Vector<size_t> inputs_variables_indices = data_set_pointer->get_input_variables_indices();
+    const size_t inputs_number = data_set_pointer->get_input_columns_number();
 
     const size_t used_columns_number = data_set_pointer->get_used_columns_number();
 
-    const Vector<string> used_columns_names = data_set_pointer->get_used_columns_names();
-
     const Matrix<double> correlations = data_set_pointer->calculate_input_target_columns_correlations_double();
 
     const Vector<double> total_correlations = absolute_value(correlations.calculate_rows_sum());
@@ -228,14 +226,22 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
 
     NeuralNetwork* neural_network_pointer = training_strategy_pointer->get_neural_network_pointer();
 
+    // Candidates are trained on a view of the data set, so that its columns uses are not modified during the selection
+
+    ModelReplica replica(*training_strategy_pointer);
+
+    Vector<bool> current_inputs(inputs_number, true);
+
     // Optimization algorithm
 
-    Vector<size_t> current_columns_indices = inputs_variables_indices;
+    Vector<size_t> current_columns_indices(0, 1, inputs_number-1);
 
     Vector<size_t> optimal_columns_indices;
 
     Vector<double> optimal_parameters;
 
+    Vector<double> previous_parameters;
+
     size_t selection_failures = 0;
 
     time_t beginning_time, current_time;
@@ -245,11 +251,80 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
 
     bool end_algorithm = false;
 
+    // Successive halving
+
+    if(successive_halving)
+    {
+        // Candidates are the sets of inputs left after removing the least correlated ones
+
+        const size_t candidates_number = inputs_number - min(max(minimum_inputs_number, static_cast<size_t>(1)), inputs_number) + 1;
+
+        Vector<Vector<bool>> candidates_inputs(candidates_number);
+
+        for(size_t i = 0; i < candidates_number; i++)
+        {
+            if(i > 0) current_inputs[correlations_ascending_indices[i-1]] = false;
+
+            candidates_inputs[i] = current_inputs;
+        }
+
+        current_inputs.initialize(true);
+
+        Matrix<double> candidates_losses;
+        Vector<Vector<double>> candidates_parameters;
+
+        const size_t optimal_candidate_index = perform_successive_halving(candidates_inputs, candidates_losses, candidates_parameters);
+
+        optimal_columns_indices = candidates_inputs[optimal_candidate_index].get_indices_equal_to(true);
+        optimal_parameters = candidates_parameters[optimal_candidate_index];
+        optimum_training_error = candidates_losses(optimal_candidate_index,0);
+        optimum_selection_error = candidates_losses(optimal_candidate_index,1);
+
+        time(&current_time);
+
+        elapsed_time = difftime(current_time,beginning_time);
+
+        results->stopping_condition = InputsSelection::AlgorithmFinished;
+
+        end_algorithm = true;
+    }
+
+    // Checkpoint
+
+    Checkpoint checkpoint;
+
+    size_t first_epoch = 0;
+
+    if(!end_algorithm && load_checkpoint(checkpoint))
+    {
+        first_epoch = checkpoint.get_size_t("Epoch");
+
+        current_inputs = checkpoint.get_bool_vector("CurrentInputs");
+        current_columns_indices = checkpoint.get_indices("CurrentColumnsIndices");
+        previous_parameters = checkpoint.get_vector("PreviousParameters");
+
+        optimal_columns_indices = checkpoint.get_indices("OptimalColumnsIndices");
+        optimal_parameters = checkpoint.get_vector("OptimalParameters");
+        optimum_training_error = checkpoint.get_double("OptimumTrainingError");
+        optimum_selection_error = checkpoint.get_double("OptimumSelectionError");
+
+        previus_selection_error = checkpoint.get_double("PreviousSelectionError");
+        selection_failures = checkpoint.get_size_t("SelectionFailures");
+
+        beginning_time -= static_cast<time_t>(checkpoint.get_double("ElapsedTime"));
+
+        // The replica is left as it was after training the last candidate
+
+        replica.set_inputs_mask(current_inputs);
+
+        replica.neural_network.set_parameters(previous_parameters);
+    }
+
     // Model selection
 
     if(used_columns_number < maximum_epochs_number) maximum_epochs_number = used_columns_number;
 
-    for(size_t epoch = 0; epoch < maximum_epochs_number; epoch++)
+    for(size_t epoch = first_epoch; epoch < maximum_epochs_number && !end_algorithm; epoch++)
     {
         OptimizationAlgorithm::Results training_results;
 
@@ -258,11 +333,10 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
         Vector<double> current_parameters;
 
         size_t column_index;
-        string column_name;
 
         if(epoch == 0)
         {
-            training_results = training_strategy_pointer->perform_training();
+            training_results = replica.training_strategy.perform_training();
 
             current_training_error = training_results.final_training_error;
             current_selection_error = training_results.final_selection_error;
@@ -272,29 +346,41 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
         {
             column_index = correlations_ascending_indices[epoch];
 
-            column_name = used_columns_names[column_index];
-
-            data_set_pointer->set_column_use(column_name, DataSet::UnusedVariable);
+            current_inputs[column_index] = false;
 
             current_columns_indices = current_columns_indices.delete_value(column_index);
 
 //            current_columns_indices.push_back(column_index);
 
-            const size_t input_variables_number = data_set_pointer->get_input_variables_number();
+            const Vector<size_t> previous_inputs_indices = replica.data_set.get_input_variables_indices();
+
+            replica.data_set.set_inputs_mask(current_inputs);
+
+            if(warm_start)
+            {
+                // Start from the previous candidate, dropping the weights of the removed input
+
+                replica.neural_network.set_parameters(previous_parameters);
 
-            data_set_pointer->set_input_variables_dimensions({input_variables_number});
+                replica.neural_network.warm_start_inputs(previous_inputs_indices, replica.data_set.get_input_variables_indices());
 
-            neural_network_pointer->set_inputs_number(input_variables_number);
+                replica.training_strategy.set_maximum_epochs_number(warm_start_epochs_number);
+            }
+            else
+            {
+                replica.neural_network.set_inputs_number(replica.data_set.get_input_variables_number());
+            }
 
             // Trial
 
-            training_results = training_strategy_pointer->perform_training();
+            training_results = replica.training_strategy.perform_training();
 
             current_training_error = training_results.final_training_error;
             current_selection_error = training_results.final_selection_error;
             current_parameters = training_results.final_parameters;
         }
 
+        previous_parameters = current_parameters;
 
         if(display)
         {
@@ -379,7 +465,7 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
 
             if(end_algorithm == false && epoch != 0) cout << "Pruning input: " << data_set_pointer->get_variable_name(column_index) << endl;
 
-            cout << "Current inputs: " <<  data_set_pointer->get_input_variables_names().vector_to_string() << endl;
+            cout << "Current inputs: " <<  replica.data_set.get_input_variables_names().vector_to_string() << endl;
             cout << "Number of inputs: " << current_columns_indices.size() << endl;
             cout << "Training loss: " << current_training_error << endl;
             cout << "Selection error: " << current_selection_error << endl;
@@ -389,8 +475,31 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
         }
 
         if(end_algorithm == true) break;
+
+        if(is_checkpoint_iteration(epoch))
+        {
+            checkpoint.set_size_t("Epoch", epoch+1);
+
+            checkpoint.set_bool_vector("CurrentInputs", current_inputs);
+            checkpoint.set_indices("CurrentColumnsIndices", current_columns_indices);
+            checkpoint.set_vector("PreviousParameters", previous_parameters);
+
+            checkpoint.set_indices("OptimalColumnsIndices", optimal_columns_indices);
+            checkpoint.set_vector("OptimalParameters", optimal_parameters);
+            checkpoint.set_double("OptimumTrainingError", optimum_training_error);
+            checkpoint.set_double("OptimumSelectionError", optimum_selection_error);
+
+            checkpoint.set_double("PreviousSelectionError", previus_selection_error);
+            checkpoint.set_size_t("SelectionFailures", selection_failures);
+
+            checkpoint.set_double("ElapsedTime", elapsed_time);
+
+            save_checkpoint(checkpoint);
+        }
     }
 
+    remove_checkpoint();
+
     // Save results
 
     results->optimal_inputs_indices = optimal_columns_indices;
@@ -402,18 +511,18 @@ PruningInputs::PruningInputsResults* PruningInputs::perform_inputs_selection()
 
     // Set Data set stuff
 
-    data_set_pointer->set_input_columns_unused();
-
     const size_t optimal_inputs_number = optimal_columns_indices.size();
 
-    for(size_t i = 0; i< optimal_inputs_number; i++)
-    {
-        size_t optimal_input_index = optimal_columns_indices[i];
+    Vector<bool> optimal_inputs(inputs_number, false);
 
-        data_set_pointer->set_column_use(optimal_input_index,DataSet::Input);
+    for(size_t i = 0; i < optimal_inputs_number; i++)
+    {
+        optimal_inputs[optimal_columns_indices[i]] = true;
     }
 
-    data_set_pointer->set_input_variables_dimensions({optimal_inputs_number});
+    replica.data_set.set_inputs_mask(optimal_inputs);
+
+    data_set_pointer->set_columns_uses(replica.data_set.get_columns_uses());
 
     // Set Neural network stuff
 
@@ -976,6 +1085,135 @@ tinyxml2::XMLDocument* PruningInputs::to_XML() const
    element->LinkEndChild(text);
    }
 
+   // Warm start
+   {
+   element = document->NewElement("WarmStart");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << warm_start;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Warm start epochs number
+   {
+   element = document->NewElement("WarmStartEpochsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << warm_start_epochs_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Successive halving
+   {
+   element = document->NewElement("SuccessiveHalving");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << successive_halving;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Successive halving epochs number
+   {
+   element = document->NewElement("SuccessiveHalvingEpochsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << successive_halving_epochs_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Trials workers number
+   {
+   element = document->NewElement("TrialsWorkersNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << trials_workers_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Checkpoint file name
+   {
+   element = document->NewElement("CheckpointFileName");
+   root_element->LinkEndChild(element);
+
+   text = document->NewText(checkpoint_file_name.c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Checkpoint period
+   {
+   element = document->NewElement("CheckpointPeriod");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << checkpoint_period;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Resume from checkpoint
+   {
+   element = document->NewElement("ResumeFromCheckpoint");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << resume_from_checkpoint;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Pre-screening
+   {
+   element = document->NewElement("PreScreening");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << pre_screening;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Pre-screening inputs number
+   {
+   element = document->NewElement("PreScreeningInputsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << pre_screening_inputs_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Pre-screening maximum redundancy
+   {
+   element = document->NewElement("PreScreeningMaximumRedundancy");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << pre_screening_maximum_redundancy;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
    // Tolerance
    {
    element = document->NewElement("Tolerance");
@@ -1170,6 +1408,124 @@ void PruningInputs::write_XML(tinyxml2::XMLPrinter& file_stream) const
 
     file_stream.CloseElement();
 
+    // Warm start
+
+    file_stream.OpenElement("WarmStart");
+
+    buffer.str("");
+    buffer << warm_start;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Warm start epochs number
+
+    file_stream.OpenElement("WarmStartEpochsNumber");
+
+    buffer.str("");
+    buffer << warm_start_epochs_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Successive halving
+
+    file_stream.OpenElement("SuccessiveHalving");
+
+    buffer.str("");
+    buffer << successive_halving;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Successive halving epochs number
+
+    file_stream.OpenElement("SuccessiveHalvingEpochsNumber");
+
+    buffer.str("");
+    buffer << successive_halving_epochs_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Trials workers number
+
+    file_stream.OpenElement("TrialsWorkersNumber");
+
+    buffer.str("");
+    buffer << trials_workers_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Checkpoint file name
+
+    file_stream.OpenElement("CheckpointFileName");
+
+    file_stream.PushText(checkpoint_file_name.c_str());
+
+    file_stream.CloseElement();
+
+    // Checkpoint period
+
+    file_stream.OpenElement("CheckpointPeriod");
+
+    buffer.str("");
+    buffer << checkpoint_period;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Resume from checkpoint
+
+    file_stream.OpenElement("ResumeFromCheckpoint");
+
+    buffer.str("");
+    buffer << resume_from_checkpoint;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Pre-screening
+
+    file_stream.OpenElement("PreScreening");
+
+    buffer.str("");
+    buffer << pre_screening;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Pre-screening inputs number
+
+    file_stream.OpenElement("PreScreeningInputsNumber");
+
+    buffer.str("");
+    buffer << pre_screening_inputs_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Pre-screening maximum redundancy
+
+    file_stream.OpenElement("PreScreeningMaximumRedundancy");
+
+    buffer.str("");
+    buffer << pre_screening_maximum_redundancy;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Tolerance
 
     file_stream.OpenElement("Tolerance");
@@ -1354,6 +1710,215 @@ void PruningInputs::from_XML(const tinyxml2::XMLDocument& document)
         }
     }
 
+    // Warm start
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarmStart");
+
+        if(element)
+        {
+           const string new_warm_start = element->GetText();
+
+           try
+           {
+              set_warm_start(new_warm_start != "0");
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Warm start epochs number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarmStartEpochsNumber");
+
+        if(element)
+        {
+           const size_t new_warm_start_epochs_number = static_cast<size_t>(atoi(element->GetText()));
+
+           try
+           {
+              set_warm_start_epochs_number(new_warm_start_epochs_number);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Successive halving
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("SuccessiveHalving");
+
+        if(element)
+        {
+           const string new_successive_halving = element->GetText();
+
+           try
+           {
+              set_successive_halving(new_successive_halving != "0");
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Successive halving epochs number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("SuccessiveHalvingEpochsNumber");
+
+        if(element)
+        {
+           const size_t new_successive_halving_epochs_number = static_cast<size_t>(atoi(element->GetText()));
+
+           try
+           {
+              set_successive_halving_epochs_number(new_successive_halving_epochs_number);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Trials workers number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("TrialsWorkersNumber");
+
+        if(element)
+        {
+           const size_t new_trials_workers_number = static_cast<size_t>(atoi(element->GetText()));
+
+           try
+           {
+              set_trials_workers_number(new_trials_workers_number);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Checkpoint file name
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("CheckpointFileName");
+
+        if(element)
+        {
+            const string new_checkpoint_file_name = element->GetText() ? element->GetText() : "";
+
+            try
+            {
+                set_checkpoint_file_name(new_checkpoint_file_name);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Checkpoint period
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("CheckpointPeriod");
+
+        if(element)
+        {
+            const size_t new_checkpoint_period = static_cast<size_t>(atoi(element->GetText()));
+
+            try
+            {
+                set_checkpoint_period(new_checkpoint_period);
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Resume from checkpoint
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("ResumeFromCheckpoint");
+
+        if(element)
+        {
+            const string new_resume_from_checkpoint = element->GetText();
+
+            try
+            {
+                set_resume_from_checkpoint(new_resume_from_checkpoint != "0");
+            }
+            catch(const logic_error& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
+    // Pre-screening
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("PreScreening");
+
+        if(element)
+        {
+           const string new_pre_screening = element->GetText();
+
+           try
+           {
+              set_pre_screening(new_pre_screening != "0");
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Pre-screening inputs number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("PreScreeningInputsNumber");
+
+        if(element)
+        {
+           const size_t new_pre_screening_inputs_number = static_cast<size_t>(atoi(element->GetText()));
+
+           try
+           {
+              set_pre_screening_inputs_number(new_pre_screening_inputs_number);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
+    // Pre-screening maximum redundancy
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("PreScreeningMaximumRedundancy");
+
+        if(element)
+        {
+           const double new_pre_screening_maximum_redundancy = atof(element->GetText());
+
+           try
+           {
+              set_pre_screening_maximum_redundancy(new_pre_screening_maximum_redundancy);
+           }
+           catch(const logic_error& e)
+           {
+              cerr << e.what() << endl;
+           }
+        }
+    }
+
     // Reserve loss data
     {
         const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReserveTrainingErrorHistory");
@@ -94,6 +94,11 @@ string QuasiNewtonMethod::write_inverse_hessian_approximation_method() const
       {
          return "BFGS";
 	  }
+
+      case LBFGS:
+      {
+         return "LBFGS";
+      }
    }
 
    ostringstream buffer;
@@ -106,6 +111,14 @@ string QuasiNewtonMethod::write_inverse_hessian_approximation_method() const
 }
 
 
+/// Returns the number of parameters and gradient differences used by the limited-memory BFGS method.
+
+const size_t& QuasiNewtonMethod::get_limited_memory_size() const
+{
+   return limited_memory_size;
+}
+
+
 /// Returns the minimum value for the norm of the parameters vector at wich a warning message is written to the screen. 
 
 const double& QuasiNewtonMethod::get_warning_parameters_norm() const
@@ -292,6 +305,7 @@ new_inverse_hessian_approximation_method)
 /// <ul>
 /// <li> "DFP"
 /// <li> "BFGS"
+/// <li> "LBFGS"
 /// </ul>
 /// @param new_inverse_hessian_approximation_method_name Name of inverse hessian approximation method.  
 
@@ -305,6 +319,10 @@ void QuasiNewtonMethod::set_inverse_hessian_approximation_method(const string& n
    {
       inverse_hessian_approximation_method = BFGS;
    }
+   else if(new_inverse_hessian_approximation_method_name == "LBFGS")
+   {
+      inverse_hessian_approximation_method = LBFGS;
+   }
    else
    {
       ostringstream buffer;
@@ -318,6 +336,31 @@ void QuasiNewtonMethod::set_inverse_hessian_approximation_method(const string& n
 }
 
 
+/// Sets the number of parameters and gradient differences used by the limited-memory BFGS method.
+/// The memory and time per epoch of that method grow linearly with this number.
+/// @param new_limited_memory_size Number of previous epochs remembered.
+
+void QuasiNewtonMethod::set_limited_memory_size(const size_t& new_limited_memory_size)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_limited_memory_size == 0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "void set_limited_memory_size(const size_t&) method.\n"
+             << "Limited memory size must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   limited_memory_size = new_limited_memory_size;
+}
+
+
 /// Makes the training history of all variables to reseved or not in memory.
 /// @param new_reserve_all_training_history True if the training history of all variables is to be reserved, 
 /// false otherwise.
@@ -345,6 +388,8 @@ void QuasiNewtonMethod::set_default()
 {
    inverse_hessian_approximation_method = BFGS;
 
+   limited_memory_size = 10;
+
    learning_rate_algorithm.set_default();
 
    // TRAINING PARAMETERS
@@ -803,6 +848,17 @@ const Matrix<double>& old_inverse_hessian) const
       {
          return(calculate_BFGS_inverse_hessian(old_parameters, parameters, old_gradient, gradient, old_inverse_hessian));
       }
+
+      case LBFGS:
+      {
+         ostringstream buffer;
+
+         buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+                << "Vector<double> calculate_inverse_hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method.\n"
+                << "Limited-memory BFGS method does not build the inverse hessian.\n";
+
+         throw logic_error(buffer.str());
+      }
    }
 
    ostringstream buffer;
@@ -825,6 +881,78 @@ Vector<double> QuasiNewtonMethod::calculate_training_direction(const Vector<doub
 }
 
 
+/// Returns the limited-memory BFGS training direction, which has been previously normalized.
+/// The product of the inverse hessian approximation and the gradient is computed with the two-loop recursion,
+/// which only needs the last parameters and gradient differences, in O(mP) time and memory.
+/// @param gradient Gradient vector.
+/// @param parameters_differences Last parameters differences, from the oldest to the newest.
+/// @param gradient_differences Last gradient differences, from the oldest to the newest.
+
+Vector<double> QuasiNewtonMethod::calculate_limited_memory_training_direction(const Vector<double>& gradient,
+                                                                             const Vector<Vector<double>>& parameters_differences,
+                                                                             const Vector<Vector<double>>& gradient_differences) const
+{
+   const size_t history_size = parameters_differences.size();
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(gradient_differences.size() != history_size)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "Vector<double> calculate_limited_memory_training_direction(const Vector<double>&, const Vector<Vector<double>>&, const Vector<Vector<double>>&) const method.\n"
+             << "Number of parameters differences (" << history_size << ") must be equal to number of gradient differences (" << gradient_differences.size() << ").\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t parameters_number = gradient.size();
+
+   Vector<double> direction(gradient);
+
+   Vector<double> alphas(history_size);
+   Vector<double> rhos(history_size);
+
+   for(size_t k = history_size; k > 0; k--)
+   {
+      const size_t i = k - 1;
+
+      rhos[i] = 1.0/dot(gradient_differences[i], parameters_differences[i]);
+
+      alphas[i] = rhos[i]*dot(parameters_differences[i], direction);
+
+      for(size_t j = 0; j < parameters_number; j++)
+      {
+         direction[j] -= alphas[i]*gradient_differences[i][j];
+      }
+   }
+
+   // Initial inverse hessian approximation
+
+   if(history_size != 0)
+   {
+      const Vector<double>& last_gradient_difference = gradient_differences[history_size-1];
+
+      direction *= dot(parameters_differences[history_size-1], last_gradient_difference)/dot(last_gradient_difference, last_gradient_difference);
+   }
+
+   for(size_t i = 0; i < history_size; i++)
+   {
+      const double beta = rhos[i]*dot(gradient_differences[i], direction);
+
+      for(size_t j = 0; j < parameters_number; j++)
+      {
+         direction[j] += (alphas[i] - beta)*parameters_differences[i][j];
+      }
+   }
+
+   return normalized(direction)*(-1.0);
+}
+
+
 /// Returns the gradient descent training direction, which is the negative of the normalized gradient. 
 /// @param gradient Gradient vector.
 
@@ -990,33 +1118,9 @@ const Vector<double>& old_parameters, const Vector<double>& parameters, const Ve
       throw logic_error(buffer.str());	  
    }
 
-   const double parameters_dot_gradient = dot(parameters_difference, gradient_difference);
-
-   if(abs(parameters_dot_gradient) < 1.0e-50)
-   {
-      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
-             << "Matrix<double> calculate_DFP_inverse_hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method.\n"
-             << "Denominator of first term is zero.\n";
-
-      throw logic_error(buffer.str());	  
-   }
-   else if(abs(dot(dot(gradient_difference, old_inverse_hessian), gradient_difference)) < 1.0e-50)
-   {
-      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
-             << "Matrix<double> calculate_DFP_inverse_hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method.\n"
-             << "Denominator of second term is zero.\n";
-
-      throw logic_error(buffer.str());	  
-   }
-
    Matrix<double> inverse_hessian_approximation = old_inverse_hessian;
 
-   const Vector<double> hessian_dot_gradient_difference = dot(old_inverse_hessian, gradient_difference);
-
-   inverse_hessian_approximation += direct(parameters_difference, parameters_difference)/parameters_dot_gradient;
-
-   inverse_hessian_approximation -= direct(hessian_dot_gradient_difference, hessian_dot_gradient_difference)
-            /dot(gradient_difference, hessian_dot_gradient_difference);
+   update_DFP_inverse_hessian(parameters_difference, gradient_difference, inverse_hessian_approximation);
 
    return(inverse_hessian_approximation);
 }
@@ -1153,27 +1257,122 @@ const Vector<double>& old_gradient, const Vector<double>& gradient, const Matrix
 //	  throw logic_error(buffer.str());
 //   }
 
-   // BGFS Vector
+   // Calculate inverse hessian approximation
 
+   Matrix<double> inverse_hessian_approximation = old_inverse_hessian;
+
+   update_BFGS_inverse_hessian(parameters_difference, gradient_difference, inverse_hessian_approximation);
+
+   return inverse_hessian_approximation;
+}
+
+
+/// Updates in place an approximation of the inverse hessian matrix according to the Davidon-Fletcher-Powel
+///(DFP) algorithm, which is the symmetric rank-two correction H + s*s'/(s'y) - (Hy)*(Hy)'/(y'Hy).
+/// @param parameters_difference Difference between the actual and the previous parameters.
+/// @param gradient_difference Difference between the actual and the previous gradients.
+/// @param inverse_hessian Inverse hessian approximation at the previous parameters, which is overwritten with the new one.
+
+void QuasiNewtonMethod::update_DFP_inverse_hessian(const Vector<double>& parameters_difference,
+                                                   const Vector<double>& gradient_difference,
+                                                   Matrix<double>& inverse_hessian) const
+{
+   const double parameters_dot_gradient = dot(parameters_difference, gradient_difference);
+
+   const Vector<double> hessian_dot_gradient_difference = dot(inverse_hessian, gradient_difference);
+
+   const double gradient_dot_hessian_dot_gradient = dot(gradient_difference, hessian_dot_gradient_difference);
+
+   if(abs(parameters_dot_gradient) < 1.0e-50)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "void update_DFP_inverse_hessian(const Vector<double>&, const Vector<double>&, Matrix<double>&) const method.\n"
+             << "Denominator of first term is zero.\n";
+
+      throw logic_error(buffer.str());
+   }
+   else if(abs(gradient_dot_hessian_dot_gradient) < 1.0e-50)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "void update_DFP_inverse_hessian(const Vector<double>&, const Vector<double>&, Matrix<double>&) const method.\n"
+             << "Denominator of second term is zero.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   symmetric_rank_two_update(inverse_hessian,
+                             1.0/parameters_dot_gradient, parameters_difference,
+                             -1.0/gradient_dot_hessian_dot_gradient, hessian_dot_gradient_difference,
+                             0.0);
+}
+
+
+/// Updates in place an approximation of the inverse hessian matrix according to the
+/// Broyden-Fletcher-Goldfarb-Shanno(BGFS) algorithm.
+/// The update is written as the symmetric rank-two correction H + (1 + y'Hy/s'y)*s*s'/(s'y) - (s*(Hy)' + (Hy)*s')/(s'y),
+/// which is applied with a single pass over the matrix.
+/// @param parameters_difference Difference between the actual and the previous parameters.
+/// @param gradient_difference Difference between the actual and the previous gradients.
+/// @param inverse_hessian Inverse hessian approximation at the previous parameters, which is overwritten with the new one.
+
+void QuasiNewtonMethod::update_BFGS_inverse_hessian(const Vector<double>& parameters_difference,
+                                                    const Vector<double>& gradient_difference,
+                                                    Matrix<double>& inverse_hessian) const
+{
    const double parameters_dot_gradient = dot(parameters_difference, gradient_difference);
-   const Vector<double> hessian_dot_gradient = dot(old_inverse_hessian, gradient_difference);
+   const Vector<double> hessian_dot_gradient = dot(inverse_hessian, gradient_difference);
    const double gradient_dot_hessian_dot_gradient = dot(gradient_difference, hessian_dot_gradient);
 
-   const Vector<double> BFGS = parameters_difference/parameters_dot_gradient
-   - hessian_dot_gradient/gradient_dot_hessian_dot_gradient;
+   symmetric_rank_two_update(inverse_hessian,
+                             (1.0 + gradient_dot_hessian_dot_gradient/parameters_dot_gradient)/parameters_dot_gradient, parameters_difference,
+                             0.0, hessian_dot_gradient,
+                             -1.0/parameters_dot_gradient);
+}
 
-   // Calculate inverse hessian approximation
 
-   Matrix<double> inverse_hessian_approximation = old_inverse_hessian;
+/// Updates in place the approximation of the inverse hessian, according to the method used.
+/// @param old_parameters Another point of the error function.
+/// @param parameters Current point of the error function
+/// @param old_gradient Gradient at the other point.
+/// @param gradient Gradient at the current point.
+/// @param inverse_hessian Inverse hessian at the other point of the error function, which is overwritten with the new one.
 
-   inverse_hessian_approximation += direct(parameters_difference, parameters_difference)/parameters_dot_gradient;
+void QuasiNewtonMethod::update_inverse_hessian_approximation(const Vector<double>& old_parameters, const Vector<double>& parameters,
+                                                             const Vector<double>& old_gradient, const Vector<double>& gradient,
+                                                             Matrix<double>& inverse_hessian) const
+{
+   const Vector<double> parameters_difference = parameters - old_parameters;
+   const Vector<double> gradient_difference = gradient - old_gradient;
 
-   inverse_hessian_approximation -= direct(hessian_dot_gradient, hessian_dot_gradient)
-   /gradient_dot_hessian_dot_gradient;
+   switch(inverse_hessian_approximation_method)
+   {
+      case DFP:
+      {
+         update_DFP_inverse_hessian(parameters_difference, gradient_difference, inverse_hessian);
+      }
+      return;
 
-   inverse_hessian_approximation += direct(BFGS, BFGS)*(gradient_dot_hessian_dot_gradient);
+      case BFGS:
+      {
+         update_BFGS_inverse_hessian(parameters_difference, gradient_difference, inverse_hessian);
+      }
+      return;
 
-   return inverse_hessian_approximation;
+      case LBFGS:
+      break;
+   }
+
+   ostringstream buffer;
+
+   buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+          << "void update_inverse_hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&) const method.\n"
+          << "Inverse hessian approximation method does not build the inverse hessian.\n";
+
+   throw logic_error(buffer.str());
 }
 
 
@@ -1233,8 +1432,14 @@ OptimizationAlgorithm::Results QuasiNewtonMethod::perform_training()
    Vector<double> old_gradient(parameters_number);
    double gradient_norm;
 
-   Matrix<double> inverse_hessian(parameters_number, parameters_number);
-   Matrix<double> old_inverse_hessian;
+   const bool limited_memory = inverse_hessian_approximation_method == LBFGS;
+
+   Matrix<double> inverse_hessian;
+
+   if(!limited_memory) inverse_hessian.set(parameters_number, parameters_number);
+
+   Vector<Vector<double>> parameters_differences;
+   Vector<Vector<double>> gradient_differences;
 
    double selection_error = 0.0;
    double old_selection_error = 0.0;
@@ -1333,21 +1538,45 @@ OptimizationAlgorithm::Results QuasiNewtonMethod::perform_training()
        || absolute_value(old_parameters - parameters) < numeric_limits<double>::min()
        || absolute_value(old_gradient - gradient) < numeric_limits<double>::min())
        {
-           inverse_hessian.initialize_identity();
+           if(limited_memory)
+           {
+               parameters_differences.clear();
+               gradient_differences.clear();
+           }
+           else
+           {
+               inverse_hessian.initialize_identity();
+           }
        }
        else
        {
            switch(inverse_hessian_approximation_method)
            {
               case DFP:
+              case BFGS:
               {
-                inverse_hessian = calculate_DFP_inverse_hessian(old_parameters, parameters, old_gradient, gradient, old_inverse_hessian);
+                update_inverse_hessian_approximation(old_parameters, parameters, old_gradient, gradient, inverse_hessian);
               }
               break;
 
-              case BFGS:
+              case LBFGS:
               {
-                inverse_hessian = calculate_BFGS_inverse_hessian(old_parameters, parameters, old_gradient, gradient, old_inverse_hessian);
+                Vector<double> parameters_difference = parameters - old_parameters;
+                Vector<double> gradient_difference = gradient - old_gradient;
+
+                // Keep only pairs with positive curvature, so that the approximation stays positive definite
+
+                if(dot(parameters_difference, gradient_difference) > numeric_limits<double>::min())
+                {
+                    if(parameters_differences.size() == limited_memory_size)
+                    {
+                        parameters_differences.erase(parameters_differences.begin());
+                        gradient_differences.erase(gradient_differences.begin());
+                    }
+
+                    parameters_differences.push_back(move(parameters_difference));
+                    gradient_differences.push_back(move(gradient_difference));
+                }
               }
               break;
            }
@@ -1358,7 +1587,9 @@ OptimizationAlgorithm::Results QuasiNewtonMethod::perform_training()
 
        // Optimization algorithm
 
-       training_direction = calculate_training_direction(gradient, inverse_hessian);
+       training_direction = limited_memory
+               ? calculate_limited_memory_training_direction(gradient, parameters_differences, gradient_differences)
+               : calculate_training_direction(gradient, inverse_hessian);
 
        // Calculate loss training slope
 
@@ -1379,7 +1610,7 @@ OptimizationAlgorithm::Results QuasiNewtonMethod::perform_training()
 
        epoch == 0 ? initial_learning_rate = first_learning_rate : initial_learning_rate = old_learning_rate;
 
-       directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, training_direction, initial_learning_rate);
+       directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, dot(gradient, training_direction), training_direction, initial_learning_rate);
 
        learning_rate = directional_point.first;
 
@@ -1390,7 +1621,7 @@ OptimizationAlgorithm::Results QuasiNewtonMethod::perform_training()
        {
            training_direction = calculate_gradient_descent_training_direction(gradient);
 
-           directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, training_direction, first_learning_rate);
+           directional_point = learning_rate_algorithm.calculate_directional_point(training_loss, dot(gradient, training_direction), training_direction, first_learning_rate);
 
            learning_rate = directional_point.first;
        }
@@ -1557,8 +1788,6 @@ OptimizationAlgorithm::Results QuasiNewtonMethod::perform_training()
 
        old_gradient = gradient;
 
-       old_inverse_hessian = inverse_hessian;
-
        old_learning_rate = learning_rate;
 
        // Set new parameters
@@ -1625,6 +1854,18 @@ tinyxml2::XMLDocument* QuasiNewtonMethod::to_XML() const
        element->LinkEndChild(text);
    }
 
+   // Limited memory size
+   {
+       element = document->NewElement("LimitedMemorySize");
+       root_element->LinkEndChild(element);
+
+       buffer.str("");
+       buffer << limited_memory_size;
+
+       text = document->NewText(buffer.str().c_str());
+       element->LinkEndChild(text);
+   }
+
 
    // Training rate algorithm
    {
@@ -1933,6 +2174,17 @@ void QuasiNewtonMethod::write_XML(tinyxml2::XMLPrinter& file_stream) const
 
     file_stream.CloseElement();
 
+    // Limited memory size
+
+    file_stream.OpenElement("LimitedMemorySize");
+
+    buffer.str("");
+    buffer << limited_memory_size;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Training rate algorithm
 
     learning_rate_algorithm.write_XML(file_stream);
@@ -2091,6 +2343,18 @@ Matrix<string> QuasiNewtonMethod::to_string_matrix() const
 
     values.push_back(inverse_hessian_approximation_method_string);
 
+    // Limited memory size
+
+    if(inverse_hessian_approximation_method == LBFGS)
+    {
+        labels.push_back("Limited memory size");
+
+        buffer.str("");
+        buffer << limited_memory_size;
+
+        values.push_back(buffer.str());
+    }
+
    // Training rate method
 
    labels.push_back("Training rate method");
@@ -2251,17 +2515,17 @@ void QuasiNewtonMethod::from_XML(const tinyxml2::XMLDocument& document)
        }
    }
 
-   // Inverse hessian approximation method
+   // Limited memory size
    {
-       const tinyxml2::XMLElement* element = root_element->FirstChildElement("InverseHessianApproximationMethod");
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("LimitedMemorySize");
 
        if(element)
        {
-          const string new_inverse_hessian_approximation_method = element->GetText();
+          const size_t new_limited_memory_size = static_cast<size_t>(atoi(element->GetText()));
 
           try
           {
-             set_inverse_hessian_approximation_method(new_inverse_hessian_approximation_method);
+             set_limited_memory_size(new_limited_memory_size);
           }
           catch(const logic_error& e)
           {
@@ -53,7 +53,7 @@ public:
 
    /// Enumeration of the available training operators for obtaining the approximation to the inverse hessian.
 
-   enum InverseHessianApproximationMethod{DFP, BFGS};
+   enum InverseHessianApproximationMethod{DFP, BFGS, LBFGS};
 
 
    // DEFAULT CONSTRUCTOR
@@ -78,6 +78,8 @@ public:
    const InverseHessianApproximationMethod& get_inverse_hessian_approximation_method() const;
    string write_inverse_hessian_approximation_method() const;
 
+   const size_t& get_limited_memory_size() const;
+
    // Training parameters
 
    const double& get_warning_parameters_norm() const;
@@ -118,6 +120,8 @@ public:
    void set_inverse_hessian_approximation_method(const InverseHessianApproximationMethod&);
    void set_inverse_hessian_approximation_method(const string&);
 
+   void set_limited_memory_size(const size_t&);
+
    void set_display(const bool&);
 
    void set_default();
@@ -167,10 +171,16 @@ public:
   (const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) const;
 
    Matrix<double> calculate_inverse_hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) const;
-   void update_inverse_hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&) const;
+   void update_DFP_inverse_hessian(const Vector<double>&, const Vector<double>&, Matrix<double>&) const;
+
+   void update_BFGS_inverse_hessian(const Vector<double>&, const Vector<double>&, Matrix<double>&) const;
+
+   void update_inverse_hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&) const;
 
    Vector<double> calculate_training_direction(const Vector<double>&, const Matrix<double>&) const;
 
+   Vector<double> calculate_limited_memory_training_direction(const Vector<double>&, const Vector<Vector<double>>&, const Vector<Vector<double>>&) const;
+
    Results perform_training();
    void perform_training_void();
 
@@ -201,6 +211,10 @@ private:
 
    InverseHessianApproximationMethod inverse_hessian_approximation_method;
 
+   /// Number of parameters and gradient differences kept by the limited-memory BFGS method.
+
+   size_t limited_memory_size;
+
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
    double warning_parameters_norm;
@@ -0,0 +1,369 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   R A N D O M   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "random.h"
+
+#include <cmath>
+#include <atomic>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace OpenNN
+{
+
+const uint64_t RandomGenerator::default_seed;
+
+
+/// Seed constructor.
+/// It creates a generator with the given seed and stream, at the beginning of its sequence.
+/// @param new_seed Seed of the generator.
+/// @param new_stream Stream of the generator.
+
+RandomGenerator::RandomGenerator(const uint64_t& new_seed, const uint64_t& new_stream)
+{
+    set(new_seed, new_stream);
+}
+
+
+/// Destructor.
+
+RandomGenerator::~RandomGenerator()
+{
+}
+
+
+/// Returns the seed of the generator.
+
+const uint64_t& RandomGenerator::get_seed() const
+{
+    return seed;
+}
+
+
+/// Returns the stream of the generator.
+
+const uint64_t& RandomGenerator::get_stream() const
+{
+    return stream;
+}
+
+
+/// Returns the number of numbers drawn from the generator since it was seeded.
+
+const uint64_t& RandomGenerator::get_counter() const
+{
+    return counter;
+}
+
+
+/// Sets a new seed and stream, and moves the generator to the beginning of its sequence.
+/// @param new_seed Seed of the generator.
+/// @param new_stream Stream of the generator.
+
+void RandomGenerator::set(const uint64_t& new_seed, const uint64_t& new_stream)
+{
+    seed = new_seed;
+    stream = new_stream;
+
+    set_counter(0);
+}
+
+
+/// Moves the generator to a position of its sequence.
+/// Together with the seed and the stream, it restores the state of a generator exactly.
+/// @param new_counter Number of numbers drawn from the generator.
+
+void RandomGenerator::set_counter(const uint64_t& new_counter)
+{
+    counter = new_counter;
+
+    calculate_block(counter/2);
+}
+
+
+/// Returns the next number of the sequence, uniformly distributed between 0 and the maximum of a 64 bits number.
+
+RandomGenerator::result_type RandomGenerator::operator()()
+{
+    if(counter/2 != block_index) calculate_block(counter/2);
+
+    const uint64_t random = block[counter%2];
+
+    counter++;
+
+    return random;
+}
+
+
+/// Returns a number chosen from a uniform distribution between 0 and 1, excluding 1.
+
+double RandomGenerator::calculate_uniform()
+{
+    // The 53 upper bits fill the mantissa of a double
+
+    return static_cast<double>((*this)() >> 11)*(1.0/9007199254740992.0);
+}
+
+
+/// Returns a number chosen from a uniform distribution.
+/// @param minimum Minimum value.
+/// @param maximum Maximum value.
+
+double RandomGenerator::calculate_uniform(const double& minimum, const double& maximum)
+{
+    return minimum + (maximum - minimum)*calculate_uniform();
+}
+
+
+/// Returns a number chosen from a normal distribution, with the Box-Muller transformation.
+/// @param mean Mean value of normal distribution.
+/// @param standard_deviation Standard deviation value of normal distribution.
+
+double RandomGenerator::calculate_normal(const double& mean, const double& standard_deviation)
+{
+    const double pi = 4.0 * atan(1.0);
+
+    double random_uniform_1;
+
+    do
+    {
+        random_uniform_1 = calculate_uniform();
+    }
+    while(random_uniform_1 == 0.0);
+
+    const double random_uniform_2 = calculate_uniform();
+
+    return mean + sqrt(-2.0 * log(random_uniform_1)) * sin(2.0 * pi * random_uniform_2) * standard_deviation;
+}
+
+
+/// Returns an index chosen from a uniform distribution between 0 and a given size, excluding the size.
+/// @param size Number of indices.
+
+size_t RandomGenerator::calculate_index(const size_t& size)
+{
+    if(size == 0) return 0;
+
+    return static_cast<size_t>((*this)()%size);
+}
+
+
+/// Returns a new generator, whose seed is drawn from this generator.
+/// Generators split in the same order from generators in the same state are the same,
+/// so a set of tasks can be given their generators before they are run concurrently.
+/// @param new_stream Stream of the new generator, usually the index of the task.
+
+RandomGenerator RandomGenerator::split(const uint64_t& new_stream)
+{
+    return RandomGenerator((*this)(), new_stream);
+}
+
+
+/// Calculates a block of the sequence, which contains two 64 bits numbers.
+/// The counter of the block is made of its index and of the stream of the generator,
+/// and it is encrypted by ten rounds of the Philox 4x32 function with the seed as the key.
+/// @param new_block_index Index of the block.
+
+void RandomGenerator::calculate_block(const uint64_t& new_block_index)
+{
+    const uint32_t multiplier_0 = 0xD2511F53;
+    const uint32_t multiplier_1 = 0xCD9E8D57;
+
+    const uint32_t weyl_0 = 0x9E3779B9;
+    const uint32_t weyl_1 = 0xBB67AE85;
+
+    uint32_t words[4] = {static_cast<uint32_t>(new_block_index),
+                         static_cast<uint32_t>(new_block_index >> 32),
+                         static_cast<uint32_t>(stream),
+                         static_cast<uint32_t>(stream >> 32)};
+
+    uint32_t key[2] = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+
+    for(size_t i = 0; i < 10; i++)
+    {
+        const uint64_t product_0 = static_cast<uint64_t>(multiplier_0)*words[0];
+        const uint64_t product_1 = static_cast<uint64_t>(multiplier_1)*words[2];
+
+        const uint32_t new_words[4] = {static_cast<uint32_t>(product_1 >> 32) ^ words[1] ^ key[0],
+                                       static_cast<uint32_t>(product_1),
+                                       static_cast<uint32_t>(product_0 >> 32) ^ words[3] ^ key[1],
+                                       static_cast<uint32_t>(product_0)};
+
+        words[0] = new_words[0];
+        words[1] = new_words[1];
+        words[2] = new_words[2];
+        words[3] = new_words[3];
+
+        key[0] += weyl_0;
+        key[1] += weyl_1;
+    }
+
+    block[0] = (static_cast<uint64_t>(words[1]) << 32) | words[0];
+    block[1] = (static_cast<uint64_t>(words[3]) << 32) | words[2];
+
+    block_index = new_block_index;
+}
+
+
+/// Returns the generator installed in the current thread, or nullptr if the thread uses its own generator.
+
+static RandomGenerator*& get_thread_generator_pointer()
+{
+    thread_local RandomGenerator* thread_generator_pointer = nullptr;
+
+    return thread_generator_pointer;
+}
+
+
+/// Returns the seed of the own generators of the threads.
+
+static atomic<uint64_t>& get_global_seed()
+{
+    static atomic<uint64_t> global_seed(RandomGenerator::default_seed);
+
+    return global_seed;
+}
+
+
+/// Returns the number of times that the global seed has been set, starting at one.
+/// The own generator of a thread is seeded again when this number changes.
+
+static atomic<uint64_t>& get_seeds_number()
+{
+    static atomic<uint64_t> seeds_number(1);
+
+    return seeds_number;
+}
+
+
+/// Identifier of the main thread of the program, whose own generator has the stream 0.
+
+static const thread::id main_thread_id = this_thread::get_id();
+
+
+/// Returns the stream of the own generator of the current thread.
+/// The main thread has the stream 0 and the threads of an OpenMP team have their number in the team,
+/// so that the parallel regions draw the same numbers in every run, whatever the system threads which run them.
+/// Other threads have streams above 2^32 in the order in which they are seeded,
+/// so the tasks which they run must install their own generators with ScopedRandomGenerator to be reproducible.
+
+static uint64_t get_thread_stream()
+{
+#ifdef _OPENMP
+
+    if(omp_in_parallel()) return static_cast<uint64_t>(omp_get_thread_num());
+
+#endif
+
+    if(this_thread::get_id() == main_thread_id) return 0;
+
+    static atomic<uint64_t> threads_number(0);
+
+    thread_local const uint64_t thread_stream = (static_cast<uint64_t>(1) << 32) + threads_number++;
+
+    return thread_stream;
+}
+
+
+/// Generator constructor.
+/// It installs a generator as the generator of the current thread.
+/// @param generator Generator to be used by the current thread. It must exist while this object exists.
+
+ScopedRandomGenerator::ScopedRandomGenerator(RandomGenerator& generator)
+{
+    RandomGenerator*& thread_generator_pointer = get_thread_generator_pointer();
+
+    previous_generator_pointer = thread_generator_pointer;
+
+    thread_generator_pointer = &generator;
+}
+
+
+/// Destructor.
+/// It installs again the previous generator of the current thread.
+
+ScopedRandomGenerator::~ScopedRandomGenerator()
+{
+    get_thread_generator_pointer() = previous_generator_pointer;
+}
+
+
+/// Returns the own generator of the current thread.
+/// It is seeded with the global seed and the stream of the thread the first time that the thread draws a random number,
+/// and again after the global seed is set, so that the threads do not repeat the numbers of each other.
+
+static RandomGenerator& get_thread_generator()
+{
+    thread_local RandomGenerator thread_generator;
+
+    thread_local uint64_t thread_seeds_number = 0;
+
+    const uint64_t seeds_number = get_seeds_number();
+
+    if(thread_seeds_number != seeds_number)
+    {
+        thread_generator.set(get_global_seed(), get_thread_stream());
+
+        thread_seeds_number = seeds_number;
+    }
+
+    return thread_generator;
+}
+
+
+/// Returns the generator from which the current thread draws its random numbers.
+/// It is the generator installed by a ScopedRandomGenerator object, if any, or the own generator of the thread otherwise.
+
+RandomGenerator& get_random_generator()
+{
+    RandomGenerator* thread_generator_pointer = get_thread_generator_pointer();
+
+    if(thread_generator_pointer != nullptr) return *thread_generator_pointer;
+
+    return get_thread_generator();
+}
+
+
+/// Sets the global seed, from which the own generators of all the threads are seeded again before their next random number.
+/// A generator installed in the current thread by a ScopedRandomGenerator object is also seeded, keeping its stream.
+/// Runs with the same seed draw the same random numbers.
+/// @param new_seed Seed of the generators.
+
+void set_random_seed(const uint64_t& new_seed)
+{
+    get_global_seed() = new_seed;
+
+    get_seeds_number()++;
+
+    RandomGenerator* thread_generator_pointer = get_thread_generator_pointer();
+
+    if(thread_generator_pointer != nullptr) thread_generator_pointer->set(new_seed, thread_generator_pointer->get_stream());
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
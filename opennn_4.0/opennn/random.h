@@ -0,0 +1,171 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   R A N D O M   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+// System includes
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+namespace OpenNN
+{
+
+/// This class represents a counter-based pseudo-random number generator, the Philox 4x32-10 generator[1].
+
+///
+/// Each number is obtained by encrypting a counter with the seed as the key, so the state of the generator
+/// is just its seed, its stream and its counter, which can be saved and restored exactly.
+/// Generators with the same seed and different streams produce independent sequences.
+///
+/// Every thread draws its random numbers from its own generator, returned by get_random_generator().
+/// The generators of the main thread and of the threads of an OpenMP team have fixed streams, and set_random_seed() seeds them all again.
+/// A task run by any other thread, such as a trial trained concurrently, is reproducible only with its own generator,
+/// split from the generator of the calling thread and installed with ScopedRandomGenerator.
+///
+/// \cite 1 J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw. "Parallel random numbers: as easy as 1, 2, 3." SC11, 2011.
+
+class RandomGenerator
+{
+
+public:
+
+   /// Type of the numbers returned by the generator, so that it can be used with the standard library algorithms.
+
+   typedef uint64_t result_type;
+
+   // Constructors
+
+   explicit RandomGenerator(const uint64_t& = default_seed, const uint64_t& = 0);
+
+   // Destructor
+
+   virtual ~RandomGenerator();
+
+   /// Returns the minimum number returned by the generator.
+
+   static constexpr result_type min() {return 0;}
+
+   /// Returns the maximum number returned by the generator.
+
+   static constexpr result_type max() {return UINT64_MAX;}
+
+   /// Seed of the generators which have not been seeded explicitly.
+
+   static const uint64_t default_seed = 5489;
+
+   // Get methods
+
+   const uint64_t& get_seed() const;
+   const uint64_t& get_stream() const;
+   const uint64_t& get_counter() const;
+
+   // Set methods
+
+   void set(const uint64_t&, const uint64_t& = 0);
+   void set_counter(const uint64_t&);
+
+   // Random numbers methods
+
+   result_type operator()();
+
+   double calculate_uniform();
+   double calculate_uniform(const double&, const double&);
+   double calculate_normal(const double& = 0.0, const double& = 1.0);
+
+   size_t calculate_index(const size_t&);
+
+   RandomGenerator split(const uint64_t&);
+
+private:
+
+   void calculate_block(const uint64_t&);
+
+   /// Seed of the generator, which is the key of the Philox encryption.
+
+   uint64_t seed;
+
+   /// Stream of the generator, which is the upper half of the Philox counter.
+
+   uint64_t stream;
+
+   /// Number of 64 bits numbers drawn from the generator.
+
+   uint64_t counter;
+
+   /// Index of the last block of four 32 bits words calculated.
+
+   uint64_t block_index;
+
+   /// Last block of four 32 bits words calculated, as two 64 bits numbers.
+
+   uint64_t block[2];
+};
+
+
+/// This class installs a generator as the generator of the current thread while it exists.
+
+///
+/// It is used to give a task its own sequence of random numbers, whatever the thread on which it runs.
+/// The previous generator of the thread is installed again when this object is destroyed.
+
+class ScopedRandomGenerator
+{
+
+public:
+
+   // Constructors
+
+   explicit ScopedRandomGenerator(RandomGenerator&);
+
+   ScopedRandomGenerator(const ScopedRandomGenerator&) = delete;
+
+   ScopedRandomGenerator& operator = (const ScopedRandomGenerator&) = delete;
+
+   // Destructor
+
+   virtual ~ScopedRandomGenerator();
+
+private:
+
+   /// Generator of the thread before this object was created.
+
+   RandomGenerator* previous_generator_pointer;
+};
+
+
+// Random generator of the current thread
+
+RandomGenerator& get_random_generator();
+
+void set_random_seed(const uint64_t&);
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -46,6 +46,8 @@ RecurrentLayer::RecurrentLayer(const size_t& new_inputs_number, const size_t& ne
 RecurrentLayer::RecurrentLayer(const RecurrentLayer& other_neuron_layer) : Layer()
 {
    set(other_neuron_layer);
+
+   layer_type = Recurrent;
 }
 
 
@@ -684,28 +686,76 @@ Tensor<double> RecurrentLayer::calculate_combinations(const Tensor<double>& inpu
     }
     #endif
 
+    return calculate_sequences_combinations(inputs, biases, input_weights, recurrent_weights);
+}
+
+
+/// Returns the combinations of a batch made of independent sequences.
+/// The rows of the inputs are arranged sequence by sequence, each sequence having timesteps rows
+/// (the last one might be shorter).
+/// The hidden states are reset at the beginning of each sequence,
+/// and all the sequences are propagated together at each time step, so that the products are matrix-matrix ones.
+/// @param inputs Layer inputs, with one row per time step.
+/// @param new_biases Biases of the layer.
+/// @param new_input_weights Input weights of the layer.
+/// @param new_recurrent_weights Recurrent weights of the layer.
+
+Tensor<double> RecurrentLayer::calculate_sequences_combinations(const Tensor<double>& inputs,
+                                                                const Vector<double>& new_biases,
+                                                                const Matrix<double>& new_input_weights,
+                                                                const Matrix<double>& new_recurrent_weights)
+{
     const size_t instances_number = inputs.get_dimension(0);
+    const size_t inputs_number = inputs.get_dimension(1);
 
-    const size_t neurons_number = get_neurons_number();
+    const size_t neurons_number = new_biases.size();
+
+    Tensor<double> combinations(instances_number, neurons_number);
+
+    if(instances_number == 0) return combinations;
 
-    Tensor<double> outputs(Vector<size_t>({instances_number, neurons_number}));
+    const size_t sequences_number = (instances_number + timesteps - 1)/timesteps;
 
-    for(size_t i = 0; i < instances_number; i++)
+    Tensor<double> current_inputs(sequences_number, inputs_number);
+
+    Tensor<double> current_hidden_states(Vector<size_t>({sequences_number, neurons_number}), 0.0);
+
+    size_t instance_index;
+
+    for(size_t step = 0; step < timesteps; step++)
     {
-        if(i%timesteps == 0) hidden_states.initialize(0.0);
+        // The last sequence might be shorter, and then it is padded with zeros
+
+        for(size_t j = 0; j < inputs_number; j++)
+        {
+            for(size_t i = 0; i < sequences_number; i++)
+            {
+                instance_index = i*timesteps+step;
+
+                current_inputs(i,j) = instance_index < instances_number ? inputs(instance_index, j) : 0.0;
+            }
+        }
 
-        const Vector<double> current_inputs = inputs.get_row(i);
+        Tensor<double> current_combinations = dot(current_inputs, new_input_weights) + dot(current_hidden_states, new_recurrent_weights);
 
-        const Vector<double> combinations = calculate_combinations(current_inputs);
+        for(size_t j = 0; j < neurons_number; j++)
+        {
+            for(size_t i = 0; i < sequences_number; i++)
+            {
+                current_combinations(i,j) += new_biases[j];
 
-        const Vector<double> activations = calculate_activations(combinations);
+                instance_index = i*timesteps+step;
 
-        hidden_states = activations;
+                if(instance_index < instances_number) combinations(instance_index, j) = current_combinations(i,j);
+            }
+        }
 
-        outputs.set_row(i, combinations);
-      }
+        current_hidden_states = calculate_activations(current_combinations);
+    }
+
+    hidden_states = calculate_activations(combinations.get_row(instances_number-1));
 
-    return outputs;
+    return combinations;
 }
 
 Vector<double> RecurrentLayer::calculate_combinations(const Vector<double>& inputs, const Vector<double>& parameters) const
@@ -1037,6 +1087,22 @@ void RecurrentLayer::update_hidden_states(const Vector<double>& inputs)
 
 Tensor<double> RecurrentLayer::calculate_outputs(const Tensor<double>& inputs)
 {
+    if(inputs.get_dimensions_number() == 3)
+    {
+        if(inputs.get_dimension(1) != timesteps)
+        {
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: RecurrentLayer class.\n"
+                   << "Tensor<double> calculate_outputs(const Tensor<double>&) method.\n"
+                   << "Time length of inputs (" << inputs.get_dimension(1) << ") must be equal to timesteps (" << timesteps << ").\n";
+
+            throw logic_error(buffer.str());
+        }
+
+        return calculate_outputs(inputs.sequences_to_rows()).rows_to_sequences(timesteps);
+    }
+
     #ifdef __OPENNN_DEBUG__
 
     const size_t inputs_number = get_inputs_number();
@@ -1055,28 +1121,7 @@ Tensor<double> RecurrentLayer::calculate_outputs(const Tensor<double>& inputs)
     }
     #endif
 
-    const size_t instances_number = inputs.get_dimension(0);
-
-    const size_t neurons_number = get_neurons_number();
-
-    Tensor<double> outputs(Vector<size_t>({instances_number, neurons_number}));
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(i%timesteps == 0) hidden_states.initialize(0.0);
-
-        const Vector<double> current_inputs = inputs.get_row(i);
-
-        const Vector<double> combinations = calculate_combinations(current_inputs);
-
-        const Vector<double> activations = calculate_activations(combinations);
-
-        outputs.set_row(i, activations);
-
-        hidden_states = activations;
-      }
-
-    return outputs;
+    return calculate_activations(calculate_sequences_combinations(inputs, biases, input_weights, recurrent_weights));
 }
 
 
@@ -1112,28 +1157,10 @@ Tensor<double> RecurrentLayer::calculate_outputs(const Tensor<double>& inputs, c
     }
     #endif
 
-    const size_t instances_number = inputs.get_dimension(0);
-
-    const size_t neurons_number = get_neurons_number();
-
-    Tensor<double> outputs(Vector<size_t>({instances_number, neurons_number}));
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(i%timesteps == 0) hidden_states.initialize(0.0);
-
-        const Vector<double> current_inputs = inputs.get_row(i);
-
-        const Vector<double> combinations = calculate_combinations(current_inputs, parameters);
-
-        const Vector<double> activations = calculate_activations(combinations);
-
-        hidden_states = activations;
-
-        outputs.set_row(i, activations);
-      }
-
-    return outputs;
+    return calculate_activations(calculate_sequences_combinations(inputs,
+                                                                  get_biases(parameters),
+                                                                  get_input_weights(parameters),
+                                                                  get_recurrent_weights(parameters)));
 }
 
 
@@ -1141,12 +1168,12 @@ Tensor<double> RecurrentLayer::calculate_outputs(const Tensor<double>& inputs,
                                                  const Vector<double>& new_biases,
                                                  const Matrix<double>& new_input_weights,
                                                  const Matrix<double>& new_recurrent_weights)
-{ 
+{
+   #ifdef __OPENNN_DEBUG__
+
    const size_t inputs_number = get_inputs_number();
    const size_t neurons_number = get_neurons_number();
 
-   #ifdef __OPENNN_DEBUG__
-
    const size_t inputs_columns_number = inputs.get_dimension(1);
 
    if(inputs_columns_number != inputs_number)
@@ -1208,26 +1235,7 @@ Tensor<double> RecurrentLayer::calculate_outputs(const Tensor<double>& inputs,
    }
    #endif
 
-    const size_t instances_number = inputs.get_dimension(0);
-
-    Tensor<double> outputs(Vector<size_t>({instances_number, neurons_number}));
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(i%timesteps == 0) hidden_states.initialize(0.0);
-
-        const Vector<double> current_inputs = inputs.get_row(i);
-
-        const Vector<double> combinations = calculate_combinations(current_inputs, new_biases, new_input_weights, new_recurrent_weights);
-
-        const Vector<double> activations = calculate_activations(combinations);
-
-        hidden_states = activations;
-
-        outputs.set_row(i, activations);
-      }
-
-    return outputs;
+    return calculate_activations(calculate_sequences_combinations(inputs, new_biases, new_input_weights, new_recurrent_weights));
 }
 
 
@@ -161,6 +161,8 @@ public:
 
    Tensor<double> calculate_combinations(const Tensor<double>&);
 
+   Tensor<double> calculate_sequences_combinations(const Tensor<double>&, const Vector<double>&, const Matrix<double>&, const Matrix<double>&);
+
    Vector<double> calculate_combinations(const Vector<double>&, const Vector<double>&) const;
 
    Vector<double> calculate_combinations(const Vector<double>&, const Vector<double>&, const Matrix<double>&, const Matrix<double>&) const;
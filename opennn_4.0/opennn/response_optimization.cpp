@@ -539,7 +539,7 @@ ResponseOptimization::Results* ResponseOptimization::perform_optimization() cons
 
 double ResponseOptimization::calculate_random_uniform(const double& minimum, const double& maximum) const
 {
-  const double random = static_cast<double>(rand()/(RAND_MAX + 1.0));
+  const double random = get_random_generator().calculate_uniform();
 
   const double random_uniform = minimum + (maximum - minimum) * random;
 
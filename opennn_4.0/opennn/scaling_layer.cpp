@@ -53,6 +53,8 @@ ScalingLayer::ScalingLayer(const Vector<Descriptives>& new_descriptives) : Layer
 ScalingLayer::ScalingLayer(const ScalingLayer& new_scaling_layer) : Layer()
 {
     set(new_scaling_layer);
+
+    layer_type = Scaling;
 }
 
 
@@ -808,160 +810,67 @@ void ScalingLayer::check_range(const Vector<double>& inputs) const
 
 Tensor<double> ScalingLayer::calculate_outputs(const Tensor<double>& inputs)
 {   
-    Tensor<double> outputs;
+    Tensor<double> outputs(inputs);
 
-    if(inputs.get_dimensions_number() == 2)
-    {
-        const size_t neurons_number = get_neurons_number();
+    scale(outputs);
 
-    #ifdef __OPENNN_DEBUG__
+    return outputs;
+}
 
-        ostringstream buffer;
 
-        const size_t columns_number = inputs.get_dimension(1);
+/// Scales a batch of inputs in place.
+/// The scale and offset of each neuron are computed once, so that every input is transformed with a single multiply-add.
+/// @param inputs Batch of inputs to the scaling layer, with the instances in the first dimension.
 
-        if(columns_number != neurons_number)
-        {
-            buffer << "OpenNN Exception: ScalingLayer class.\n"
-                   << "Tensor<double> calculate_outputs(const Tensor<double>&) const method.\n"
-                   << "Size of inputs (" << columns_number << ") must be equal to number of scaling neurons (" << neurons_number << ").\n";
+void ScalingLayer::scale(Tensor<double>& inputs) const
+{
+    const size_t neurons_number = get_neurons_number();
 
-            throw logic_error(buffer.str());
-        }
+    #ifdef __OPENNN_DEBUG__
 
-    #endif
+    const size_t dimensions_number = inputs.get_dimensions_number();
 
-        const size_t points_number = inputs.get_dimension(0);
+    if(dimensions_number != 2 && dimensions_number != 4)
+    {
+        ostringstream buffer;
 
-        outputs.set(Vector<size_t>({points_number, neurons_number}));
+        buffer << "OpenNN Exception: ScalingLayer class.\n"
+               << "void scale(Tensor<double>&) const method.\n"
+               << "Number of dimensions of inputs (" << dimensions_number << ") must be 2 or 4.\n";
 
-        for(size_t i = 0; i < points_number; i++)
-        {
-            for(size_t j = 0; j < neurons_number; j++)
-            {
-                if(abs(descriptives[j].minimum - descriptives[j].maximum) < numeric_limits<double>::min())
-                {
-                    if(display)
-                    {
-                        cout << "OpenNN Warning: ScalingLayer class.\n"
-                                  << "Tensor<double> calculate_mean_standard_deviation_outputs(const Tensor<double>&) const method.\n"
-                                  << "Standard deviation of variable " << i << " is zero.\n"
-                                  << "Those variables won't be scaled.\n";
-                    }
-
-                    outputs[j] = inputs[j];
-                }
-                else
-                {
-                    if(scaling_methods[j] == NoScaling)
-                    {
-                        outputs(i,j) = inputs(i,j);
-                    }
-                    else if(scaling_methods[j] == MinimumMaximum)
-                    {
-                        outputs(i,j) = 2.0*(inputs(i,j) - descriptives[j].minimum)/(descriptives[j].maximum-descriptives[j].minimum) - 1.0;
-                    }
-                    else if(scaling_methods[j] == MeanStandardDeviation)
-                    {
-                        outputs(i,j) = (inputs(i,j) - descriptives[j].mean)/descriptives[j].standard_deviation;
-                    }
-                    else if(scaling_methods[j] == StandardDeviation)
-                    {
-                        outputs(i,j) = inputs(i,j)/descriptives[j].standard_deviation;
-                    }
-                    else
-                    {
-                        ostringstream buffer;
-
-                        buffer << "OpenNN Exception: ScalingLayer class\n"
-                               << "Tensor<double> calculate_outputs(const Tensor<double>&) const method.\n"
-                               << "Unknown scaling method.\n";
-
-                        throw logic_error(buffer.str());
-                    }
-                }
-            }
-        }
+        throw logic_error(buffer.str());
     }
-    else if(inputs.get_dimensions_number() == 4)
-    {
-        const size_t neurons_number = get_neurons_number();
 
-    #ifdef __OPENNN_DEBUG__
+    const size_t columns_number = inputs.size()/inputs.get_dimension(0);
 
+    if(columns_number != neurons_number)
+    {
         ostringstream buffer;
 
-        const size_t columns_number = inputs.get_dimension(1) * inputs.get_dimension(2) * inputs.get_dimension(3);
-
-        if(columns_number != neurons_number)
-        {
-            buffer << "OpenNN Exception: ScalingLayer class.\n"
-                   << "Tensor<double> calculate_outputs(const Tensor<double>&) const method.\n"
-                   << "Size of inputs (" << columns_number << ") must be equal to number of scaling neurons (" << neurons_number << ").\n";
+        buffer << "OpenNN Exception: ScalingLayer class.\n"
+               << "void scale(Tensor<double>&) const method.\n"
+               << "Size of inputs (" << columns_number << ") must be equal to number of scaling neurons (" << neurons_number << ").\n";
 
-            throw logic_error(buffer.str());
-        }
+        throw logic_error(buffer.str());
+    }
 
     #endif
 
-        const size_t points_number = inputs.get_dimension(0);
-
-        outputs.set(Vector<size_t>({points_number, inputs.get_dimension(1), inputs.get_dimension(2), inputs.get_dimension(3)}));
-
-        for(size_t i = 0; i < points_number; i++)
+    if(display)
+    {
+        for(size_t j = 0; j < neurons_number; j++)
         {
-            for(size_t j = 0; j < neurons_number; j++)
+            if(abs(descriptives[j].minimum - descriptives[j].maximum) < numeric_limits<double>::min())
             {
-                size_t channel_index = j%(inputs.get_dimension(1));
-                size_t row_index = (j/(inputs.get_dimension(1)))%(inputs.get_dimension(2));
-                size_t column_index = (j/(inputs.get_dimension(1) * inputs.get_dimension(2)))%(inputs.get_dimension(3));
-
-                if(abs(descriptives[j].minimum - descriptives[j].maximum) < numeric_limits<double>::min())
-                {
-                    if(display)
-                    {
-                        cout << "OpenNN Warning: ScalingLayer class.\n"
-                                  << "Tensor<double> calculate_mean_standard_deviation_outputs(const Tensor<double>&) const method.\n"
-                                  << "Standard deviation of variable " << i << " is zero.\n"
-                                  << "Those variables won't be scaled.\n";
-                    }
-
-                    outputs[j] = inputs[j];
-                }
-                else
-                {
-                    if(scaling_methods[j] == NoScaling)
-                    {
-                        outputs(i, channel_index, row_index, column_index) = inputs(i, channel_index, row_index, column_index);
-                    }
-                    else if(scaling_methods[j] == MinimumMaximum)
-                    {
-                        outputs(i, channel_index, row_index, column_index) = 2.0*(inputs(i, channel_index, row_index, column_index) - descriptives[j].minimum)/(descriptives[j].maximum-descriptives[j].minimum) - 1.0;
-                    }
-                    else if(scaling_methods[j] == MeanStandardDeviation)
-                    {
-                        outputs(i, channel_index, row_index, column_index) = (inputs(i, channel_index, row_index, column_index) - descriptives[j].mean)/descriptives[j].standard_deviation;
-                    }
-                    else if(scaling_methods[j] == StandardDeviation)
-                    {
-                        outputs(i, channel_index, row_index, column_index) = inputs(i, channel_index, row_index, column_index)/descriptives[j].standard_deviation;
-                    }
-                    else
-                    {
-                        ostringstream buffer;
-
-                        buffer << "OpenNN Exception: ScalingLayer class\n"
-                               << "Tensor<double> calculate_outputs(const Tensor<double>&) const method.\n"
-                               << "Unknown scaling method.\n";
-
-                        throw logic_error(buffer.str());
-                    }
-                }
+                cout << "OpenNN Warning: ScalingLayer class.\n"
+                     << "void scale(Tensor<double>&) const method.\n"
+                     << "Minimum and maximum values of variable " << j << " are equal.\n"
+                     << "Those variables won't be scaled.\n";
             }
         }
     }
 
-    return outputs;
+    scale_columns(inputs, calculate_scales(), calculate_offsets());
 }
 
 
@@ -1033,6 +942,73 @@ Tensor<double> ScalingLayer::calculate_mean_standard_deviation_outputs(const Ten
 }
 
 
+/// Returns the factors by which the scaling layer multiplies each input.
+/// Every scaling method is affine, so that each output is input*scale + offset.
+/// Variables whose minimum and maximum are equal are not scaled.
+
+Vector<double> ScalingLayer::calculate_scales() const
+{
+    const size_t neurons_number = get_neurons_number();
+
+    Vector<double> scales(neurons_number, 1.0);
+
+    for(size_t i = 0; i < neurons_number; i++)
+    {
+        if(abs(descriptives[i].minimum - descriptives[i].maximum) < numeric_limits<double>::min()) continue;
+
+        switch(scaling_methods[i])
+        {
+            case NoScaling:
+            break;
+
+            case MinimumMaximum:
+            scales[i] = 2.0/(descriptives[i].maximum-descriptives[i].minimum);
+            break;
+
+            case MeanStandardDeviation:
+            case StandardDeviation:
+            scales[i] = 1.0/descriptives[i].standard_deviation;
+            break;
+        }
+    }
+
+    return scales;
+}
+
+
+/// Returns the terms which the scaling layer adds to each input after multiplying it by its scale.
+/// Variables whose minimum and maximum are equal are not scaled.
+
+Vector<double> ScalingLayer::calculate_offsets() const
+{
+    const size_t neurons_number = get_neurons_number();
+
+    Vector<double> offsets(neurons_number, 0.0);
+
+    for(size_t i = 0; i < neurons_number; i++)
+    {
+        if(abs(descriptives[i].minimum - descriptives[i].maximum) < numeric_limits<double>::min()) continue;
+
+        switch(scaling_methods[i])
+        {
+            case NoScaling:
+            case StandardDeviation:
+            break;
+
+            case MinimumMaximum:
+            offsets[i] = -2.0*descriptives[i].minimum/(descriptives[i].maximum-descriptives[i].minimum) - 1.0;
+            break;
+
+            case MeanStandardDeviation:
+            offsets[i] = -descriptives[i].mean/descriptives[i].standard_deviation;
+            break;
+        }
+    }
+
+    return offsets;
+}
+
+
 /// Returns a string with the expression of the scaling process when the none method is used.
 /// @param inputs_names Name of inputs to the scaling layer. The size of this vector must be equal to the number of scaling neurons.
 /// @param outputs_names Name of outputs from the scaling layer. The size of this vector must be equal to the number of scaling neurons.
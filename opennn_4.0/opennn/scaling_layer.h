@@ -24,6 +24,7 @@
 #include "matrix.h"
 #include "layer.h"
 #include "statistics.h"
+#include "transformations.h"
 
 
 
@@ -147,10 +148,15 @@ public:
 
    Tensor<double> calculate_outputs(const Tensor<double>&);
 
+   void scale(Tensor<double>&) const;
+
    Tensor<double> calculate_minimum_maximum_outputs(const Tensor<double>&) const;
 
    Tensor<double> calculate_mean_standard_deviation_outputs(const Tensor<double>&) const;
 
+   Vector<double> calculate_scales() const;
+   Vector<double> calculate_offsets() const;
+
    // Expression methods
 
    string write_no_scaling_expression(const Vector<string>&, const Vector<string>&) const;
@@ -57,6 +57,22 @@ StochasticGradientDescent::~StochasticGradientDescent()
 }
 
 
+/// Returns a constant reference to the learning rate schedule object used along the training.
+
+const LearningRateSchedule& StochasticGradientDescent::get_learning_rate_schedule() const
+{
+   return learning_rate_schedule;
+}
+
+
+/// Returns a pointer to the learning rate schedule object used along the training.
+
+LearningRateSchedule* StochasticGradientDescent::get_learning_rate_schedule_pointer()
+{
+   return &learning_rate_schedule;
+}
+
+
 /// Returns the initial learning rate.
 
 const double& StochasticGradientDescent::get_initial_learning_rate() const
@@ -207,6 +223,38 @@ const bool& StochasticGradientDescent::get_reserve_selection_error_history() con
 }
 
 
+/// Returns true if the selection error is calculated on a background thread, concurrently with the training, and false otherwise.
+
+const bool& StochasticGradientDescent::get_asynchronous_selection_error() const
+{
+   return asynchronous_selection_error;
+}
+
+
+/// Returns the number of epochs between two calculations of the selection error.
+
+const size_t& StochasticGradientDescent::get_selection_error_period() const
+{
+   return selection_error_period;
+}
+
+
+/// Returns the fraction of the selection instances on which the selection error is calculated.
+
+const double& StochasticGradientDescent::get_selection_instances_fraction() const
+{
+   return selection_instances_fraction;
+}
+
+
+/// Returns the number of batches whose gradients are accumulated before each update of the parameters.
+
+const size_t& StochasticGradientDescent::get_gradient_accumulation_steps() const
+{
+   return gradient_accumulation_steps;
+}
+
+
 /// Sets a pointer to a loss index object to be associated to the gradient descent object.
 /// It also sets that loss index to the learning rate algorithm.
 /// @param new_loss_index_pointer Pointer to a loss index object.
@@ -251,6 +299,16 @@ void StochasticGradientDescent::set_default()
    reserve_training_error_history = true;
    reserve_selection_error_history = false;
 
+   // SELECTION ERROR
+
+   asynchronous_selection_error = false;
+   selection_error_period = 1;
+   selection_instances_fraction = 1.0;
+
+   // GRADIENT ACCUMULATION
+
+   gradient_accumulation_steps = 1;
+
    // UTILITIES
 
    display = true;
@@ -694,6 +752,78 @@ void StochasticGradientDescent::set_reserve_selection_error_history(const bool&
 }
 
 
+/// Makes the selection error to be calculated on a background thread or not.
+/// In that case, the selection error of the parameters at the end of an epoch is calculated while the next epochs are trained,
+/// and it is taken into account by the early stopping one evaluation later.
+/// Neural networks with recurrent layers, which keep a state, are always evaluated on the training thread.
+/// @param new_asynchronous_selection_error True if the selection error is to be calculated asynchronously, false otherwise.
+
+void StochasticGradientDescent::set_asynchronous_selection_error(const bool& new_asynchronous_selection_error)
+{
+   asynchronous_selection_error = new_asynchronous_selection_error;
+}
+
+
+/// Sets the number of epochs between two calculations of the selection error.
+/// @param new_selection_error_period Number of epochs. If it is 0, the selection error is calculated every epoch.
+
+void StochasticGradientDescent::set_selection_error_period(const size_t& new_selection_error_period)
+{
+   selection_error_period = max(new_selection_error_period, static_cast<size_t>(1));
+}
+
+
+/// Sets the fraction of the selection instances on which the selection error is calculated.
+/// A different random sample is used each time, and the error over the whole selection subset is extrapolated from it.
+/// @param new_selection_instances_fraction Fraction of selection instances, between 0 and 1.
+
+void StochasticGradientDescent::set_selection_instances_fraction(const double& new_selection_instances_fraction)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_selection_instances_fraction <= 0.0 || new_selection_instances_fraction > 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_selection_instances_fraction(const double&) method.\n"
+             << "Fraction of selection instances must be greater than 0 and equal or less than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   selection_instances_fraction = new_selection_instances_fraction;
+}
+
+
+/// Sets the number of batches whose gradients are accumulated before each update of the parameters.
+/// This allows an effective batch size larger than the one which fits in memory.
+/// The batch gradients are added, which gives the gradient of the union of the accumulated batches.
+/// @param new_gradient_accumulation_steps Number of accumulated batches, greater than 0.
+
+void StochasticGradientDescent::set_gradient_accumulation_steps(const size_t& new_gradient_accumulation_steps)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_gradient_accumulation_steps == 0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_gradient_accumulation_steps(const size_t&) method.\n"
+             << "Number of gradient accumulation steps must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   gradient_accumulation_steps = new_gradient_accumulation_steps;
+}
+
+
 /// Sets a new number of iterations between the training showing progress.
 /// @param new_display_period
 /// Number of iterations between the training showing progress.
@@ -753,7 +883,6 @@ OptimizationAlgorithm::Results StochasticGradientDescent::perform_training()
    const size_t parameters_number = neural_network_pointer->get_parameters_number();
 
    Vector<double> parameters(parameters_number);
-   Vector<double> parameters_increment(parameters_number);
    Vector<double> last_increment(parameters_number,0.0);
 
    double parameters_norm = 0.0;
@@ -777,8 +906,6 @@ OptimizationAlgorithm::Results StochasticGradientDescent::perform_training()
 
    size_t selection_failures = 0;
 
-   Vector<double> nesterov_increment(parameters_number);
-
    Vector<double> minimum_selection_error_parameters(parameters_number);
    double minimum_selection_error = numeric_limits<double>::max();
 
@@ -790,18 +917,37 @@ OptimizationAlgorithm::Results StochasticGradientDescent::perform_training()
 
    results.resize_training_history(maximum_epochs_number + 1);
 
+   learning_rate_schedule.reset();
+
    size_t current_iteration = 0;
    size_t learning_rate_iteration = 1;
 
-    bool is_forecasting = false;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
+
+   // Selection error stuff
+
+   const bool asynchronous = asynchronous_selection_error
+                          && !neural_network_pointer->has_recurrent_layer()
+                          && !neural_network_pointer->has_long_short_term_memory_layer();
+
+   future<double> selection_error_future;
+
+   Vector<double> selection_error_parameters;
+   Vector<double> pending_selection_error_parameters;
 
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+   bool selection_error_evaluated = false;
+
+   // Gradient accumulation stuff
+
+   Vector<double> accumulated_gradient(gradient_accumulation_steps > 1 ? parameters_number : 0, 0.0);
+
+   size_t accumulated_batches_number = 0;
 
    // Main loop
 
    for(size_t epoch = 0; epoch <= epochs_number; epoch++)
    {
-       const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+       const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
        const size_t batches_number = training_batches.size();
 
@@ -823,36 +969,41 @@ OptimizationAlgorithm::Results StochasticGradientDescent::perform_training()
 
            // Gradient
 
-            initial_decay > 0.0 ? learning_rate = initial_learning_rate * (1.0 / (1.0 + learning_rate_iteration*initial_decay)) : initial_learning_rate ;
+           if(gradient_accumulation_steps > 1)
+           {
+               accumulated_gradient += first_order_loss.gradient;
 
-            parameters = neural_network_pointer->get_parameters();
+               accumulated_batches_number++;
 
-            parameters_increment = first_order_loss.gradient*(-learning_rate);
+               if(accumulated_batches_number < gradient_accumulation_steps && iteration != batches_number - 1) continue;
 
-            if(momentum > 0.0 && !nesterov)
-            {
-                parameters_increment += last_increment*momentum;
+               // The regularization gradient, included in every batch gradient, is counted only once
 
-                last_increment = parameters_increment;
+               if(accumulated_batches_number > 1 && loss_index_pointer->get_regularization_method() != LossIndex::NoRegularization)
+               {
+                   accumulated_gradient -= loss_index_pointer->calculate_regularization_gradient()
+                                         *loss_index_pointer->get_regularization_weight()*static_cast<double>(accumulated_batches_number - 1);
+               }
+           }
 
-                neural_network_pointer->set_parameters(parameters + parameters_increment);
-            }
-            else if(momentum > 0.0 && nesterov )
-            {
-                parameters_increment += last_increment*momentum;
+           const Vector<double>& gradient = gradient_accumulation_steps > 1 ? accumulated_gradient : first_order_loss.gradient;
 
-                last_increment = parameters_increment;
+           learning_rate = initial_learning_rate*learning_rate_schedule.calculate_learning_rate_factor(epoch + (iteration + 1.0)/batches_number);
 
-                nesterov_increment = parameters_increment*momentum - first_order_loss.gradient*(learning_rate) ;
+           if(initial_decay > 0.0) learning_rate /= 1.0 + learning_rate_iteration*initial_decay;
 
-                neural_network_pointer->set_parameters(parameters + nesterov_increment);
-            }
-            else
-            {
-                neural_network_pointer->set_parameters(parameters + parameters_increment);
-            }
+           update_parameters(gradient, learning_rate, last_increment, parameters);
+
+           neural_network_pointer->set_parameters(parameters);
+
+           learning_rate_iteration++;
+
+           if(gradient_accumulation_steps > 1)
+           {
+               accumulated_gradient.initialize(0.0);
 
-            learning_rate_iteration++;
+               accumulated_batches_number = 0;
+           }
        }
 
        gradient_norm = l2_norm(first_order_loss.gradient);
@@ -861,21 +1012,73 @@ OptimizationAlgorithm::Results StochasticGradientDescent::perform_training()
 
        training_error = loss/static_cast<double>(batches_number);
 
-       if(selection_instances_number > 0) selection_error = loss_index_pointer->calculate_selection_error();
+       // Selection error
+
+       bool selection_error_updated = false;
 
-       if(epoch == 0)
+       if(selection_instances_number == 0)
        {
-          minimum_selection_error = selection_error;
-          minimum_selection_error_parameters = neural_network_pointer->get_parameters();
+           selection_error_parameters = parameters;
+
+           selection_error_updated = true;
        }
-       else if(epoch != 0 && selection_error > old_selection_error)
+       else if(epoch % selection_error_period == 0)
        {
-          selection_failures++;
+           Vector<Vector<size_t>> selection_batches = data_set_pointer->get_selection_batches(true, timesteps);
+
+           const size_t selection_batches_number
+                   = max(static_cast<size_t>(1), static_cast<size_t>(ceil(selection_instances_fraction*selection_batches.size())));
+
+           selection_batches.resize(selection_batches_number);
+
+           if(asynchronous)
+           {
+               // The selection error of the previous snapshot is collected, and the current parameters are evaluated in background
+
+               if(selection_error_future.valid())
+               {
+                   selection_error = selection_error_future.get();
+
+                   selection_error_parameters.swap(pending_selection_error_parameters);
+
+                   selection_error_updated = true;
+               }
+
+               pending_selection_error_parameters = parameters;
+
+               selection_error_future = async(launch::async, &LossIndex::calculate_selection_error_estimate,
+                                              loss_index_pointer, pending_selection_error_parameters, selection_batches);
+           }
+           else
+           {
+               selection_error = loss_index_pointer->calculate_selection_error_estimate(parameters, selection_batches);
+
+               selection_error_parameters = parameters;
+
+               selection_error_updated = true;
+           }
        }
-       else if(selection_error <= minimum_selection_error)
+
+       if(selection_error_updated)
        {
-          minimum_selection_error = selection_error;
-          minimum_selection_error_parameters = neural_network_pointer->get_parameters();
+           if(selection_instances_number > 0) learning_rate_schedule.update_selection_error(selection_error);
+
+           if(!selection_error_evaluated)
+           {
+              minimum_selection_error = selection_error;
+              minimum_selection_error_parameters = selection_error_parameters;
+
+              selection_error_evaluated = true;
+           }
+           else if(selection_error > old_selection_error)
+           {
+              selection_failures++;
+           }
+           else if(selection_error <= minimum_selection_error)
+           {
+              minimum_selection_error = selection_error;
+              minimum_selection_error_parameters = selection_error_parameters;
+           }
        }
 
        // Elapsed time
@@ -987,6 +1190,26 @@ OptimizationAlgorithm::Results StochasticGradientDescent::perform_training()
        if(stop_training) break;
    }
 
+   // Selection error of the last snapshot
+
+   if(selection_error_future.valid())
+   {
+       selection_error = selection_error_future.get();
+
+       if(!selection_error_evaluated || selection_error <= minimum_selection_error)
+       {
+           minimum_selection_error = selection_error;
+           minimum_selection_error_parameters = pending_selection_error_parameters;
+       }
+
+       results.final_selection_error = selection_error;
+
+       if(reserve_selection_error_history && !results.selection_error_history.empty())
+       {
+           results.selection_error_history[results.selection_error_history.size() - 1] = selection_error;
+       }
+   }
+
    if(return_minimum_selection_error_neural_network)
    {
        parameters = minimum_selection_error_parameters;
@@ -1011,6 +1234,59 @@ OptimizationAlgorithm::Results StochasticGradientDescent::perform_training()
 }
 
 
+/// Updates the momentum increment and then the parameters, in place.
+/// Both are updated in a single pass over the parameters, without temporary vectors.
+/// @param gradient Gradient of the loss for the current batch.
+/// @param learning_rate Current learning rate.
+/// @param last_increment Parameters increment of the previous update, which is replaced by the current one when momentum is used.
+/// @param parameters Parameters of the neural network.
+
+void StochasticGradientDescent::update_parameters(const Vector<double>& gradient,
+                                                  const double& learning_rate,
+                                                  Vector<double>& last_increment,
+                                                  Vector<double>& parameters) const
+{
+   const size_t parameters_number = parameters.size();
+
+   const double* gradient_data = gradient.data();
+
+   double* last_increment_data = last_increment.data();
+   double* parameters_data = parameters.data();
+
+   if(momentum <= 0.0)
+   {
+      #pragma omp parallel for if(parameters_number > 100000)
+
+      for(int i = 0; i < static_cast<int>(parameters_number); i++)
+      {
+         parameters_data[i] -= learning_rate*gradient_data[i];
+      }
+   }
+   else if(!nesterov)
+   {
+      #pragma omp parallel for if(parameters_number > 100000)
+
+      for(int i = 0; i < static_cast<int>(parameters_number); i++)
+      {
+         last_increment_data[i] = momentum*last_increment_data[i] - learning_rate*gradient_data[i];
+
+         parameters_data[i] += last_increment_data[i];
+      }
+   }
+   else
+   {
+      #pragma omp parallel for if(parameters_number > 100000)
+
+      for(int i = 0; i < static_cast<int>(parameters_number); i++)
+      {
+         last_increment_data[i] = momentum*last_increment_data[i] - learning_rate*gradient_data[i];
+
+         parameters_data[i] += momentum*last_increment_data[i] - learning_rate*gradient_data[i];
+      }
+   }
+}
+
+
 void StochasticGradientDescent::perform_training_void()
 {
     perform_training();
@@ -1032,6 +1308,12 @@ Matrix<string> StochasticGradientDescent::to_string_matrix() const
     Vector<string> labels;
     Vector<string> values;
 
+   // Learning rate schedule
+
+   labels.push_back("Learning rate schedule");
+
+   values.push_back(learning_rate_schedule.write_schedule_method());
+
    // Minimum parameters increment norm
 
    labels.push_back("Minimum parameters increment norm");
@@ -1159,6 +1441,19 @@ tinyxml2::XMLDocument* StochasticGradientDescent::to_XML() const
    tinyxml2::XMLElement* element = nullptr;
    tinyxml2::XMLText* text = nullptr;
 
+   // Learning rate schedule
+   {
+      const tinyxml2::XMLDocument* learning_rate_schedule_document = learning_rate_schedule.to_XML();
+
+      const tinyxml2::XMLElement* learning_rate_schedule_element = learning_rate_schedule_document->FirstChildElement("LearningRateSchedule");
+
+      tinyxml2::XMLNode* node = learning_rate_schedule_element->DeepClone(document);
+
+      root_element->InsertEndChild(node);
+
+      delete learning_rate_schedule_document;
+   }
+
    // Return minimum selection error neural network
 
    element = document->NewElement("ReturnMinimumSelectionErrorNN");
@@ -1335,6 +1630,50 @@ tinyxml2::XMLDocument* StochasticGradientDescent::to_XML() const
    text = document->NewText(buffer.str().c_str());
    element->LinkEndChild(text);
 
+   // Asynchronous selection error
+
+   element = document->NewElement("AsynchronousSelectionError");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << asynchronous_selection_error;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Selection error period
+
+   element = document->NewElement("SelectionErrorPeriod");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << selection_error_period;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Selection instances fraction
+
+   element = document->NewElement("SelectionInstancesFraction");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << selection_instances_fraction;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Gradient accumulation steps
+
+   element = document->NewElement("GradientAccumulationSteps");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << gradient_accumulation_steps;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
    // Display period
 
    element = document->NewElement("DisplayPeriod");
@@ -1389,6 +1728,10 @@ void StochasticGradientDescent::write_XML(tinyxml2::XMLPrinter& file_stream) con
 
     //file_stream.OpenElement("StochasticGradientDescent");
 
+    // Learning rate schedule
+
+    learning_rate_schedule.write_XML(file_stream);
+
     // Return minimum selection error neural network
 
 
@@ -1511,6 +1854,50 @@ void StochasticGradientDescent::write_XML(tinyxml2::XMLPrinter& file_stream) con
     file_stream.PushText(buffer.str().c_str());
 
     file_stream.CloseElement();
+
+    // Asynchronous selection error
+
+    file_stream.OpenElement("AsynchronousSelectionError");
+
+    buffer.str("");
+    buffer << asynchronous_selection_error;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Selection error period
+
+    file_stream.OpenElement("SelectionErrorPeriod");
+
+    buffer.str("");
+    buffer << selection_error_period;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Selection instances fraction
+
+    file_stream.OpenElement("SelectionInstancesFraction");
+
+    buffer.str("");
+    buffer << selection_instances_fraction;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Gradient accumulation steps
+
+    file_stream.OpenElement("GradientAccumulationSteps");
+
+    buffer.str("");
+    buffer << gradient_accumulation_steps;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
 }
 
 
@@ -1529,6 +1916,22 @@ void StochasticGradientDescent::from_XML(const tinyxml2::XMLDocument& document)
         throw logic_error(buffer.str());
     }
 
+    // Learning rate schedule
+    {
+       const tinyxml2::XMLElement* learning_rate_schedule_element = root_element->FirstChildElement("LearningRateSchedule");
+
+       if(learning_rate_schedule_element)
+       {
+           tinyxml2::XMLDocument learning_rate_schedule_document;
+
+           tinyxml2::XMLNode* element_clone = learning_rate_schedule_element->DeepClone(&learning_rate_schedule_document);
+
+           learning_rate_schedule_document.InsertFirstChild(element_clone);
+
+           learning_rate_schedule.from_XML(learning_rate_schedule_document);
+       }
+    }
+
    // Warning parameters norm
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarningParametersNorm");
@@ -1812,6 +2215,82 @@ void StochasticGradientDescent::from_XML(const tinyxml2::XMLDocument& document)
         }
     }
 
+   // Asynchronous selection error
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("AsynchronousSelectionError");
+
+       if(element)
+       {
+          const string new_asynchronous_selection_error = element->GetText();
+
+          try
+          {
+             set_asynchronous_selection_error(new_asynchronous_selection_error != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Selection error period
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("SelectionErrorPeriod");
+
+       if(element)
+       {
+          const size_t new_selection_error_period = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_selection_error_period(new_selection_error_period);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Selection instances fraction
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("SelectionInstancesFraction");
+
+       if(element)
+       {
+          const double new_selection_instances_fraction = atof(element->GetText());
+
+          try
+          {
+             set_selection_instances_fraction(new_selection_instances_fraction);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Gradient accumulation steps
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("GradientAccumulationSteps");
+
+       if(element)
+       {
+          const size_t new_gradient_accumulation_steps = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_gradient_accumulation_steps(new_gradient_accumulation_steps);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
    // Display period
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("DisplayPeriod");
@@ -18,6 +18,7 @@
 #include <fstream>
 #include <algorithm>
 #include <functional>
+#include <future>
 #include <limits>
 #include <cmath>
 #include <ctime>
@@ -27,6 +28,7 @@
 #include "loss_index.h"
 #include "mean_squared_error.h"
 #include "optimization_algorithm.h"
+#include "learning_rate_schedule.h"
 
 namespace OpenNN
 {
@@ -57,6 +59,9 @@ public:
    
    //Training operators
 
+   const LearningRateSchedule& get_learning_rate_schedule() const;
+   LearningRateSchedule* get_learning_rate_schedule_pointer();
+
    const double& get_initial_learning_rate() const;
    const double& get_initial_decay() const;
    const double& get_momentum() const;
@@ -85,6 +90,16 @@ public:
    const bool& get_reserve_training_error_history() const;
    const bool& get_reserve_selection_error_history() const;
 
+   // Selection error
+
+   const bool& get_asynchronous_selection_error() const;
+   const size_t& get_selection_error_period() const;
+   const double& get_selection_instances_fraction() const;
+
+   // Gradient accumulation
+
+   const size_t& get_gradient_accumulation_steps() const;
+
    // Set methods
 
    void set_loss_index_pointer(LossIndex*);
@@ -124,12 +139,24 @@ public:
    void set_reserve_training_error_history(const bool&);
    void set_reserve_selection_error_history(const bool&);
 
+   // Selection error
+
+   void set_asynchronous_selection_error(const bool&);
+   void set_selection_error_period(const size_t&);
+   void set_selection_instances_fraction(const double&);
+
+   // Gradient accumulation
+
+   void set_gradient_accumulation_steps(const size_t&);
+
    // Utilities
 
    void set_display_period(const size_t&);
 
    // Training methods
 
+   void update_parameters(const Vector<double>&, const double&, Vector<double>&, Vector<double>&) const;
+
    Results perform_training();
 
    void perform_training_void();
@@ -150,6 +177,10 @@ private:
 
    // TRAINING OPERATORS
 
+   /// Schedule of the learning rate along the training.
+
+   LearningRateSchedule learning_rate_schedule;
+
    /// Initial learning rate
 
    double initial_learning_rate;
@@ -232,6 +263,26 @@ private:
    /// True if the selection error history vector is to be reserved, false otherwise.
 
    bool reserve_selection_error_history;
+
+   // SELECTION ERROR
+
+   /// True if the selection error is calculated on a background thread while the next epochs are trained, false otherwise.
+   /// The selection error of an epoch is then known one evaluation later.
+
+   bool asynchronous_selection_error;
+
+   /// Number of epochs between two calculations of the selection error.
+
+   size_t selection_error_period;
+
+   /// Fraction of the selection instances, randomly sampled each time, on which the selection error is calculated.
+
+   double selection_instances_fraction;
+
+   /// Number of batches whose gradients are accumulated before each update of the parameters.
+   /// The effective batch size is the number of batch instances of the data set times this value.
+
+   size_t gradient_accumulation_steps;
 };
 
 }
@@ -119,6 +119,9 @@ public:
 
     Tensor<T> to_2d_tensor() const;
 
+    Tensor<T> sequences_to_rows() const;
+    Tensor<T> rows_to_sequences(const size_t&) const;
+
     // Get methods
 
     Vector<size_t> get_dimensions() const;
@@ -1264,6 +1267,91 @@ Tensor<T> Tensor<T>::to_2d_tensor() const
     return tensor;
 }
 
+/// Returns a third order tensor of sequences as a 2-dimensional tensor with one row per time step.
+/// The dimensions of this tensor are sequences, timesteps and variables.
+/// The rows of the result are arranged sequence by sequence, so that row s*timesteps+t is step t of sequence s.
+
+template <class T>
+Tensor<T> Tensor<T>::sequences_to_rows() const
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(get_dimensions_number() != 3)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Tensor template.\n"
+               << "Tensor<T> sequences_to_rows() const method.\n"
+               << "Number of dimensions (" << get_dimensions_number() << ") must be 3.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const size_t sequences_number = dimensions[0];
+    const size_t timesteps = dimensions[1];
+    const size_t variables_number = dimensions[2];
+
+    Tensor<T> rows(sequences_number*timesteps, variables_number);
+
+    for(size_t k = 0; k < variables_number; k++)
+    {
+        for(size_t j = 0; j < timesteps; j++)
+        {
+            for(size_t i = 0; i < sequences_number; i++)
+            {
+                rows(i*timesteps+j, k) = (*this)(i, j, k);
+            }
+        }
+    }
+
+    return rows;
+}
+
+
+/// Returns a 2-dimensional tensor with one row per time step as a third order tensor of sequences.
+/// This is the inverse of sequences_to_rows.
+/// @param timesteps Number of rows in each sequence.
+
+template <class T>
+Tensor<T> Tensor<T>::rows_to_sequences(const size_t& timesteps) const
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(get_dimensions_number() != 2 || timesteps == 0 || dimensions[0]%timesteps != 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Tensor template.\n"
+               << "Tensor<T> rows_to_sequences(const size_t&) const method.\n"
+               << "Tensor must be of order two and its number of rows a multiple of timesteps.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const size_t sequences_number = dimensions[0]/timesteps;
+    const size_t variables_number = dimensions[1];
+
+    Tensor<T> sequences(sequences_number, timesteps, variables_number);
+
+    for(size_t k = 0; k < variables_number; k++)
+    {
+        for(size_t j = 0; j < timesteps; j++)
+        {
+            for(size_t i = 0; i < sequences_number; i++)
+            {
+                sequences(i, j, k) = (*this)(i*timesteps+j, k);
+            }
+        }
+    }
+
+    return sequences;
+}
+
+
 /// This method sets new matrix into this tensor at the given positions.
 /// @param index_0 Index of first position.
 /// @param index_1 Index of Second position.
@@ -1456,10 +1544,49 @@ T Tensor<T>::calculate_sum() const
 }
 
 
+/// Divides each slice of this tensor along a given dimension by the corresponding element of a vector.
+/// Slices whose divisor is zero are set to zero.
+/// For instance, dividing the output errors along dimension 0 by the error terms gives the derivatives of the error terms.
+/// @param vector Divisors, one for each index of the dimension.
+/// @param dimension_index Index of the dimension along which the tensor is divided.
+
 template <class T>
-Tensor<T> Tensor<T>::divide(const Vector<T>&, const size_t&) const
+Tensor<T> Tensor<T>::divide(const Vector<T>& vector, const size_t& dimension_index) const
 {
-    return Tensor<double>();
+#ifdef __OPENNN_DEBUG__
+
+    if(dimension_index >= dimensions.size() || vector.size() != dimensions[dimension_index])
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: Tensor template.\n"
+              << "Tensor<T> divide(const Vector<T>&, const size_t&) const.\n"
+              << "Size of vector (" << vector.size() << ") must be equal to the size of dimension " << dimension_index << ".\n";
+
+       throw logic_error(buffer.str());
+    }
+
+#endif
+
+    size_t stride = 1;
+
+    for(size_t i = 0; i < dimension_index; i++)
+    {
+        stride *= dimensions[i];
+    }
+
+    const size_t dimension = dimensions[dimension_index];
+
+    Tensor<T> output(dimensions);
+
+    for(size_t i = 0; i < this->size(); i++)
+    {
+        const T& divisor = vector[(i/stride)%dimension];
+
+        output[i] = divisor == static_cast<T>(0) ? static_cast<T>(0) : (*this)[i]/divisor;
+    }
+
+    return output;
 }
 
 
@@ -21,10 +21,10 @@ TrainingStrategy::TrainingStrategy()
 
     neural_network_pointer = nullptr;
 
-    set_loss_method(NORMALIZED_SQUARED_ERROR);
-
     set_optimization_method(QUASI_NEWTON_METHOD);
 
+    set_loss_method(NORMALIZED_SQUARED_ERROR);
+
     set_default();
 }
 
@@ -980,6 +980,103 @@ void TrainingStrategy::set_display(const bool& new_display)
 }
 
 
+/// Sets the maximum number of epochs of the optimization algorithm in use.
+/// @param new_maximum_epochs_number Maximum number of epochs for training.
+
+void TrainingStrategy::set_maximum_epochs_number(const size_t& new_maximum_epochs_number)
+{
+   switch(optimization_method)
+   {
+      case GRADIENT_DESCENT:
+      {
+           gradient_descent_pointer->set_maximum_epochs_number(new_maximum_epochs_number);
+      }
+      break;
+
+      case CONJUGATE_GRADIENT:
+      {
+           conjugate_gradient_pointer->set_maximum_epochs_number(new_maximum_epochs_number);
+      }
+      break;
+
+      case QUASI_NEWTON_METHOD:
+      {
+           quasi_Newton_method_pointer->set_maximum_epochs_number(new_maximum_epochs_number);
+      }
+      break;
+
+      case LEVENBERG_MARQUARDT_ALGORITHM:
+      {
+           Levenberg_Marquardt_algorithm_pointer->set_maximum_epochs_number(new_maximum_epochs_number);
+      }
+      break;
+
+      case STOCHASTIC_GRADIENT_DESCENT:
+      {
+           stochastic_gradient_descent_pointer->set_maximum_epochs_number(new_maximum_epochs_number);
+      }
+      break;
+
+      case ADAPTIVE_MOMENT_ESTIMATION:
+      {
+           adaptive_moment_estimation_pointer->set_maximum_epochs_number(new_maximum_epochs_number);
+      }
+      break;
+   }
+}
+
+
+/// Sets the loss method and the optimization method of this training strategy, together with their settings,
+/// to those of another training strategy.
+/// The neural network and the data set of this object are kept, so that a copy of a model can be trained
+/// in the same way as the original one, for instance in a different thread.
+/// The normalization coefficients of the loss are also copied, so that the errors of both training strategies are comparable.
+/// @param other_training_strategy Training strategy whose methods are to be copied.
+
+void TrainingStrategy::set_methods(const TrainingStrategy& other_training_strategy)
+{
+   // Loss index
+
+   set_loss_method(other_training_strategy.loss_method);
+
+   LossIndex* loss_index_pointer = get_loss_index_pointer();
+   const LossIndex* other_loss_index_pointer = other_training_strategy.get_loss_index_pointer();
+
+   loss_index_pointer->set_regularization_method(other_loss_index_pointer->get_regularization_method());
+   loss_index_pointer->set_regularization_weight(other_loss_index_pointer->get_regularization_weight());
+
+   if(loss_method == MINKOWSKI_ERROR)
+   {
+       Minkowski_error_pointer->set_Minkowski_parameter(other_training_strategy.Minkowski_error_pointer->get_Minkowski_parameter());
+   }
+   else if(loss_method == NORMALIZED_SQUARED_ERROR)
+   {
+       normalized_squared_error_pointer->set_normalization_coefficient(other_training_strategy.normalized_squared_error_pointer->get_normalization_coefficient());
+       normalized_squared_error_pointer->set_selection_normalization_coefficient(other_training_strategy.normalized_squared_error_pointer->get_selection_normalization_coefficient());
+   }
+   else if(loss_method == WEIGHTED_SQUARED_ERROR)
+   {
+       weighted_squared_error_pointer->set_weights(other_training_strategy.weighted_squared_error_pointer->get_positives_weight(),
+                                                   other_training_strategy.weighted_squared_error_pointer->get_negatives_weight());
+
+       weighted_squared_error_pointer->set_training_normalization_coefficient(other_training_strategy.weighted_squared_error_pointer->get_training_normalization_coefficient());
+       weighted_squared_error_pointer->set_selection_normalization_coefficient(other_training_strategy.weighted_squared_error_pointer->get_selection_normalization_coefficient());
+   }
+
+   // Optimization algorithm
+
+   set_optimization_method(other_training_strategy.optimization_method);
+
+   const tinyxml2::XMLDocument* optimization_algorithm_document = other_training_strategy.get_optimization_algorithm_pointer()->to_XML();
+
+   get_optimization_algorithm_pointer()->from_XML(*optimization_algorithm_document);
+
+   delete optimization_algorithm_document;
+
+   set_display(other_training_strategy.display);
+}
+
+
 /// Sets the members of the training strategy object to their default values:
 /// <ul>
 /// <li> Display: true.
@@ -151,6 +151,10 @@ public:
 
    void set_display(const bool&);
 
+   void set_maximum_epochs_number(const size_t&);
+
+   void set_methods(const TrainingStrategy&);
+
    // Pointer methods
 
    void destruct_optimization_algorithm();
@@ -11,6 +11,97 @@
 namespace OpenNN {
 
 
+/// Applies an affine transformation to some columns of a matrix, in place.
+/// Each element of the column columns_indices[j] is replaced by element*scales[j] + offsets[j].
+/// Every scaling and unscaling method computes its coefficients once per column,
+/// so that the loop over the rows is free of branches and divisions.
+/// @param matrix Matrix with values to be transformed(inputs,targets,...).
+/// @param columns_indices Indices of the columns to be transformed.
+/// @param scales Factor of each column.
+/// @param offsets Term added to each column.
+
+void scale_columns(Matrix<double>& matrix, const Vector<size_t>& columns_indices, const Vector<double>& scales, const Vector<double>& offsets)
+{
+    const size_t rows_number = matrix.get_rows_number();
+
+    const size_t columns_indices_size = columns_indices.size();
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(scales.size() != columns_indices_size || offsets.size() != columns_indices_size)
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: Transformations.\n"
+              << "void scale_columns(Matrix<double>&, const Vector<size_t>&, const Vector<double>&, const Vector<double>&) method.\n"
+              << "Size of scales (" << scales.size() << ") and offsets (" << offsets.size() << ") must be equal to size of columns indices (" << columns_indices_size << ").\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    #pragma omp parallel for
+
+    for(int j = 0; j < static_cast<int>(columns_indices_size); j++)
+    {
+        const double scale = scales[static_cast<size_t>(j)];
+        const double offset = offsets[static_cast<size_t>(j)];
+
+        double* column = matrix.data() + columns_indices[static_cast<size_t>(j)]*rows_number;
+
+        for(size_t i = 0; i < rows_number; i++)
+        {
+            column[i] = column[i]*scale + offset;
+        }
+    }
+}
+
+
+/// Applies an affine transformation to all the columns of a batch, in place.
+/// The columns are the variables of the instances, which are stored in the first dimension of the tensor.
+/// @param tensor Batch with values to be transformed.
+/// @param scales Factor of each column.
+/// @param offsets Term added to each column.
+
+void scale_columns(Tensor<double>& tensor, const Vector<double>& scales, const Vector<double>& offsets)
+{
+    const size_t rows_number = tensor.get_dimension(0);
+
+    const size_t columns_number = scales.size();
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(rows_number*columns_number != tensor.size() || offsets.size() != columns_number)
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: Transformations.\n"
+              << "void scale_columns(Tensor<double>&, const Vector<double>&, const Vector<double>&) method.\n"
+              << "Size of scales (" << columns_number << ") and offsets (" << offsets.size() << ") must be equal to number of columns of tensor.\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    #pragma omp parallel for
+
+    for(int j = 0; j < static_cast<int>(columns_number); j++)
+    {
+        const double scale = scales[static_cast<size_t>(j)];
+        const double offset = offsets[static_cast<size_t>(j)];
+
+        double* column = tensor.data() + static_cast<size_t>(j)*rows_number;
+
+        for(size_t i = 0; i < rows_number; i++)
+        {
+            column[i] = column[i]*scale + offset;
+        }
+    }
+}
+
+
 /// Normalizes the elements of this vector using the minimum and maximum method.
 /// @param vector Vector to be scaled.
 /// @param descriptives Descriptives structure, which contains the minimum and
@@ -318,7 +409,6 @@ void unscale_mean_standard_deviation(Vector<double>& vector,
 
 void scale_mean_standard_deviation(Matrix<double>& matrix, const Vector<Descriptives>& descriptives)
 {
-    const size_t rows_number = matrix.get_rows_number();
     const size_t columns_number = matrix.get_columns_number();
 
    #ifdef __OPENNN_DEBUG__
@@ -340,20 +430,10 @@ void scale_mean_standard_deviation(Matrix<double>& matrix, const Vector<Descript
 
    // Rescale data
 
-   for(size_t j = 0; j < columns_number; j++)
-   {
-      if(descriptives[j].standard_deviation < numeric_limits<double>::min())
-      {
-         // Do nothing
-      }
-      else
-      {
-         for(size_t i = 0; i < rows_number; i++)
-         {
-           matrix(i,j) = (matrix(i,j) - descriptives[j].mean)/descriptives[j].standard_deviation;
-         }
-      }
-   }
+   Vector<size_t> columns_indices(columns_number);
+   columns_indices.initialize_sequential();
+
+   scale_columns_mean_standard_deviation(matrix, descriptives, columns_indices);
 }
 
 
@@ -403,8 +483,6 @@ void unscale_columns_minimum_maximum(Matrix<double>& matrix,
                                      const Vector<Descriptives>& descriptives,
                                      const Vector<size_t>& columns_indices)
 {
-    const size_t rows_number = matrix.get_rows_number();
-
     #ifdef __OPENNN_DEBUG__
 
     const size_t size = descriptives.size();
@@ -426,19 +504,19 @@ void unscale_columns_minimum_maximum(Matrix<double>& matrix,
 
     // Unscale columns
 
+    Vector<double> scales(columns_indices.size(), 1.0);
+    Vector<double> offsets(columns_indices.size(), 0.0);
+
     for(size_t j = 0; j < columns_indices.size(); j++)
     {
-       const size_t column_index = columns_indices[j];
-
        if(descriptives[j].maximum - descriptives[j].minimum > 0.0)
        {
-          for(size_t i = 0; i < rows_number; i++)
-          {
-            matrix(i,column_index) = 0.5*(matrix(i,column_index) + 1.0)*(descriptives[j].maximum-descriptives[j].minimum)
-                                     + descriptives[j].minimum;
-          }
+          scales[j] = 0.5*(descriptives[j].maximum-descriptives[j].minimum);
+          offsets[j] = 0.5*(descriptives[j].maximum-descriptives[j].minimum) + descriptives[j].minimum;
        }
     }
+
+    scale_columns(matrix, columns_indices, scales, offsets);
 }
 
 
@@ -658,8 +736,6 @@ void scale_columns_mean_standard_deviation(Matrix<double>& matrix,
                                            const Vector<Descriptives>& descriptives,
                                            const Vector<size_t>& columns_indices)
 {
-    const size_t rows_number = matrix.get_rows_number();
-
    const size_t columns_indices_size = columns_indices.size();
 
    #ifdef __OPENNN_DEBUG__
@@ -679,26 +755,21 @@ void scale_columns_mean_standard_deviation(Matrix<double>& matrix,
 
    #endif
 
-   size_t column_index;
-
    // Scale columns
 
+   Vector<double> scales(columns_indices_size, 1.0);
+   Vector<double> offsets(columns_indices_size, 0.0);
+
    for(size_t j = 0; j < columns_indices_size; j++)
    {
-      if(descriptives[j].standard_deviation < numeric_limits<double>::min())
-      {
-         // Do nothing
-      }
-      else
+      if(descriptives[j].standard_deviation >= numeric_limits<double>::min())
       {
-         column_index = columns_indices[j];
-
-         for(size_t i = 0; i < rows_number; i++)
-         {
-           matrix(i,column_index) = (matrix(i,column_index) - descriptives[j].mean)/descriptives[j].standard_deviation;
-         }
+         scales[j] = 1.0/descriptives[j].standard_deviation;
+         offsets[j] = -descriptives[j].mean/descriptives[j].standard_deviation;
       }
    }
+
+   scale_columns(matrix, columns_indices, scales, offsets);
 }
 
 
@@ -710,7 +781,6 @@ void scale_columns_mean_standard_deviation(Matrix<double>& matrix,
 
 void scale_minimum_maximum(Matrix<double>& matrix, const Vector<Descriptives>& descriptives)
 {
-    const size_t rows_number = matrix.get_rows_number();
     const size_t columns_number = matrix.get_columns_number();
 
    #ifdef __OPENNN_DEBUG__
@@ -732,20 +802,10 @@ void scale_minimum_maximum(Matrix<double>& matrix, const Vector<Descriptives>& d
 
    // Rescale data
 
-   for(size_t j = 0; j < columns_number; j++)
-   {
-      if(descriptives[j].maximum - descriptives[j].minimum < numeric_limits<double>::min())
-      {
-            // Do nothing
-      }
-      else
-      {
-         for(size_t i = 0; i < rows_number; i++)
-         {
-           matrix(i,j) = 2.0*(matrix(i,j) - descriptives[j].minimum)/(descriptives[j].maximum-descriptives[j].minimum)-1.0;
-         }
-      }
-   }
+   Vector<size_t> columns_indices(columns_number);
+   columns_indices.initialize_sequential();
+
+   scale_columns_minimum_maximum(matrix, descriptives, columns_indices);
 }
 
 
@@ -897,8 +957,6 @@ void scale_columns_minimum_maximum(Matrix<double>& matrix,
                                    const Vector<Descriptives>& descriptives,
                                    const Vector<size_t>& columns_indices)
 {
-    const size_t rows_number = matrix.get_rows_number();
-
     const size_t columns_indices_size = columns_indices.size();
 
     #ifdef __OPENNN_DEBUG__
@@ -918,24 +976,21 @@ void scale_columns_minimum_maximum(Matrix<double>& matrix,
 
     #endif
 
-    size_t column_index;
-
     // Rescale data
 
+    Vector<double> scales(columns_indices_size, 1.0);
+    Vector<double> offsets(columns_indices_size, 0.0);
+
     for(size_t j = 0; j < columns_indices_size; j++)
     {
-       column_index = columns_indices[j];
-
        if(descriptives[j].maximum - descriptives[j].minimum > 0.0)
        {
-
-      for(int i = 0; i < static_cast<int>(rows_number); i++)
-      {
-        matrix(static_cast<size_t>(i),column_index) =
-                2.0*(matrix(static_cast<size_t>(i),column_index) - descriptives[j].minimum)/(descriptives[j].maximum-descriptives[j].minimum) - 1.0;
-      }
+          scales[j] = 2.0/(descriptives[j].maximum-descriptives[j].minimum);
+          offsets[j] = -2.0*descriptives[j].minimum/(descriptives[j].maximum-descriptives[j].minimum) - 1.0;
        }
     }
+
+    scale_columns(matrix, columns_indices, scales, offsets);
 }
 
 
@@ -1063,11 +1118,7 @@ void scale_columns_logarithmic(Matrix<double>& matrix,
                                                 const Vector<Descriptives>& descriptives,
                                                 const Vector<size_t>& columns_indices)
 {
-
     const size_t rows_number = matrix.get_rows_number();
-    const size_t columns_number = matrix.get_columns_number();
-
-    
 
     const size_t columns_indices_size = columns_indices.size();
 
@@ -1088,27 +1139,36 @@ void scale_columns_logarithmic(Matrix<double>& matrix,
 
     #endif
 
-    size_t column_index;
-
     // Rescale data
 
+    Vector<size_t> scaled_columns_indices;
+    Vector<double> scales;
+    Vector<double> offsets;
+
     for(size_t j = 0; j < columns_indices_size; j++)
     {
-       column_index = columns_indices[j];
-
-       if(descriptives[j].maximum - descriptives[j].minimum < numeric_limits<double>::min())
+       if(descriptives[j].maximum - descriptives[j].minimum >= numeric_limits<double>::min())
        {
-          // Do nothing
+          scaled_columns_indices.push_back(columns_indices[j]);
+          scales.push_back(2.0/(descriptives[j].maximum-descriptives[j].minimum));
+          offsets.push_back(1.0 - 2.0*descriptives[j].minimum/(descriptives[j].maximum-descriptives[j].minimum));
        }
-       else
-       {
+    }
 
-#pragma omp parallel for
-          for(int i = 0; i < static_cast<int>(rows_number); i++)
-          {
-            matrix(i,column_index) = log(1.0+ (2.0*(matrix(i,column_index) - descriptives[j].minimum)/(descriptives[j].maximum-descriptives[j].minimum)));
-          }
-       }
+    scale_columns(matrix, scaled_columns_indices, scales, offsets);
+
+    const size_t scaled_columns_number = scaled_columns_indices.size();
+
+    #pragma omp parallel for
+
+    for(int j = 0; j < static_cast<int>(scaled_columns_number); j++)
+    {
+        double* column = matrix.data() + scaled_columns_indices[static_cast<size_t>(j)]*rows_number;
+
+        for(size_t i = 0; i < rows_number; i++)
+        {
+            column[i] = log(column[i]);
+        }
     }
 }
 
@@ -1121,7 +1181,6 @@ void scale_columns_logarithmic(Matrix<double>& matrix,
 
 void unscale_mean_standard_deviation(Matrix<double>& matrix, const Vector<Descriptives>& descriptives)
 {
-    const size_t rows_number = matrix.get_rows_number();
     const size_t columns_number = matrix.get_columns_number();
 
    #ifdef __OPENNN_DEBUG__
@@ -1141,20 +1200,10 @@ void unscale_mean_standard_deviation(Matrix<double>& matrix, const Vector<Descri
 
    #endif
 
-   for(size_t j = 0; j < columns_number; j++)
-   {
-      if(descriptives[j].standard_deviation < numeric_limits<double>::min())
-      {
-         // Do nothing
-      }
-      else
-      {
-         for(size_t i = 0; i < rows_number; i++)
-         {
-           matrix(i,j) = matrix(i,j)*descriptives[j].standard_deviation + descriptives[j].mean;
-         }
-      }
-   }
+   Vector<size_t> columns_indices(columns_number);
+   columns_indices.initialize_sequential();
+
+   unscale_columns_mean_standard_deviation(matrix, descriptives, columns_indices);
 }
 
 
@@ -1216,24 +1265,21 @@ void unscale_columns_mean_standard_deviation(Matrix<double>& matrix, const Vecto
 
     #endif
 
-    const size_t rows_number = matrix.get_rows_number();
-
-   size_t column_index;
-
    // Unscale columns
 
+   Vector<double> scales(columns_indices.size(), 1.0);
+   Vector<double> offsets(columns_indices.size(), 0.0);
+
    for(size_t j = 0;  j < columns_indices.size(); j++)
    {
-      column_index = columns_indices[j];
-
       if(descriptives[j].standard_deviation > numeric_limits<double>::min())
       {
-         for(size_t i = 0; i < rows_number; i++)
-         {
-           matrix(i,column_index) = matrix(i,column_index)*descriptives[j].standard_deviation + descriptives[j].mean;
-         }
+         scales[j] = descriptives[j].standard_deviation;
+         offsets[j] = descriptives[j].mean;
       }
    }
+
+   scale_columns(matrix, columns_indices, scales, offsets);
 }
 
 
@@ -1244,7 +1290,6 @@ void unscale_columns_mean_standard_deviation(Matrix<double>& matrix, const Vecto
 
 void unscale_minimum_maximum(Matrix<double>& matrix, const Vector<Descriptives>& descriptives)
 {
-    const size_t rows_number = matrix.get_rows_number();
     const size_t columns_number = matrix.get_columns_number();
 
    #ifdef __OPENNN_DEBUG__
@@ -1272,17 +1317,13 @@ void unscale_minimum_maximum(Matrix<double>& matrix, const Vector<Descriptives>&
                    << "void unscale_minimum_maximum(const Vector<Descriptives>&) const method.\n"
                    << "Minimum and maximum values of column " << j << " are equal.\n"
                    << "Those columns won't be unscaled.\n";
-
-         // Do nothing
-      }
-      else
-      {
-         for(size_t i = 0; i < rows_number; i++)
-         {
-           matrix(i,j) = 0.5*(matrix(i,j) + 1.0)*(descriptives[j].maximum-descriptives[j].minimum) + descriptives[j].minimum;
-         }
       }
    }
+
+   Vector<size_t> columns_indices(columns_number);
+   columns_indices.initialize_sequential();
+
+   unscale_columns_minimum_maximum(matrix, descriptives, columns_indices);
 }
 
 
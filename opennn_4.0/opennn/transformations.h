@@ -24,6 +24,12 @@ using namespace std;
 
 namespace OpenNN
 {
+   // Affine scaling
+
+     void scale_columns(Matrix<double>&, const Vector<size_t>&, const Vector<double>&, const Vector<double>&);
+
+     void scale_columns(Tensor<double>&, const Vector<double>&, const Vector<double>&);
+
    /// Scaling methods
 
     // Minimum-maximum vector scaling
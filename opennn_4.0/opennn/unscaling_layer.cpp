@@ -48,6 +48,8 @@ UnscalingLayer::UnscalingLayer(const tinyxml2::XMLDocument& unscaling_layer_docu
 UnscalingLayer::UnscalingLayer(const UnscalingLayer& other_unscaling_layer) : Layer()
 {
     set(other_unscaling_layer);
+
+    layer_type = Unscaling;
 }
 
 
@@ -576,11 +578,24 @@ bool UnscalingLayer::is_empty() const
 
 Tensor<double> UnscalingLayer::calculate_outputs(const Tensor<double>& inputs)
 {    
+    Tensor<double> outputs(inputs);
 
-#ifdef __OPENNN_DEBUG__
+    unscale(outputs);
+
+    return outputs;
+}  
 
+
+/// Unscales a batch of inputs in place.
+/// The scale and offset of each neuron are computed once, so that every input is transformed with a single multiply-add.
+/// @param inputs Batch of inputs to the unscaling layer, with the instances in the first dimension.
+
+void UnscalingLayer::unscale(Tensor<double>& inputs) const
+{
     const size_t neurons_number = get_neurons_number();
 
+#ifdef __OPENNN_DEBUG__
+
     const size_t columns_number = inputs.get_dimension(1);
 
     if(columns_number != neurons_number)
@@ -588,7 +603,7 @@ Tensor<double> UnscalingLayer::calculate_outputs(const Tensor<double>& inputs)
         ostringstream buffer;
 
         buffer << "OpenNN Exception: UnscalingLayer class.\n"
-               << "Tensor<double> calculate_outputs(const Tensor<double>&) const method.\n"
+               << "void unscale(Tensor<double>&) const method.\n"
                << "Size must be equal to number of unscaling neurons.\n";
 
         throw logic_error(buffer.str());
@@ -596,33 +611,39 @@ Tensor<double> UnscalingLayer::calculate_outputs(const Tensor<double>& inputs)
 
 #endif
 
-    // Unscale
+    if(unscaling_method == NoUnscaling) return;
 
-    switch(unscaling_method)
+    if(display)
     {
-        case MinimumMaximum:
+        for(size_t j = 0; j < neurons_number; j++)
         {
-            return(calculate_minimum_maximum_outputs(inputs));
+            if((unscaling_method == MeanStandardDeviation && descriptives[j].standard_deviation < numeric_limits<double>::min())
+            || (unscaling_method != MeanStandardDeviation && descriptives[j].maximum - descriptives[j].minimum < numeric_limits<double>::min()))
+            {
+                cout << "OpenNN Warning: UnscalingLayer class.\n"
+                     << "void unscale(Tensor<double>&) const method.\n"
+                     << "Range of output variable " << j << " is zero.\n"
+                     << "Those outputs won't be unscaled.\n";
+            }
         }
+    }
 
-        case MeanStandardDeviation:
-        {
-            return(calculate_mean_standard_deviation_outputs(inputs));
-        }
+    if(unscaling_method == Logarithmic)
+    {
+        double* data = inputs.data();
 
-        case Logarithmic:
-        {
-            return(calculate_logarithmic_outputs(inputs));
-        }
+        const size_t size = inputs.size();
 
-        case NoUnscaling:
+        #pragma omp parallel for
+
+        for(int i = 0; i < static_cast<int>(size); i++)
         {
-            return inputs;
+            data[i] = exp(data[i]);
         }
     }
 
-    return Tensor<double>();
-}  
+    scale_columns(inputs, calculate_scales(), calculate_offsets());
+}
 
 
 /// Calculates the outputs from the unscaling layer with the minimum and maximum method for a set of inputs.
@@ -690,7 +711,7 @@ Tensor<double> UnscalingLayer::calculate_mean_standard_deviation_outputs(const T
         }
         else
         {
-            outputs(i,j) = inputs[j]*descriptives[j].standard_deviation + descriptives[j].mean;
+            outputs(i,j) = inputs(i,j)*descriptives[j].standard_deviation + descriptives[j].mean;
         }
     }
     }
@@ -737,6 +758,103 @@ Tensor<double> UnscalingLayer::calculate_logarithmic_outputs(const Tensor<double
 }
 
 
+/// Returns true if the unscaling method is an affine transformation of the inputs, and false otherwise.
+/// Only the logarithmic method is not affine.
+
+bool UnscalingLayer::is_affine() const
+{
+    return unscaling_method != Logarithmic;
+}
+
+
+/// Returns the factors by which the unscaling layer multiplies each input.
+/// Each output is then input*scale + offset, or exp(input)*scale + offset for the logarithmic method.
+/// Outputs whose range or standard deviation is zero are set to zero.
+
+Vector<double> UnscalingLayer::calculate_scales() const
+{
+    const size_t neurons_number = get_neurons_number();
+
+    Vector<double> scales(neurons_number, 1.0);
+
+    for(size_t i = 0; i < neurons_number; i++)
+    {
+        if(unscaling_method == MinimumMaximum)
+        {
+            if(descriptives[i].maximum - descriptives[i].minimum < numeric_limits<double>::min())
+            {
+                scales[i] = 0.0;
+            }
+            else
+            {
+                scales[i] = 0.5*(descriptives[i].maximum-descriptives[i].minimum);
+            }
+        }
+        else if(unscaling_method == MeanStandardDeviation)
+        {
+            if(descriptives[i].standard_deviation < numeric_limits<double>::min())
+            {
+                scales[i] = 0.0;
+            }
+            else
+            {
+                scales[i] = descriptives[i].standard_deviation;
+            }
+        }
+        else if(unscaling_method == Logarithmic)
+        {
+            if(descriptives[i].maximum - descriptives[i].minimum < numeric_limits<double>::min())
+            {
+                scales[i] = 0.0;
+            }
+            else
+            {
+                scales[i] = 0.5*(descriptives[i].maximum-descriptives[i].minimum)*exp(-1.0);
+            }
+        }
+    }
+
+    return scales;
+}
+
+
+/// Returns the terms which the unscaling layer adds to each input after multiplying it by its scale.
+
+Vector<double> UnscalingLayer::calculate_offsets() const
+{
+    const size_t neurons_number = get_neurons_number();
+
+    Vector<double> offsets(neurons_number, 0.0);
+
+    for(size_t i = 0; i < neurons_number; i++)
+    {
+        if(unscaling_method == MinimumMaximum)
+        {
+            if(descriptives[i].maximum - descriptives[i].minimum >= numeric_limits<double>::min())
+            {
+                offsets[i] = 0.5*(descriptives[i].maximum-descriptives[i].minimum) + descriptives[i].minimum;
+            }
+        }
+        else if(unscaling_method == MeanStandardDeviation)
+        {
+            if(descriptives[i].standard_deviation >= numeric_limits<double>::min())
+            {
+                offsets[i] = descriptives[i].mean;
+            }
+        }
+        else if(unscaling_method == Logarithmic)
+        {
+            if(descriptives[i].maximum - descriptives[i].minimum >= numeric_limits<double>::min())
+            {
+                offsets[i] = descriptives[i].minimum;
+            }
+        }
+    }
+
+    return offsets;
+}
+
+
 /// Returns a string representation of the current unscaling layer object. 
 
 string UnscalingLayer::object_to_string() const
@@ -24,6 +24,7 @@
 #include "matrix.h"
 #include "layer.h"
 #include "statistics.h"
+#include "transformations.h"
 
 
 
@@ -133,12 +134,19 @@ public:
   
    Tensor<double> calculate_outputs(const Tensor<double>&);
 
+   void unscale(Tensor<double>&) const;
+
    Tensor<double> calculate_minimum_maximum_outputs(const Tensor<double>&) const;
 
    Tensor<double> calculate_mean_standard_deviation_outputs(const Tensor<double>&) const;
 
    Tensor<double> calculate_logarithmic_outputs(const Tensor<double>&) const;
 
+   bool is_affine() const;
+
+   Vector<double> calculate_scales() const;
+   Vector<double> calculate_offsets() const;
+
    void check_range(const Vector<double>&) const;
 
    // Serialization methods
@@ -32,6 +32,10 @@
 #include <ctime>
 #include <time.h>
 
+// OpenNN includes
+
+#include "random.h"
+
 using namespace std;
 
 namespace OpenNN {
@@ -1026,7 +1030,7 @@ void Vector<T>::randomize_binary(const double& negatives_ratio, const double& po
     const size_t negatives_number = this_size - positives_number;
 
     Vector<size_t> indices(0, 1, this_size-1);
-    random_shuffle(indices.begin(), indices.end());
+    shuffle(indices.begin(), indices.end(), get_random_generator());
 
     size_t i = 0;
     size_t index;
@@ -3339,7 +3343,7 @@ Vector<T> Vector<T>::get_subvector_random(const size_t& new_size) const
 
     Vector<T> new_vector(*this);
 
-    random_shuffle(new_vector.begin(), new_vector.end());
+    shuffle(new_vector.begin(), new_vector.end(), get_random_generator());
 
     return new_vector.get_first(new_size);
 }
@@ -4910,15 +4914,16 @@ ostream &operator<<(ostream &os, const Vector< Matrix<T> >&v)
 
 
 /// Returns a random number chosen from a uniform distribution.
+/// It is drawn from the random generator of the current thread.
 /// @param minimum Minimum value.
 /// @param maximum Maximum value.
 
 template <class T>
 T calculate_random_uniform(const T&minimum, const T&maximum)
 {
-  const T random = static_cast<T>(rand() /(RAND_MAX + 1.0));
+  const double random = get_random_generator().calculate_uniform();
 
-  const T random_uniform = minimum + (maximum - minimum) * random;
+  const T random_uniform = static_cast<T>(minimum + (maximum - minimum) * random);
 
   return(random_uniform);
 }
@@ -4938,33 +4943,14 @@ string number_to_string(const T& value)
 
 
 /// Returns a random number chosen from a normal distribution.
+/// It is drawn from the random generator of the current thread.
 /// @param mean Mean value of normal distribution.
 /// @param standard_deviation Standard deviation value of normal distribution.
 
 template <class T>
 T calculate_random_normal(const T& mean, const T& standard_deviation)
 {
-  const double pi = 4.0 * atan(1.0);
-
-  T random_uniform_1;
-
-  do
-  {
-    random_uniform_1 = static_cast<T>(rand()) /(RAND_MAX + 1.0);
-
-  }
-  while(random_uniform_1 == 0.0);
-
-  const T random_uniform_2 = static_cast<T>(rand()) /(RAND_MAX + 1.0);
-
-  // Box-Muller transformation
-
-  const T random_normal = mean +
-                          sqrt(-2.0 * log(random_uniform_1)) *
-                              sin(2.0 * pi * random_uniform_2) *
-                              standard_deviation;
-
-  return(random_normal);
+  return static_cast<T>(get_random_generator().calculate_normal(mean, standard_deviation));
 }
 
 
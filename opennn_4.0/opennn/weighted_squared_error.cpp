@@ -123,6 +123,14 @@ double WeightedSquaredError::get_training_normalization_coefficient() const
 }
 
 
+/// Returns the normalization coefficient of the selection instances.
+
+double WeightedSquaredError::get_selection_normalization_coefficient() const
+{
+    return(selection_normalization_coefficient);
+}
+
+
 /// Set the default values for the object.
 
 void WeightedSquaredError::set_default()
@@ -173,6 +181,15 @@ void WeightedSquaredError::set_training_normalization_coefficient(const double&
 }
 
 
+/// Set a new normalization coefficient for the selection instances.
+/// @param new_selection_normalization_coefficient New normalization coefficient.
+
+void WeightedSquaredError::set_selection_normalization_coefficient(const double& new_selection_normalization_coefficient)
+{
+    selection_normalization_coefficient = new_selection_normalization_coefficient;
+}
+
+
 /// Set new weights for the positives and negatives values.
 /// @param new_positives_weight New weight for the positives.
 /// @param new_negatives_weight New weight for the negatives.
@@ -324,13 +341,11 @@ check();
 
     const size_t parameters_number = neural_network_pointer->get_parameters_number();
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
 
     const size_t batches_number = training_batches.size();
@@ -382,13 +397,11 @@ check();
 
     const size_t parameters_number = neural_network_pointer->get_parameters_number();
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
     const size_t batches_number = training_batches.size();
 
@@ -566,68 +579,95 @@ check();
 
     const size_t parameters_number = neural_network_pointer->get_parameters_number();
 
-     bool is_forecasting = false;
-
-    if(neural_network_pointer->has_long_short_term_memory_layer() || neural_network_pointer->has_recurrent_layer()) is_forecasting = true;
+    const size_t timesteps = neural_network_pointer->get_timesteps();
 
     // Data set
 
-    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(!is_forecasting);
+    const Vector<Vector<size_t>> training_batches = data_set_pointer->get_training_batches(true, timesteps);
 
     const size_t batches_number = training_batches.size();
 
     SecondOrderLoss terms_second_order_loss(parameters_number);
 
-     #pragma omp parallel for
-
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Tensor<double> inputs = data_set_pointer->get_input_data(training_batches[static_cast<unsigned>(i)]);
-        const Tensor<double> targets = data_set_pointer->get_target_data(training_batches[static_cast<unsigned>(i)]);
+        SecondOrderLoss thread_second_order_loss(parameters_number);
 
-        const Vector<Layer::FirstOrderActivations> forward_propagation = neural_network_pointer->calculate_trainable_forward_propagation(inputs);
+        #pragma omp for
 
-        const Vector<double> error_terms
-                = calculate_training_error_terms(forward_propagation[layers_number-1].activations, targets);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Tensor<double> inputs = data_set_pointer->get_input_data(training_batches[static_cast<unsigned>(i)]);
+            const Tensor<double> targets = data_set_pointer->get_target_data(training_batches[static_cast<unsigned>(i)]);
 
-        const Tensor<double> output_gradient = (forward_propagation[layers_number-1].activations - targets).divide(error_terms, 0);
+            const Vector<Layer::FirstOrderActivations> forward_propagation = neural_network_pointer->calculate_trainable_forward_propagation(inputs);
 
-        const Vector<Tensor<double>> layers_delta = calculate_layers_delta(forward_propagation, output_gradient);
+            const Vector<double> error_terms
+                    = calculate_training_error_terms(forward_propagation[layers_number-1].activations, targets);
 
-        const Matrix<double> error_terms_Jacobian = calculate_error_terms_Jacobian(inputs, forward_propagation, layers_delta);
+            const Tensor<double> output_gradient = (forward_propagation[layers_number-1].activations - targets).divide(error_terms, 0);
 
-        const Matrix<double> error_terms_Jacobian_transpose = error_terms_Jacobian.calculate_transpose();
+            const Vector<Tensor<double>> layers_delta = calculate_layers_delta(forward_propagation, output_gradient);
 
-        const double loss = dot(error_terms, error_terms);
+            const Matrix<double> error_terms_Jacobian = calculate_error_terms_Jacobian(inputs, forward_propagation, layers_delta);
 
-        const Vector<double> gradient = dot(error_terms_Jacobian_transpose, error_terms);
+            thread_second_order_loss.loss += dot(error_terms, error_terms);
+            thread_second_order_loss.gradient += dot(error_terms, error_terms_Jacobian);
 
-        Matrix<double> hessian_approximation;
-        //hessian_approximation.dot(error_terms_Jacobian_transpose, error_terms_Jacobian);
+            symmetric_rank_k_update(thread_second_order_loss.hessian, error_terms_Jacobian);
+        }
 
-          #pragma omp critical
+        #pragma omp critical
         {
-            terms_second_order_loss.loss += loss;
-            terms_second_order_loss.gradient += gradient;
-            terms_second_order_loss.hessian += hessian_approximation;
+            terms_second_order_loss.loss += thread_second_order_loss.loss;
+            terms_second_order_loss.gradient += thread_second_order_loss.gradient;
+            terms_second_order_loss.hessian += thread_second_order_loss.hessian;
         }
     }
 
+    fill_upper_triangle(terms_second_order_loss.hessian);
+
     terms_second_order_loss.loss /= training_normalization_coefficient;
     terms_second_order_loss.gradient *= (2.0/training_normalization_coefficient);
     terms_second_order_loss.hessian *= (2.0/training_normalization_coefficient);
 
     if(regularization_method != RegularizationMethod::NoRegularization)
     {
-        terms_second_order_loss.loss += calculate_regularization();
-        terms_second_order_loss.gradient += calculate_regularization_gradient();
-        terms_second_order_loss.hessian += calculate_regularization_hessian();
+        terms_second_order_loss.loss += regularization_weight*calculate_regularization();
+        terms_second_order_loss.gradient += calculate_regularization_gradient()*regularization_weight;
+        terms_second_order_loss.hessian += calculate_regularization_hessian()*regularization_weight;
     }
 
     return terms_second_order_loss;
 }
 
 
+/// Returns the product of the Gauss-Newton approximation of the Hessian by a vector.
+/// It is the product computed by calculate_terms_second_order_loss, but the Hessian is not formed.
+/// @param direction Vector to be multiplied by the Hessian approximation.
+
+Vector<double> WeightedSquaredError::calculate_terms_hessian_product(const Vector<double>& direction) const
+{
+    Vector<double> hessian_product = calculate_error_terms_Jacobian_product(direction)*(2.0/training_normalization_coefficient);
+
+    if(regularization_method != RegularizationMethod::NoRegularization)
+    {
+        hessian_product += calculate_regularization_hessian_product(direction)*regularization_weight;
+    }
+
+    return hessian_product;
+}
+
+
+/// Returns the diagonal of the Gauss-Newton approximation of the Hessian, without the regularization term.
+/// It is used to precondition matrix-free second order methods.
+
+Vector<double> WeightedSquaredError::calculate_terms_hessian_diagonal() const
+{
+    return calculate_error_terms_Jacobian_squared_norms()*(2.0/training_normalization_coefficient);
+}
+
+
 /// Returns a string with the name of the weighted squared error loss type, "WEIGHTED_SQUARED_ERROR".
 
 string WeightedSquaredError::get_error_type() const
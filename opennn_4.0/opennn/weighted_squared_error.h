@@ -117,6 +117,9 @@ public:
 
    LossIndex::SecondOrderLoss calculate_terms_second_order_loss() const;
 
+   Vector<double> calculate_terms_hessian_product(const Vector<double>&) const;
+   Vector<double> calculate_terms_hessian_diagonal() const;
+
    string get_error_type() const;
    string get_error_type_text() const;
 
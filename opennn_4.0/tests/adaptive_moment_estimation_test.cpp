@@ -0,0 +1,381 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   A D A P T I V E   M O M E N T   E S T I M A T I O N   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "adaptive_moment_estimation_test.h"
+
+
+AdaptiveMomentEstimationTest::AdaptiveMomentEstimationTest() : UnitTesting()
+{
+}
+
+
+AdaptiveMomentEstimationTest::~AdaptiveMomentEstimationTest()
+{
+}
+
+
+void AdaptiveMomentEstimationTest::test_constructor()
+{
+   cout << "test_constructor\n";
+
+   SumSquaredError sum_squared_error;
+
+   // Default constructor
+
+   AdaptiveMomentEstimation adam1;
+   assert_true(adam1.has_loss_index() == false, LOG);
+
+   // Loss index constructor
+
+   AdaptiveMomentEstimation adam2(&sum_squared_error);
+   assert_true(adam2.has_loss_index() == true, LOG);
+   assert_true(adam2.get_update_method() == AdaptiveMomentEstimation::Adam, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::test_destructor()
+{
+   cout << "test_destructor\n";
+}
+
+
+void AdaptiveMomentEstimationTest::test_set_update_method()
+{
+   cout << "test_set_update_method\n";
+
+   AdaptiveMomentEstimation adam;
+
+   const Vector<string> update_methods({"Adam", "AdamW", "AMSGrad", "RMSProp", "Adagrad", "LAMB"});
+
+   for(size_t i = 0; i < update_methods.size(); i++)
+   {
+      adam.set_update_method(update_methods[i]);
+
+      assert_true(adam.write_update_method() == update_methods[i], LOG);
+   }
+
+   adam.set_update_method(AdaptiveMomentEstimation::RMSProp);
+
+   assert_true(adam.get_update_method() == AdaptiveMomentEstimation::RMSProp, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::test_update_parameters()
+{
+   cout << "test_update_parameters\n";
+
+   AdaptiveMomentEstimation adam;
+
+   const double initial_learning_rate = adam.get_initial_learning_rate();
+   const double beta_1 = adam.get_beta_1();
+   const double beta_2 = adam.get_beta_2();
+   const double epsilon = adam.get_epsilon();
+   const double weight_decay = adam.get_weight_decay();
+
+   const Vector<double> initial_parameters({1.0, -0.5, 2.0});
+   const Vector<double> gradient({0.5, -1.0, 0.25});
+   const Vector<double> second_gradient(3, 0.0);
+
+   AdaptiveMomentEstimation::OptimizationData optimization_data;
+
+   Vector<double> parameters;
+   Vector<double> gradient_exponential_decay;
+   Vector<double> square_gradient_exponential_decay;
+   Vector<double> expected_parameters;
+
+   double learning_rate;
+
+   // Adam
+
+   adam.set_update_method(AdaptiveMomentEstimation::Adam);
+
+   optimization_data.set_parameters_number(3);
+   parameters = initial_parameters;
+
+   adam.update_parameters(gradient, optimization_data, parameters);
+
+   gradient_exponential_decay = gradient*(1.0 - beta_1);
+   square_gradient_exponential_decay = gradient*gradient*(1.0 - beta_2);
+
+   learning_rate = initial_learning_rate*sqrt(1.0 - beta_2)/(1.0 - beta_1);
+
+   expected_parameters = initial_parameters - gradient_exponential_decay*learning_rate/(square_root(square_gradient_exponential_decay) + epsilon);
+
+   assert_true(optimization_data.iteration == 1, LOG);
+   assert_true(abs(optimization_data.learning_rate - learning_rate) < 1.0e-12, LOG);
+   assert_true(absolute_value(optimization_data.gradient_exponential_decay - gradient_exponential_decay) < 1.0e-12, LOG);
+   assert_true(absolute_value(parameters - expected_parameters) < 1.0e-12, LOG);
+
+   // AdamW
+
+   adam.set_update_method(AdaptiveMomentEstimation::AdamW);
+
+   optimization_data.set_parameters_number(3);
+   parameters = initial_parameters;
+
+   adam.update_parameters(gradient, optimization_data, parameters);
+
+   expected_parameters -= initial_parameters*initial_learning_rate*weight_decay;
+
+   assert_true(absolute_value(parameters - expected_parameters) < 1.0e-12, LOG);
+
+   // AMSGrad
+
+   adam.set_update_method(AdaptiveMomentEstimation::AMSGrad);
+
+   optimization_data.set_parameters_number(3);
+   parameters = initial_parameters;
+
+   adam.update_parameters(gradient, optimization_data, parameters);
+
+   const Vector<double> maximum_square_gradient_exponential_decay = optimization_data.square_gradient_exponential_decay;
+
+   adam.update_parameters(second_gradient, optimization_data, parameters);
+
+   assert_true(maximum_square_gradient_exponential_decay - optimization_data.square_gradient_exponential_decay > 0.0, LOG);
+   assert_true(absolute_value(optimization_data.maximum_square_gradient_exponential_decay - maximum_square_gradient_exponential_decay) < 1.0e-12, LOG);
+
+   // RMSProp
+
+   adam.set_update_method(AdaptiveMomentEstimation::RMSProp);
+
+   optimization_data.set_parameters_number(3);
+   parameters = initial_parameters;
+
+   adam.update_parameters(gradient, optimization_data, parameters);
+
+   square_gradient_exponential_decay = gradient*gradient*(1.0 - beta_2);
+
+   expected_parameters = initial_parameters - gradient*initial_learning_rate/(square_root(square_gradient_exponential_decay) + epsilon);
+
+   assert_true(absolute_value(parameters - expected_parameters) < 1.0e-12, LOG);
+
+   // Adagrad
+
+   adam.set_update_method(AdaptiveMomentEstimation::Adagrad);
+
+   optimization_data.set_parameters_number(3);
+   parameters = initial_parameters;
+
+   adam.update_parameters(gradient, optimization_data, parameters);
+   adam.update_parameters(gradient, optimization_data, parameters);
+
+   assert_true(absolute_value(optimization_data.square_gradient_exponential_decay - gradient*gradient*2.0) < 1.0e-12, LOG);
+
+   // LAMB
+
+   adam.set_update_method(AdaptiveMomentEstimation::LAMB);
+
+   optimization_data.set_parameters_number(3);
+   parameters = initial_parameters;
+
+   adam.update_parameters(gradient, optimization_data, parameters);
+
+   assert_true(abs(l2_norm(parameters - initial_parameters) - initial_learning_rate*l2_norm(initial_parameters)) < 1.0e-12, LOG);
+
+   optimization_data.set_parameters_number(3);
+   optimization_data.layers_parameters_numbers = Vector<size_t>({1, 2});
+   parameters = initial_parameters;
+
+   adam.update_parameters(gradient, optimization_data, parameters);
+
+   assert_true(abs(abs(parameters[0] - initial_parameters[0]) - initial_learning_rate*abs(initial_parameters[0])) < 1.0e-12, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::test_perform_training()
+{
+   cout << "test_perform_training\n";
+
+   DataSet data_set(20, 1, 1);
+   data_set.randomize_data_normal();
+
+   NeuralNetwork neural_network(NeuralNetwork::Approximation, {1, 2, 1});
+
+   SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+   AdaptiveMomentEstimation adam(&sum_squared_error);
+   adam.set_display(false);
+   adam.set_maximum_epochs_number(10);
+   adam.set_initial_learning_rate(0.01);
+
+   const Vector<string> update_methods({"Adam", "AdamW", "AMSGrad", "RMSProp", "Adagrad", "LAMB"});
+
+   double old_loss;
+   double loss;
+
+   // Test
+
+   for(size_t i = 0; i < update_methods.size(); i++)
+   {
+      neural_network.initialize_parameters(1.0);
+
+      old_loss = sum_squared_error.calculate_training_loss();
+
+      adam.set_update_method(update_methods[i]);
+
+      adam.perform_training();
+
+      loss = sum_squared_error.calculate_training_loss();
+
+      assert_true(loss < old_loss, LOG);
+   }
+}
+
+
+void AdaptiveMomentEstimationTest::test_perform_training_asynchronous_selection_error()
+{
+   cout << "test_perform_training_asynchronous_selection_error\n";
+
+   DataSet data_set(20, 1, 1);
+   data_set.randomize_data_normal();
+   data_set.split_instances_sequential(0.5, 0.5, 0.0);
+
+   NeuralNetwork neural_network(NeuralNetwork::Approximation, {1, 2, 1});
+
+   SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+   AdaptiveMomentEstimation adam(&sum_squared_error);
+   adam.set_display(false);
+   adam.set_maximum_epochs_number(10);
+   adam.set_reserve_selection_error_history(true);
+
+   OptimizationAlgorithm::Results results;
+
+   // Test
+
+   neural_network.initialize_parameters(1.0);
+
+   adam.set_asynchronous_selection_error(true);
+
+   results = adam.perform_training();
+
+   assert_true(abs(results.final_selection_error - sum_squared_error.calculate_selection_error()) < 1.0e-12, LOG);
+
+   // Test
+
+   neural_network.initialize_parameters(1.0);
+
+   adam.set_selection_error_period(3);
+   adam.set_selection_instances_fraction(0.5);
+
+   results = adam.perform_training();
+
+   assert_true(results.final_selection_error > 0.0, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::test_to_XML()
+{
+   cout << "test_to_XML\n";
+
+   AdaptiveMomentEstimation adam;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   document = adam.to_XML();
+   assert_true(document != nullptr, LOG);
+
+   delete document;
+}
+
+
+void AdaptiveMomentEstimationTest::test_from_XML()
+{
+   cout << "test_from_XML\n";
+
+   AdaptiveMomentEstimation adam1;
+   AdaptiveMomentEstimation adam2;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   adam1.set_update_method(AdaptiveMomentEstimation::LAMB);
+   adam1.set_weight_decay(0.1);
+   adam1.set_initial_learning_rate(0.02);
+   adam1.get_learning_rate_schedule_pointer()->set_schedule_method(LearningRateSchedule::CosineAnnealing);
+   adam1.set_asynchronous_selection_error(true);
+   adam1.set_selection_error_period(5);
+   adam1.set_selection_instances_fraction(0.25);
+
+   document = adam1.to_XML();
+
+   adam2.from_XML(*document);
+
+   delete document;
+
+   assert_true(adam2.get_update_method() == AdaptiveMomentEstimation::LAMB, LOG);
+   assert_true(abs(adam2.get_weight_decay() - 0.1) < 1.0e-12, LOG);
+   assert_true(abs(adam2.get_initial_learning_rate() - 0.02) < 1.0e-12, LOG);
+   assert_true(adam2.get_learning_rate_schedule().get_schedule_method() == LearningRateSchedule::CosineAnnealing, LOG);
+   assert_true(adam2.get_asynchronous_selection_error(), LOG);
+   assert_true(adam2.get_selection_error_period() == 5, LOG);
+   assert_true(abs(adam2.get_selection_instances_fraction() - 0.25) < 1.0e-12, LOG);
+
+   // Test
+
+   document = adam1.to_XML();
+
+   document->FirstChildElement("AdaptiveMomentEstimation")->FirstChildElement("SelectionErrorPeriod")->SetText("0");
+
+   adam2.from_XML(*document);
+
+   delete document;
+
+   assert_true(adam2.get_selection_error_period() == 1, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::run_test_case()
+{
+   cout << "Running adaptive moment estimation test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Set methods
+
+   test_set_update_method();
+
+   // Training methods
+
+   test_update_parameters();
+
+   test_perform_training();
+   test_perform_training_asynchronous_selection_error();
+
+   // Serialization methods
+
+   test_to_XML();
+   test_from_XML();
+
+   cout << "End of adaptive moment estimation test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,264 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   C H E C K P O I N T   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "checkpoint_test.h"
+
+
+CheckpointTest::CheckpointTest() : UnitTesting()
+{
+}
+
+
+CheckpointTest::~CheckpointTest()
+{
+}
+
+
+void CheckpointTest::test_constructor()
+{
+   cout << "test_constructor\n";
+
+   Checkpoint checkpoint;
+
+   assert_true(!checkpoint.contains("Epoch"), LOG);
+   assert_true(checkpoint.get_evaluation_cache().get_evaluations_number() == 0, LOG);
+}
+
+
+void CheckpointTest::test_destructor()
+{
+   cout << "test_destructor\n";
+}
+
+
+void CheckpointTest::test_set_vector()
+{
+   cout << "test_set_vector\n";
+
+   Checkpoint checkpoint;
+
+   Vector<bool> bool_vector(5, false);
+
+   bool_vector[3] = true;
+
+   // Test
+
+   checkpoint.set_vector("Parameters", Vector<double>(3, 1.5));
+
+   assert_true(checkpoint.contains("Parameters"), LOG);
+   assert_true(checkpoint.get_vector("Parameters") == Vector<double>(3, 1.5), LOG);
+
+   // Test
+
+   checkpoint.set_double("Error", 0.25);
+   checkpoint.set_size_t("Epoch", 7);
+
+   assert_true(checkpoint.get_double("Error") == 0.25, LOG);
+   assert_true(checkpoint.get_size_t("Epoch") == 7, LOG);
+
+   // Test
+
+   checkpoint.set_indices("Indices", Vector<size_t>(0, 2, 8));
+   checkpoint.set_bool_vector("Inputs", bool_vector);
+
+   assert_true(checkpoint.get_indices("Indices") == Vector<size_t>(0, 2, 8), LOG);
+   assert_true(checkpoint.get_bool_vector("Inputs") == bool_vector, LOG);
+}
+
+
+void CheckpointTest::test_set_vectors()
+{
+   cout << "test_set_vectors\n";
+
+   Checkpoint checkpoint;
+
+   Vector<Vector<double>> vectors(3);
+
+   Vector<Vector<bool>> bool_vectors(2, Vector<bool>(4, true));
+
+   // Test
+
+   vectors[0].set(2, 1.0);
+   vectors[2].set(3, -2.0);
+
+   bool_vectors[1][0] = false;
+
+   checkpoint.set_vectors("Parameters", vectors);
+   checkpoint.set_bool_vectors("Population", bool_vectors);
+
+   assert_true(checkpoint.get_vectors("Parameters").size() == 3, LOG);
+   assert_true(checkpoint.get_vectors("Parameters")[0] == vectors[0], LOG);
+   assert_true(checkpoint.get_vectors("Parameters")[1].empty(), LOG);
+   assert_true(checkpoint.get_vectors("Parameters")[2] == vectors[2], LOG);
+   assert_true(checkpoint.get_bool_vectors("Population") == bool_vectors, LOG);
+
+   // Test
+
+   checkpoint.set_vectors("Parameters", Vector<Vector<double>>());
+
+   assert_true(checkpoint.get_vectors("Parameters").empty(), LOG);
+}
+
+
+void CheckpointTest::test_set_generator()
+{
+   cout << "test_set_generator\n";
+
+   Checkpoint checkpoint;
+
+   RandomGenerator generator(0xFFFFFFFFFFFFFFFF, 3);
+
+   // Test
+
+   generator();
+   generator();
+   generator();
+
+   checkpoint.set_generator("RandomGenerator", generator);
+
+   RandomGenerator loaded_generator = checkpoint.get_generator("RandomGenerator");
+
+   assert_true(loaded_generator.get_seed() == generator.get_seed(), LOG);
+   assert_true(loaded_generator.get_stream() == 3, LOG);
+   assert_true(loaded_generator.get_counter() == 3, LOG);
+   assert_true(loaded_generator() == generator(), LOG);
+}
+
+
+void CheckpointTest::test_clear()
+{
+   cout << "test_clear\n";
+
+   Checkpoint checkpoint;
+
+   EvaluationCache evaluation_cache;
+
+   evaluation_cache.insert(static_cast<size_t>(2), EvaluationCache::Evaluation(1.0, 2.0, Vector<double>(3, 0.5)));
+
+   // Test
+
+   checkpoint.set_size_t("Epoch", 1);
+   checkpoint.set_evaluation_cache(evaluation_cache);
+
+   checkpoint.clear();
+
+   assert_true(!checkpoint.contains("Epoch"), LOG);
+   assert_true(checkpoint.get_evaluation_cache().get_evaluations_number() == 0, LOG);
+}
+
+
+void CheckpointTest::test_save()
+{
+   cout << "test_save\n";
+
+   const string file_name = "../data/checkpoint.dat";
+
+   Checkpoint checkpoint;
+
+   // Test
+
+   checkpoint.save(file_name);
+
+   assert_true(Checkpoint::exists(file_name), LOG);
+   assert_true(!Checkpoint::exists(file_name + ".tmp"), LOG);
+
+   // Test
+
+   checkpoint.set_size_t("Epoch", 3);
+
+   checkpoint.save(file_name);
+
+   assert_true(Checkpoint::exists(file_name), LOG);
+   assert_true(!Checkpoint::exists(file_name + ".tmp"), LOG);
+
+   remove(file_name.c_str());
+
+   assert_true(!Checkpoint::exists(file_name), LOG);
+   assert_true(!Checkpoint::exists(""), LOG);
+}
+
+
+void CheckpointTest::test_load()
+{
+   cout << "test_load\n";
+
+   const string file_name = "../data/checkpoint.dat";
+
+   Checkpoint checkpoint;
+
+   Checkpoint loaded_checkpoint;
+
+   EvaluationCache evaluation_cache;
+
+   Vector<bool> inputs(10, false);
+
+   Vector<double> parameters(6);
+
+   Vector<Vector<bool>> population(4, Vector<bool>(10, false));
+
+   // Test
+
+   inputs[2] = true;
+   inputs[9] = true;
+
+   parameters.randomize_normal();
+
+   population[1] = inputs;
+
+   evaluation_cache.insert(inputs, EvaluationCache::Evaluation(1.0, 2.0, parameters));
+
+   checkpoint.set_size_t("Epoch", 5);
+   checkpoint.set_double("OptimumSelectionError", numeric_limits<double>::max());
+   checkpoint.set_vector("OptimalParameters", parameters);
+   checkpoint.set_bool_vectors("Population", population);
+   checkpoint.set_evaluation_cache(evaluation_cache);
+
+   checkpoint.save(file_name);
+
+   loaded_checkpoint.set_size_t("Iterations", 1);
+
+   loaded_checkpoint.load(file_name);
+
+   assert_true(!loaded_checkpoint.contains("Iterations"), LOG);
+   assert_true(loaded_checkpoint.get_size_t("Epoch") == 5, LOG);
+   assert_true(loaded_checkpoint.get_double("OptimumSelectionError") == numeric_limits<double>::max(), LOG);
+   assert_true(loaded_checkpoint.get_vector("OptimalParameters") == parameters, LOG);
+   assert_true(loaded_checkpoint.get_bool_vectors("Population") == population, LOG);
+   assert_true(loaded_checkpoint.get_evaluation_cache().get_evaluations_number() == 1, LOG);
+   assert_true(loaded_checkpoint.get_evaluation_cache().find(inputs) != nullptr, LOG);
+   assert_true(loaded_checkpoint.get_evaluation_cache().find(inputs)->parameters == parameters, LOG);
+
+   remove(file_name.c_str());
+}
+
+
+void CheckpointTest::run_test_case()
+{
+   cout << "Running checkpoint test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Set methods
+
+   test_set_vector();
+   test_set_vectors();
+   test_set_generator();
+
+   test_clear();
+
+   // Serialization methods
+
+   test_save();
+   test_load();
+
+   cout << "End of checkpoint test case.\n";
+}
+
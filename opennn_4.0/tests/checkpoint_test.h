@@ -0,0 +1,61 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   C H E C K P O I N T   T E S T   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef CHECKPOINTTEST_H
+#define CHECKPOINTTEST_H
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class CheckpointTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   explicit CheckpointTest();
+
+   virtual ~CheckpointTest();
+
+   // Constructor and destructor methods
+
+   void test_constructor();
+   void test_destructor();
+
+   // Set methods
+
+   void test_set_vector();
+   void test_set_vectors();
+   void test_set_generator();
+
+   void test_clear();
+
+   // Serialization methods
+
+   void test_save();
+   void test_load();
+
+   // Unit testing methods
+
+   void run_test_case();
+
+};
+
+}
+
+#endif
+
+
+
@@ -895,6 +895,74 @@ void CorrelationsTest::test_one_way_anova_correlation_missing_values()
 }
 
 
+void CorrelationsTest::test_mutual_information()
+{
+    cout << "test_mutual_information\n";
+
+    Matrix<double> x(100,1);
+    Matrix<double> y(100,1);
+
+    double information;
+
+    // Test
+
+    for(size_t i = 0; i < 100; i++)
+    {
+        x(i,0) = -1.0 + 2.0*static_cast<double>(i)/99.0;
+        y(i,0) = x(i,0)*x(i,0);
+    }
+
+    information = mutual_information(x, y);
+
+    assert_true(abs(linear_correlation(x.get_column(0), y.get_column(0))) < 0.01, LOG);
+    assert_true(mutual_information_correlation(information) > 0.8, LOG);
+
+    // Test
+
+    for(size_t i = 0; i < 100; i++)
+    {
+        x(i,0) = static_cast<double>(i%2);
+        y(i,0) = static_cast<double>((i/2)%2);
+    }
+
+    information = mutual_information(x, y);
+
+    assert_true(abs(information) < 1.0e-12, LOG);
+
+    // Test
+
+    information = mutual_information(x, x);
+
+    assert_true(abs(information - log(2.0)) < 0.01, LOG);
+}
+
+
+void CorrelationsTest::test_mutual_information_missing_values()
+{
+    cout << "test_mutual_information_missing_values\n";
+
+    Matrix<double> x(100,1);
+    Matrix<double> y(100,1);
+
+    for(size_t i = 0; i < 100; i++)
+    {
+        x(i,0) = static_cast<double>(i%2);
+        y(i,0) = static_cast<double>(i%2);
+    }
+
+    x(0,0) = NAN;
+    y(1,0) = NAN;
+
+    const Vector<size_t> not_missing_rows(2, 1, 99);
+
+    const double information = mutual_information_missing_values(x, y);
+    const double solution = mutual_information(x.get_submatrix_rows(not_missing_rows), y.get_submatrix_rows(not_missing_rows));
+
+    assert_true(abs(information - solution) < 1.0e-12, LOG);
+    assert_true(information > 0.6, LOG);
+}
+
+
 void CorrelationsTest::test_f_snedecor_critical_point()
 {
     cout << "test_f_snedecor_critical_point\n";
@@ -1015,6 +1083,11 @@ void CorrelationsTest::run_test_case()
    test_f_snedecor_critical_point();
    test_f_snedecor_critical_point_missing_values();
 
+   // Mutual information
+
+   test_mutual_information();
+   test_mutual_information_missing_values();
+
 
    cout << "End of correlation analysis test case.\n";
 }
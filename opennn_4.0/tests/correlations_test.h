@@ -112,6 +112,11 @@ public:
     void test_f_snedecor_critical_point();
     void test_f_snedecor_critical_point_missing_values();
 
+    // Mutual information
+
+    void test_mutual_information();
+    void test_mutual_information_missing_values();
+
     // Unit tseting method
 
     void run_test_case();
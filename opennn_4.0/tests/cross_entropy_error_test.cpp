@@ -169,6 +169,40 @@ void CrossEntropyErrorTest::test_calculate_training_error_gradient()
 
    neural_network.set();
 
+   // Test softmax
+{
+   instances_number = 10;
+   inputs_number = 3;
+   outputs_number = 4;
+   hidden_neurons = 2;
+
+   data_set.set(instances_number, inputs_number, outputs_number);
+
+   data_set.randomize_data_normal();
+
+   data_set.set_training();
+
+   neural_network.set(NeuralNetwork::Classification,{inputs_number, hidden_neurons, outputs_number});
+
+   neural_network.get_probabilistic_layer_pointer()->set_activation_function(ProbabilisticLayer::Softmax);
+
+   neural_network.randomize_parameters_normal();
+
+   cee.set_regularization_method(LossIndex::NoRegularization);
+
+   assert_true(cee.has_softmax_output_layer(), LOG);
+
+   error_gradient = cee.calculate_batch_first_order_loss(data_set.get_training_instances_indices()).gradient*static_cast<double>(instances_number);
+
+   numerical_error_gradient = cee.calculate_training_error_gradient_numerical_differentiation();
+
+   assert_true(absolute_value(error_gradient - numerical_error_gradient) < 1.0e-3, LOG);
+
+   assert_true(absolute_value(error_gradient - cee.calculate_training_error_gradient()) < 1.0e-6, LOG);
+}
+
+   neural_network.set();
+
    // Test lstm
 {
    instances_number = 10;
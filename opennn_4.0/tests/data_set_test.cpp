@@ -290,6 +290,73 @@ void DataSetTest::test_get_instance()
 }
 
 
+void DataSetTest::test_split_batches()
+{
+   cout << "test_split_batches\n";
+
+   DataSet data_set;
+
+   Vector<size_t> instances_indices;
+
+   Vector<Vector<size_t>> batches;
+
+   // Test
+
+   data_set.set_batch_instances_number(4);
+
+   instances_indices.set(0, 1, 9);
+
+   batches = data_set.split_batches(instances_indices, true, 1);
+
+   assert_true(batches.size() == 2, LOG);
+   assert_true(batches[0].size() == 4, LOG);
+   assert_true(batches[1].size() == 4, LOG);
+
+   // Test
+
+   data_set.set_batch_instances_number(6);
+
+   instances_indices.set(0, 1, 11);
+
+   for(size_t k = 0; k < 10; k++)
+   {
+      batches = data_set.split_batches(instances_indices, true, 3);
+
+      assert_true(batches.size() == 2, LOG);
+
+      for(size_t i = 0; i < batches.size(); i++)
+      {
+         assert_true(batches[i].size() == 6, LOG);
+
+         for(size_t j = 0; j < batches[i].size(); j++)
+         {
+            if(j%3 == 0) assert_true(batches[i][j]%3 == 0, LOG);
+            else assert_true(batches[i][j] == batches[i][j-1]+1, LOG);
+         }
+      }
+   }
+
+   // Test
+
+   instances_indices.set(0, 1, 13);
+
+   batches = data_set.split_batches(instances_indices, true, 3);
+
+   assert_true(batches.size() == 2, LOG);
+   assert_true(!batches[0].contains(12) && !batches[1].contains(12), LOG);
+   assert_true(!batches[0].contains(13) && !batches[1].contains(13), LOG);
+
+   // Test
+
+   instances_indices.set(0, 1, 1);
+
+   batches = data_set.split_batches(instances_indices, true, 3);
+
+   assert_true(batches.size() == 1, LOG);
+   assert_true(batches[0] == instances_indices, LOG);
+}
+
+
 void DataSetTest::test_set() 
 {
    cout << "test_set\n";
@@ -2892,6 +2959,7 @@ void DataSetTest::run_test_case()
 
    // Instance methods
    test_get_instance();
+   test_split_batches();
 
    // Set methods
    test_set();
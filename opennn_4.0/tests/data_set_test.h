@@ -59,6 +59,7 @@ public:
    // Instance methods
 
    void test_get_instance();
+   void test_split_batches();
 
    // Set methods
    void test_set();
@@ -0,0 +1,191 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   S E T   V I E W   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "data_set_view_test.h"
+
+
+DataSetViewTest::DataSetViewTest() : UnitTesting()
+{
+}
+
+
+DataSetViewTest::~DataSetViewTest()
+{
+}
+
+
+void DataSetViewTest::test_constructor()
+{
+   cout << "test_constructor\n";
+
+   DataSet data_set(10, 3, 1);
+
+   DataSetView data_set_view(data_set);
+
+   assert_true(data_set_view.get_data_set_pointer() == &data_set, LOG);
+   assert_true(data_set_view.get_inputs_mask() == Vector<bool>(3, true), LOG);
+   assert_true(data_set_view.get_instances_number() == 10, LOG);
+   assert_true(data_set_view.get_input_variables_number() == 3, LOG);
+   assert_true(data_set_view.get_target_variables_number() == 1, LOG);
+   assert_true(&data_set_view.get_data() == &data_set.get_data(), LOG);
+   assert_true(data_set_view.has_data(), LOG);
+}
+
+
+void DataSetViewTest::test_destructor()
+{
+   cout << "test_destructor\n";
+}
+
+
+void DataSetViewTest::test_set_inputs_mask()
+{
+   cout << "test_set_inputs_mask\n";
+
+   DataSet data_set(10, 3, 1);
+
+   DataSetView data_set_view(data_set);
+
+   const Vector<DataSet::VariableUse> columns_uses = data_set.get_columns_uses();
+
+   data_set_view.set_inputs_mask({true, false, true});
+
+   assert_true(data_set_view.get_inputs_mask() == Vector<bool>({true, false, true}), LOG);
+   assert_true(data_set_view.get_input_variables_number() == 2, LOG);
+   assert_true(data_set_view.get_input_variables_indices() == Vector<size_t>({0, 2}), LOG);
+   assert_true(data_set_view.get_input_variables_dimensions() == Vector<size_t>({2}), LOG);
+
+   // Viewed data set
+
+   assert_true(data_set.get_columns_uses() == columns_uses, LOG);
+   assert_true(data_set.get_input_variables_number() == 3, LOG);
+
+   data_set_view.set_inputs_mask({false, true, false});
+
+   assert_true(data_set_view.get_input_variables_indices() == Vector<size_t>({1}), LOG);
+}
+
+
+void DataSetViewTest::test_get_input_data()
+{
+   cout << "test_get_input_data\n";
+
+   DataSet data_set(10, 3, 1);
+
+   data_set.randomize_data_normal();
+
+   DataSetView data_set_view(data_set);
+
+   const Vector<size_t> instances_indices({1, 4, 7});
+
+   Tensor<double> inputs = data_set_view.get_input_data(instances_indices);
+
+   assert_true(inputs == data_set.get_input_data(instances_indices), LOG);
+
+   data_set_view.set_inputs_mask({true, false, true});
+
+   inputs = data_set_view.get_input_data(instances_indices);
+
+   assert_true(inputs.get_dimension(0) == 3, LOG);
+   assert_true(inputs.get_dimension(1) == 2, LOG);
+
+   for(size_t i = 0; i < instances_indices.size(); i++)
+   {
+      assert_true(inputs(i,0) == data_set.get_data()(instances_indices[i],0), LOG);
+      assert_true(inputs(i,1) == data_set.get_data()(instances_indices[i],2), LOG);
+   }
+
+   // Training data
+
+   DataSet masked_data_set(data_set);
+
+   masked_data_set.set_column_use(1, DataSet::UnusedVariable);
+
+   assert_true(data_set_view.get_training_input_data() == masked_data_set.get_training_input_data(), LOG);
+}
+
+
+void DataSetViewTest::test_get_target_data()
+{
+   cout << "test_get_target_data\n";
+
+   DataSet data_set(10, 3, 1);
+
+   data_set.randomize_data_normal();
+
+   DataSetView data_set_view(data_set);
+
+   data_set_view.set_inputs_mask({false, true, true});
+
+   const Vector<size_t> instances_indices({0, 9});
+
+   assert_true(data_set_view.get_target_data(instances_indices) == data_set.get_target_data(instances_indices), LOG);
+   assert_true(data_set_view.get_training_target_data() == data_set.get_training_target_data(), LOG);
+}
+
+
+void DataSetViewTest::test_calculate_training_error()
+{
+   cout << "test_calculate_training_error\n";
+
+   DataSet data_set(20, 3, 1);
+
+   data_set.randomize_data_normal();
+
+   DataSet masked_data_set(data_set);
+
+   masked_data_set.set_column_use(1, DataSet::UnusedVariable);
+
+   masked_data_set.set_input_variables_dimensions({2});
+
+   DataSetView data_set_view(data_set);
+
+   data_set_view.set_inputs_mask({true, false, true});
+
+   NeuralNetwork neural_network(NeuralNetwork::Approximation, {2, 3, 1});
+
+   neural_network.randomize_parameters_normal();
+
+   MeanSquaredError view_mean_squared_error(&neural_network, &data_set_view);
+
+   MeanSquaredError masked_mean_squared_error(&neural_network, &masked_data_set);
+
+   assert_true(abs(view_mean_squared_error.calculate_training_error() - masked_mean_squared_error.calculate_training_error()) < 1.0e-9, LOG);
+
+   assert_true(absolute_value(view_mean_squared_error.calculate_training_error_gradient()
+                              - masked_mean_squared_error.calculate_training_error_gradient()) < 1.0e-9, LOG);
+}
+
+
+void DataSetViewTest::run_test_case()
+{
+   cout << "Running data set view test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Set methods
+
+   test_set_inputs_mask();
+
+   // Data methods
+
+   test_get_input_data();
+   test_get_target_data();
+
+   // Loss methods
+
+   test_calculate_training_error();
+
+   cout << "End of data set view test case.\n";
+}
+
+
+
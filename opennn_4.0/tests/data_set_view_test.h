@@ -0,0 +1,61 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   S E T   V I E W   T E S T   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef DATASETVIEWTEST_H
+#define DATASETVIEWTEST_H
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class DataSetViewTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   explicit DataSetViewTest();
+
+   virtual ~DataSetViewTest();
+
+   // Constructor and destructor methods
+
+   void test_constructor();
+   void test_destructor();
+
+   // Set methods
+
+   void test_set_inputs_mask();
+
+   // Data methods
+
+   void test_get_input_data();
+   void test_get_target_data();
+
+   // Loss methods
+
+   void test_calculate_training_error();
+
+   // Unit testing methods
+
+   void run_test_case();
+
+};
+
+}
+
+#endif
+
+
+
@@ -0,0 +1,227 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   E V A L U A T I O N   C A C H E   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "evaluation_cache_test.h"
+
+
+EvaluationCacheTest::EvaluationCacheTest() : UnitTesting()
+{
+}
+
+
+EvaluationCacheTest::~EvaluationCacheTest()
+{
+}
+
+
+void EvaluationCacheTest::test_constructor()
+{
+   cout << "test_constructor\n";
+
+   EvaluationCache evaluation_cache;
+
+   assert_true(evaluation_cache.get_evaluations_number() == 0, LOG);
+}
+
+
+void EvaluationCacheTest::test_destructor()
+{
+   cout << "test_destructor\n";
+}
+
+
+void EvaluationCacheTest::test_get_key()
+{
+   cout << "test_get_key\n";
+
+   Vector<bool> inputs(10, false);
+
+   inputs[0] = true;
+   inputs[9] = true;
+
+   // Equal inputs
+
+   assert_true(EvaluationCache::get_key(inputs) == EvaluationCache::get_key(Vector<bool>(inputs)), LOG);
+
+   // Different inputs
+
+   Vector<bool> other_inputs(inputs);
+
+   other_inputs[8] = true;
+
+   assert_true(EvaluationCache::get_key(inputs) != EvaluationCache::get_key(other_inputs), LOG);
+
+   // Different number of inputs
+
+   Vector<bool> longer_inputs(inputs);
+
+   longer_inputs.push_back(false);
+
+   assert_true(EvaluationCache::get_key(inputs) != EvaluationCache::get_key(longer_inputs), LOG);
+
+   // Neurons number
+
+   assert_true(EvaluationCache::get_key(static_cast<size_t>(3)) != EvaluationCache::get_key(static_cast<size_t>(4)), LOG);
+}
+
+
+void EvaluationCacheTest::test_insert()
+{
+   cout << "test_insert\n";
+
+   EvaluationCache evaluation_cache;
+
+   const EvaluationCache::Evaluation* evaluation;
+
+   Vector<bool> inputs(5, true);
+
+   inputs[2] = false;
+
+   Vector<bool> other_inputs(5, true);
+
+   // Inputs
+
+   assert_true(!evaluation_cache.contains(inputs), LOG);
+
+   evaluation_cache.insert(inputs, EvaluationCache::Evaluation(1.0, 2.0, Vector<double>(3, 0.5)));
+
+   assert_true(evaluation_cache.get_evaluations_number() == 1, LOG);
+   assert_true(evaluation_cache.contains(inputs), LOG);
+   assert_true(!evaluation_cache.contains(other_inputs), LOG);
+
+   evaluation = evaluation_cache.find(inputs);
+
+   assert_true(evaluation != nullptr, LOG);
+   assert_true(evaluation->training_error == 1.0, LOG);
+   assert_true(evaluation->selection_error == 2.0, LOG);
+   assert_true(evaluation->parameters == Vector<double>(3, 0.5), LOG);
+
+   assert_true(evaluation_cache.find(other_inputs) == nullptr, LOG);
+
+   // Replace
+
+   evaluation_cache.insert(inputs, EvaluationCache::Evaluation(3.0, 4.0, Vector<double>()));
+
+   assert_true(evaluation_cache.get_evaluations_number() == 1, LOG);
+   assert_true(evaluation_cache.find(inputs)->selection_error == 4.0, LOG);
+
+   // Neurons number
+
+   evaluation_cache.insert(static_cast<size_t>(7), EvaluationCache::Evaluation(5.0, 6.0, Vector<double>()));
+
+   assert_true(evaluation_cache.contains(static_cast<size_t>(7)), LOG);
+   assert_true(!evaluation_cache.contains(static_cast<size_t>(8)), LOG);
+   assert_true(evaluation_cache.find(static_cast<size_t>(7))->training_error == 5.0, LOG);
+}
+
+
+void EvaluationCacheTest::test_clear()
+{
+   cout << "test_clear\n";
+
+   EvaluationCache evaluation_cache;
+
+   evaluation_cache.insert(Vector<bool>(3, true), EvaluationCache::Evaluation(1.0, 2.0, Vector<double>()));
+
+   evaluation_cache.clear();
+
+   assert_true(evaluation_cache.get_evaluations_number() == 0, LOG);
+   assert_true(!evaluation_cache.contains(Vector<bool>(3, true)), LOG);
+}
+
+
+void EvaluationCacheTest::test_save()
+{
+   cout << "test_save\n";
+
+   const string file_name = "../data/evaluation_cache.dat";
+
+   EvaluationCache evaluation_cache;
+
+   evaluation_cache.save(file_name);
+
+   evaluation_cache.insert(Vector<bool>(3, true), EvaluationCache::Evaluation(1.0, 2.0, Vector<double>(4, 1.5)));
+
+   evaluation_cache.save(file_name);
+}
+
+
+void EvaluationCacheTest::test_load()
+{
+   cout << "test_load\n";
+
+   const string file_name = "../data/evaluation_cache.dat";
+
+   EvaluationCache evaluation_cache;
+
+   const EvaluationCache::Evaluation* evaluation;
+
+   Vector<bool> inputs(12, false);
+
+   inputs[1] = true;
+   inputs[11] = true;
+
+   Vector<double> parameters(4);
+
+   parameters.randomize_normal();
+
+   evaluation_cache.insert(inputs, EvaluationCache::Evaluation(1.0, 2.0, parameters));
+   evaluation_cache.insert(static_cast<size_t>(3), EvaluationCache::Evaluation(3.0, 4.0, Vector<double>()));
+
+   evaluation_cache.save(file_name);
+
+   EvaluationCache loaded_evaluation_cache;
+
+   loaded_evaluation_cache.load(file_name);
+
+   assert_true(loaded_evaluation_cache.get_evaluations_number() == 2, LOG);
+
+   evaluation = loaded_evaluation_cache.find(inputs);
+
+   assert_true(evaluation != nullptr, LOG);
+   assert_true(evaluation->training_error == 1.0, LOG);
+   assert_true(evaluation->selection_error == 2.0, LOG);
+   assert_true(evaluation->parameters == parameters, LOG);
+
+   evaluation = loaded_evaluation_cache.find(static_cast<size_t>(3));
+
+   assert_true(evaluation != nullptr, LOG);
+   assert_true(evaluation->selection_error == 4.0, LOG);
+   assert_true(evaluation->parameters.empty(), LOG);
+}
+
+
+void EvaluationCacheTest::run_test_case()
+{
+   cout << "Running evaluation cache test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Key methods
+
+   test_get_key();
+
+   // Set methods
+
+   test_insert();
+
+   test_clear();
+
+   // Serialization methods
+
+   test_save();
+   test_load();
+
+   cout << "End of evaluation cache test case.\n";
+}
+
+
+
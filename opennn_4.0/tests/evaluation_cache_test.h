@@ -0,0 +1,63 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   E V A L U A T I O N   C A C H E   T E S T   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef EVALUATIONCACHETEST_H
+#define EVALUATIONCACHETEST_H
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class EvaluationCacheTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   explicit EvaluationCacheTest();
+
+   virtual ~EvaluationCacheTest();
+
+   // Constructor and destructor methods
+
+   void test_constructor();
+   void test_destructor();
+
+   // Key methods
+
+   void test_get_key();
+
+   // Set methods
+
+   void test_insert();
+
+   void test_clear();
+
+   // Serialization methods
+
+   void test_save();
+   void test_load();
+
+   // Unit testing methods
+
+   void run_test_case();
+
+};
+
+}
+
+#endif
+
+
+
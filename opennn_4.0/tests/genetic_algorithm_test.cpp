@@ -134,6 +134,104 @@ void GeneticAlgorithmTest::test_calculate_fitness()
 }
 
 
+void GeneticAlgorithmTest::test_evaluate_population_parallel()
+{
+    cout << "test_evaluate_population_parallel\n";
+
+    DataSet data_set;
+
+    Matrix<double> data(20,3);
+
+    for(size_t i = 0; i < 20; i++)
+    {
+        data(i,0) = static_cast<double>(i);
+        data(i,1) = 10.0;
+        data(i,2) = static_cast<double>(i);
+    }
+
+    data_set.set(data);
+
+    NeuralNetwork neural_network(NeuralNetwork::Approximation, {2,6,1});
+
+    TrainingStrategy training_strategy(&neural_network, &data_set);
+    training_strategy.set_display(false);
+
+    GeneticAlgorithm genetic_algorithm(&training_strategy);
+
+    genetic_algorithm.set_display(false);
+    genetic_algorithm.set_approximation(true);
+    genetic_algorithm.set_population_size(10);
+    genetic_algorithm.set_selection_error_goal(1);
+    genetic_algorithm.set_workers_number(4);
+
+    GeneticAlgorithm::GeneticAlgorithmResults* results;
+
+    // Test
+
+    results = genetic_algorithm.perform_inputs_selection();
+
+    assert_true(results->final_selection_error < 1, LOG);
+    assert_true(results->stopping_condition == InputsSelection::SelectionErrorGoal, LOG);
+
+    const Vector<Vector<bool>>& population = genetic_algorithm.get_population();
+    const Matrix<double>& loss = genetic_algorithm.get_loss();
+
+    for(size_t i = 0; i < population.size(); i++)
+    {
+        for(size_t j = 0; j < i; j++)
+        {
+            if(population[i] == population[j])
+            {
+                assert_true(loss(i,1) == loss(j,1), LOG);
+            }
+        }
+    }
+
+    delete results;
+
+    // Test
+
+    Vector<Vector<Vector<bool>>> workers_populations(2);
+    Vector<Matrix<double>> workers_losses(2);
+
+    const Vector<size_t> workers_numbers({1, 4});
+
+    for(size_t k = 0; k < 2; k++)
+    {
+        set_random_seed(1);
+
+        DataSet workers_data_set;
+
+        workers_data_set.set(data);
+
+        NeuralNetwork workers_neural_network(NeuralNetwork::Approximation, {2,6,1});
+
+        TrainingStrategy workers_training_strategy(&workers_neural_network, &workers_data_set);
+        workers_training_strategy.set_display(false);
+
+        GeneticAlgorithm workers_genetic_algorithm(&workers_training_strategy);
+
+        workers_genetic_algorithm.set_display(false);
+        workers_genetic_algorithm.set_approximation(true);
+        workers_genetic_algorithm.set_population_size(10);
+        workers_genetic_algorithm.set_maximum_iterations_number(3);
+        workers_genetic_algorithm.set_workers_number(workers_numbers[k]);
+
+        delete workers_genetic_algorithm.perform_inputs_selection();
+
+        workers_populations[k] = workers_genetic_algorithm.get_population();
+        workers_losses[k] = workers_genetic_algorithm.get_loss();
+    }
+
+    for(size_t i = 0; i < workers_populations[0].size(); i++)
+    {
+        assert_true(workers_populations[0][i] == workers_populations[1][i], LOG);
+    }
+
+    assert_true(workers_losses[0] == workers_losses[1], LOG);
+}
+
+
 void GeneticAlgorithmTest::test_perform_selection()
 {
     cout << "test_perform_selection\n";
@@ -460,6 +558,26 @@ void GeneticAlgorithmTest::test_from_XML()
     ga.from_XML(*document);
 
     delete document;
+
+    // Test
+
+    GeneticAlgorithm ga1;
+    GeneticAlgorithm ga2;
+
+    ga1.set_workers_number(8);
+
+    document = ga1.to_XML();
+    ga2.from_XML(*document);
+
+    delete document;
+
+    assert_true(ga2.get_workers_number() == 8, LOG);
+
+    // Test
+
+    ga2.set_workers_number(0);
+
+    assert_true(ga2.get_workers_number() == 1, LOG);
 }
 
 // Unit testing methods
@@ -483,6 +601,8 @@ void GeneticAlgorithmTest::run_test_case()
 
     test_calculate_fitness();
 
+    test_evaluate_population_parallel();
+
     // Selection methods
 
     test_perform_selection();
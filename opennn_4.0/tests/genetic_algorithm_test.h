@@ -52,6 +52,8 @@ public:
 
    void test_calculate_fitness();
 
+   void test_evaluate_population_parallel();
+
    // Selection methods
 
    void test_perform_selection();
@@ -127,8 +127,79 @@ void GrowingInputsTest::test_perform_inputs_selection()
     gi1.delete_selection_history();
     gi1.delete_parameters_history();
     gi1.delete_loss_history();
+
+    // Test
+
+    ds.generate_sum_data(20,3);
+
+    neural_network.set(NeuralNetwork::Approximation,{2,6,1});
+
+    GrowingInputs gi2(&ts);
+
+    gi2.set_display(false);
+
+    gi2.set_successive_halving(true);
+    gi2.set_successive_halving_epochs_number(5);
+
+    gir = gi2.perform_inputs_selection();
+
+    assert_true(gir->stopping_condition == InputsSelection::AlgorithmFinished, LOG);
+    assert_true(!gir->optimal_inputs_indices.empty(), LOG);
+    assert_true(ds.get_input_columns_number() == gir->optimal_inputs_indices.size(), LOG);
 }
 
+
+void GrowingInputsTest::test_perform_pre_screening()
+{
+    cout << "test_perform_pre_screening\n";
+
+    Matrix<double> data(100, 5);
+
+    NeuralNetwork neural_network;
+    DataSet data_set;
+
+    TrainingStrategy training_strategy(&neural_network, &data_set);
+
+    GrowingInputs growing_inputs(&training_strategy);
+
+    growing_inputs.set_display(false);
+
+    Vector<size_t> unused_columns;
+
+    // Test
+
+    data.randomize_uniform(-1.0, 1.0);
+
+    for(size_t i = 0; i < 100; i++)
+    {
+        data(i,1) = data(i,0);
+        data(i,4) = data(i,0) + 0.1*data(i,2);
+    }
+
+    data_set.set(data);
+
+    growing_inputs.set_pre_screening_inputs_number(3);
+    growing_inputs.set_pre_screening_maximum_redundancy(0.99);
+
+    unused_columns = growing_inputs.perform_pre_screening();
+
+    assert_true(unused_columns.size() == 1, LOG);
+    assert_true(unused_columns[0] == 0 || unused_columns[0] == 1, LOG);
+    assert_true(data_set.get_input_columns_number() == 3, LOG);
+
+    // Test
+
+    data_set.set(data);
+
+    growing_inputs.set_pre_screening_inputs_number(1);
+
+    unused_columns = growing_inputs.perform_pre_screening();
+
+    assert_true(unused_columns.size() == 3, LOG);
+    assert_true(data_set.get_input_columns_indices()[0] <= 1, LOG);
+}
+
+
 // Serialization methods
 
 void GrowingInputsTest::test_to_XML()
@@ -153,6 +224,40 @@ void GrowingInputsTest::test_from_XML()
     growing_inputs.from_XML(*document);
 
     delete document;
+
+    // Test
+
+    growing_inputs.set_warm_start(true);
+    growing_inputs.set_warm_start_epochs_number(20);
+    growing_inputs.set_successive_halving(true);
+    growing_inputs.set_successive_halving_epochs_number(5);
+    growing_inputs.set_trials_workers_number(4);
+    growing_inputs.set_pre_screening(true);
+    growing_inputs.set_pre_screening_inputs_number(50);
+    growing_inputs.set_pre_screening_maximum_redundancy(0.9);
+    growing_inputs.set_checkpoint_file_name("../data/growing_inputs_checkpoint.dat");
+    growing_inputs.set_checkpoint_period(3);
+    growing_inputs.set_resume_from_checkpoint(true);
+
+    document = growing_inputs.to_XML();
+
+    GrowingInputs growing_inputs_copy;
+
+    growing_inputs_copy.from_XML(*document);
+
+    assert_true(growing_inputs_copy.get_warm_start(), LOG);
+    assert_true(growing_inputs_copy.get_warm_start_epochs_number() == 20, LOG);
+    assert_true(growing_inputs_copy.get_successive_halving(), LOG);
+    assert_true(growing_inputs_copy.get_successive_halving_epochs_number() == 5, LOG);
+    assert_true(growing_inputs_copy.get_trials_workers_number() == 4, LOG);
+    assert_true(growing_inputs_copy.get_pre_screening(), LOG);
+    assert_true(growing_inputs_copy.get_pre_screening_inputs_number() == 50, LOG);
+    assert_true(abs(growing_inputs_copy.get_pre_screening_maximum_redundancy() - 0.9) < 1.0e-6, LOG);
+    assert_true(growing_inputs_copy.get_checkpoint_file_name() == "../data/growing_inputs_checkpoint.dat", LOG);
+    assert_true(growing_inputs_copy.get_checkpoint_period() == 3, LOG);
+    assert_true(growing_inputs_copy.get_resume_from_checkpoint(), LOG);
+
+    delete document;
 }
 
 
@@ -173,6 +278,8 @@ void GrowingInputsTest::run_test_case()
 
     test_perform_inputs_selection();
 
+    test_perform_pre_screening();
+
     // Serialization methods
 
     test_to_XML();
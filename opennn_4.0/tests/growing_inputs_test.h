@@ -50,6 +50,8 @@ public:
 
    void test_perform_inputs_selection();
 
+   void test_perform_pre_screening();
+
    // Serialization methods
 
    void test_to_XML();
@@ -165,6 +165,179 @@ void IncrementalNeuronsTest::test_perform_neurons_selection()
     assert_true(neural_network.get_layers_neurons_numbers()[0] == 1, LOG);
     assert_true(results->stopping_condition == NeuronsSelection::AlgorithmFinished, LOG);
 
+    // Test
+
+    neural_network.set(NeuralNetwork::Approximation, {1, 3, 1});
+    neural_network.initialize_parameters(0.0);
+
+    io.set_warm_start(true);
+    io.set_warm_start_epochs_number(20);
+
+    results = io.perform_neurons_selection();
+
+    assert_true(results->neurons_data.size() == results->iterations_number, LOG);
+    assert_true(neural_network.get_first_perceptron_layer_pointer()->get_neurons_number() == results->optimal_neurons_number, LOG);
+
+    // Test
+
+    neural_network.set(NeuralNetwork::Approximation, {1, 3, 1});
+
+    io.set_warm_start(false);
+    io.set_successive_halving(true);
+    io.set_successive_halving_epochs_number(5);
+
+    results = io.perform_neurons_selection();
+
+    assert_true(results->neurons_data.size() == 7, LOG);
+    assert_true(results->stopping_condition == NeuronsSelection::AlgorithmFinished, LOG);
+    assert_true(neural_network.get_first_perceptron_layer_pointer()->get_neurons_number() == results->optimal_neurons_number, LOG);
+
+}
+
+
+void IncrementalNeuronsTest::test_perform_trials()
+{
+    cout << "test_perform_trials\n";
+
+    Matrix<double> data(21, 2);
+
+    NeuralNetwork neural_network;
+
+    DataSet data_set;
+    TrainingStrategy ts(&neural_network, &data_set);
+
+    IncrementalNeurons io(&ts);
+
+    // Test
+
+    for(size_t i = 0; i < 21; i++)
+    {
+        data(i,0) = -1.0 + 0.1*static_cast<double>(i);
+        data(i,1) = data(i,0);
+    }
+
+    data_set.set(data);
+
+    data_set.set_columns_uses({"Input","Target"});
+
+    neural_network.set(NeuralNetwork::Approximation, {1, 3, 1});
+
+    ts.set_loss_method(TrainingStrategy::SUM_SQUARED_ERROR);
+    ts.set_optimization_method(TrainingStrategy::QUASI_NEWTON_METHOD);
+    ts.get_quasi_Newton_method_pointer()->set_maximum_epochs_number(50);
+    ts.set_display(false);
+
+    io.set_trials_number(4);
+    io.set_display(false);
+
+    set_random_seed(1);
+
+    const Vector<OptimizationAlgorithm::Results> sequential_results = io.perform_trials(neural_network);
+
+    io.set_trials_workers_number(4);
+
+    set_random_seed(1);
+
+    const Vector<OptimizationAlgorithm::Results> parallel_results = io.perform_trials(neural_network);
+
+    assert_true(sequential_results.size() == 4, LOG);
+    assert_true(parallel_results.size() == 4, LOG);
+
+    for(size_t i = 0; i < 4; i++)
+    {
+        assert_true(parallel_results[i].final_parameters.size() == neural_network.get_parameters_number(), LOG);
+        assert_true(parallel_results[i].final_selection_error < 1.0e-2, LOG);
+        assert_true(sequential_results[i].final_selection_error < 1.0e-2, LOG);
+        assert_true(parallel_results[i].final_parameters == sequential_results[i].final_parameters, LOG);
+    }
+}
+
+
+void IncrementalNeuronsTest::test_perform_neurons_selection_resume()
+{
+    cout << "test_perform_neurons_selection_resume\n";
+
+    const string file_name = "../data/incremental_neurons_checkpoint.dat";
+
+    Matrix<double> data(21, 2);
+
+    NeuralNetwork neural_network;
+
+    DataSet data_set;
+    TrainingStrategy ts(&neural_network, &data_set);
+
+    IncrementalNeurons io(&ts);
+
+    IncrementalNeurons::IncrementalNeuronsResults* results;
+
+    // Test
+
+    for(size_t i = 0; i < 21; i++)
+    {
+        data(i,0) = -1.0 + 0.1*static_cast<double>(i);
+        data(i,1) = data(i,0);
+    }
+
+    data_set.set(data);
+
+    data_set.set_columns_uses({"Input","Target"});
+
+    neural_network.set(NeuralNetwork::Approximation, {1, 3, 1});
+
+    ts.set_loss_method(TrainingStrategy::SUM_SQUARED_ERROR);
+    ts.set_optimization_method(TrainingStrategy::QUASI_NEWTON_METHOD);
+    ts.get_quasi_Newton_method_pointer()->set_maximum_epochs_number(50);
+    ts.set_display(false);
+
+    io.set_minimum_order(1);
+    io.set_maximum_order(4);
+    io.set_trials_number(1);
+    io.set_selection_error_goal(0.0);
+    io.set_display(false);
+
+    // State of a search interrupted after the networks with 1 and 2 hidden neurons
+
+    NeuralNetwork previous_neural_network(NeuralNetwork::Approximation, {1, 2, 1});
+
+    Checkpoint checkpoint;
+
+    checkpoint.set_size_t("Iterations", 2);
+    checkpoint.set_size_t("NeuronsNumber", 3);
+    checkpoint.set_vector("CurrentParameters", previous_neural_network.get_parameters());
+    checkpoint.set_size_t("OptimalNeuronsNumber", 2);
+    checkpoint.set_vector("OptimalParameters", previous_neural_network.get_parameters());
+    checkpoint.set_double("OptimumTrainingLoss", 1.0e3);
+    checkpoint.set_double("OptimumSelectionError", 1.0e3);
+    checkpoint.set_double("PreviousSelectionError", 1.0e3);
+    checkpoint.set_size_t("SelectionFailures", 0);
+    checkpoint.set_indices("NeuronsData", Vector<size_t>(1, 1, 2));
+    checkpoint.set_vector("TrainingLossData", Vector<double>(2, 1.0e3));
+    checkpoint.set_vector("SelectionErrorData", Vector<double>(2, 1.0e3));
+    checkpoint.set_double("ElapsedTime", 0.0);
+
+    checkpoint.set_generator("RandomGenerator", RandomGenerator(1));
+    checkpoint.set_indices("OrderHistory", Vector<size_t>());
+    checkpoint.set_vector("TrainingLossHistory", Vector<double>());
+    checkpoint.set_vector("SelectionErrorHistory", Vector<double>());
+    checkpoint.set_vectors("ParametersHistory", Vector<Vector<double>>());
+
+    checkpoint.save(file_name);
+
+    io.set_checkpoint_file_name(file_name);
+    io.set_resume_from_checkpoint(true);
+
+    results = io.perform_neurons_selection();
+
+    assert_true(results->neurons_data.size() == 4, LOG);
+    assert_true(results->neurons_data[1] == 2, LOG);
+    assert_true(results->neurons_data[2] == 3, LOG);
+    assert_true(results->neurons_data[3] == 4, LOG);
+    assert_true(results->iterations_number == 4, LOG);
+    assert_true(results->optimal_neurons_number > 2, LOG);
+    assert_true(results->final_selection_error < 1.0e3, LOG);
+    assert_true(!Checkpoint::exists(file_name), LOG);
+
+    delete results;
 }
 
 
@@ -192,6 +365,34 @@ void IncrementalNeuronsTest::test_from_XML()
 
     delete document;
 
+    // Test
+
+    io.set_warm_start(true);
+    io.set_warm_start_epochs_number(20);
+    io.set_successive_halving(true);
+    io.set_successive_halving_epochs_number(5);
+    io.set_trials_workers_number(4);
+    io.set_checkpoint_file_name("../data/incremental_neurons_checkpoint.dat");
+    io.set_checkpoint_period(2);
+    io.set_resume_from_checkpoint(true);
+
+    document = io.to_XML();
+
+    IncrementalNeurons io_copy;
+
+    io_copy.from_XML(*document);
+
+    assert_true(io_copy.get_warm_start(), LOG);
+    assert_true(io_copy.get_warm_start_epochs_number() == 20, LOG);
+    assert_true(io_copy.get_successive_halving(), LOG);
+    assert_true(io_copy.get_successive_halving_epochs_number() == 5, LOG);
+    assert_true(io_copy.get_trials_workers_number() == 4, LOG);
+    assert_true(io_copy.get_checkpoint_file_name() == "../data/incremental_neurons_checkpoint.dat", LOG);
+    assert_true(io_copy.get_checkpoint_period() == 2, LOG);
+    assert_true(io_copy.get_resume_from_checkpoint(), LOG);
+
+    delete document;
+
 }
 
 // Unit testing methods
@@ -213,6 +414,10 @@ void IncrementalNeuronsTest::run_test_case()
 
     test_perform_neurons_selection();
 
+    test_perform_trials();
+
+    test_perform_neurons_selection_resume();
+
     // Serialization methods
 
     test_to_XML();
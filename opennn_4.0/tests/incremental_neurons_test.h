@@ -42,6 +42,10 @@ public:
 
    void test_perform_neurons_selection();
 
+   void test_perform_trials();
+
+   void test_perform_neurons_selection_resume();
+
    // Serialization methods
 
    void test_to_XML();
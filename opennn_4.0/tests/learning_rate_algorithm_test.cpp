@@ -409,6 +409,68 @@ void LearningRateAlgorithmTest::test_calculate_Brent_method_directional_point()
 }
 
 
+void LearningRateAlgorithmTest::test_calculate_strong_Wolfe_directional_point()
+{
+   cout << "test_calculate_strong_Wolfe_directional_point\n";
+
+   DataSet data_set(10, 2, 1);
+   data_set.randomize_data_normal();
+   data_set.set_training();
+
+   NeuralNetwork neural_network(NeuralNetwork::Approximation, {2, 3, 1});
+   neural_network.randomize_parameters_normal();
+
+   SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+   LearningRateAlgorithm tra(&sum_squared_error);
+
+   tra.set_learning_rate_method(LearningRateAlgorithm::StrongWolfe);
+
+   const Vector<double> parameters = neural_network.get_parameters();
+
+   const double loss = sum_squared_error.calculate_training_loss();
+   const Vector<double> gradient = sum_squared_error.calculate_training_loss_gradient();
+
+   const Vector<double> training_direction = gradient*(-1.0)/l2_norm(gradient);
+
+   const double slope = dot(gradient, training_direction);
+
+   // Test
+
+   pair<double,double> directional_point = tra.calculate_directional_point(loss, slope, training_direction, 0.001);
+
+   assert_true(neural_network.get_parameters() == parameters, LOG);
+
+   assert_true(directional_point.first > 0.0, LOG);
+   assert_true(directional_point.second < loss, LOG);
+   assert_true(abs(directional_point.second - sum_squared_error.calculate_training_loss(training_direction, directional_point.first)) < 1.0e-9, LOG);
+   assert_true(directional_point.second <= loss + 1.0e-4*directional_point.first*slope, LOG);
+
+   // Test
+
+   directional_point = tra.calculate_directional_point(loss, training_direction, 0.001);
+
+   assert_true(directional_point.second < loss, LOG);
+}
+
+
+void LearningRateAlgorithmTest::test_calculate_cubic_interpolation_learning_rate()
+{
+   cout << "test_calculate_cubic_interpolation_learning_rate\n";
+
+   LearningRateAlgorithm tra;
+
+   // Test
+
+   assert_true(abs(tra.calculate_cubic_interpolation_learning_rate(0.0, 4.0, -4.0, 3.0, 1.0, 2.0) - 2.0) < 1.0e-12, LOG);
+   assert_true(abs(tra.calculate_cubic_interpolation_learning_rate(3.0, 1.0, 2.0, 0.0, 4.0, -4.0) - 2.0) < 1.0e-12, LOG);
+
+   // Test
+
+   assert_true(abs(tra.calculate_cubic_interpolation_learning_rate(0.0, 0.0, 1.0, 1.0, 1.0, 1.0) - 0.5) < 1.0e-12, LOG);
+}
+
+
 void LearningRateAlgorithmTest::test_to_XML()
 {
    cout << "test_to_XML\n";
@@ -481,6 +543,8 @@ void LearningRateAlgorithmTest::run_test_case()
 //   test_calculate_fixed_directional_point();
 //   test_calculate_golden_section_directional_point();
 //   test_calculate_Brent_method_directional_point();
+   test_calculate_strong_Wolfe_directional_point();
+   test_calculate_cubic_interpolation_learning_rate();
 //   test_calculate_directional_point();
 
    // Serialization methods
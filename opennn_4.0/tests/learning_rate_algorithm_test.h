@@ -86,6 +86,9 @@ public:
    void test_calculate_fixed_directional_point();
    void test_calculate_golden_section_directional_point();
    void test_calculate_Brent_method_directional_point();
+   void test_calculate_strong_Wolfe_directional_point();
+
+   void test_calculate_cubic_interpolation_learning_rate();
    
    // Serialization methods
 
@@ -0,0 +1,226 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   L E A R N I N G   R A T E   S C H E D U L E   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "learning_rate_schedule_test.h"
+
+
+LearningRateScheduleTest::LearningRateScheduleTest() : UnitTesting()
+{
+}
+
+
+LearningRateScheduleTest::~LearningRateScheduleTest()
+{
+}
+
+
+void LearningRateScheduleTest::test_constructor()
+{
+   cout << "test_constructor\n";
+
+   LearningRateSchedule learning_rate_schedule;
+
+   assert_true(learning_rate_schedule.get_schedule_method() == LearningRateSchedule::Constant, LOG);
+}
+
+
+void LearningRateScheduleTest::test_destructor()
+{
+   cout << "test_destructor\n";
+}
+
+
+void LearningRateScheduleTest::test_set_schedule_method()
+{
+   cout << "test_set_schedule_method\n";
+
+   LearningRateSchedule learning_rate_schedule;
+
+   const Vector<string> schedule_methods({"Constant", "Step", "Exponential", "CosineAnnealing", "OneCycle", "ReduceOnPlateau"});
+
+   for(size_t i = 0; i < schedule_methods.size(); i++)
+   {
+      learning_rate_schedule.set_schedule_method(schedule_methods[i]);
+
+      assert_true(learning_rate_schedule.write_schedule_method() == schedule_methods[i], LOG);
+   }
+}
+
+
+void LearningRateScheduleTest::test_calculate_learning_rate_factor()
+{
+   cout << "test_calculate_learning_rate_factor\n";
+
+   LearningRateSchedule learning_rate_schedule;
+
+   // Constant
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(25.0) - 1.0) < 1.0e-12, LOG);
+
+   // Step
+
+   learning_rate_schedule.set_schedule_method(LearningRateSchedule::Step);
+   learning_rate_schedule.set_step_epochs(10.0);
+   learning_rate_schedule.set_decay_rate(0.5);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(9.5) - 1.0) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(25.0) - 0.25) < 1.0e-12, LOG);
+
+   // Exponential
+
+   learning_rate_schedule.set_schedule_method(LearningRateSchedule::Exponential);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(2.0) - 0.25) < 1.0e-12, LOG);
+
+   // Cosine annealing
+
+   learning_rate_schedule.set_schedule_method(LearningRateSchedule::CosineAnnealing);
+   learning_rate_schedule.set_period_epochs(10.0);
+   learning_rate_schedule.set_minimum_factor(0.0);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(0.0) - 1.0) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(5.0) - 0.5) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(10.0) - 1.0) < 1.0e-12, LOG);
+
+   learning_rate_schedule.set_period_multiplier(2.0);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(20.0) - 0.5) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(30.0) - 1.0) < 1.0e-12, LOG);
+
+   // One cycle
+
+   learning_rate_schedule.set_schedule_method(LearningRateSchedule::OneCycle);
+   learning_rate_schedule.set_maximum_factor(10.0);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(0.0) - 1.0) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(3.0) - 10.0) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(12.0)) < 1.0e-12, LOG);
+
+   // Warmup
+
+   learning_rate_schedule.set_schedule_method(LearningRateSchedule::Constant);
+   learning_rate_schedule.set_warmup_epochs(4.0);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(1.0) - 0.25) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(5.0) - 1.0) < 1.0e-12, LOG);
+}
+
+
+void LearningRateScheduleTest::test_update_selection_error()
+{
+   cout << "test_update_selection_error\n";
+
+   LearningRateSchedule learning_rate_schedule;
+
+   learning_rate_schedule.set_schedule_method(LearningRateSchedule::ReduceOnPlateau);
+   learning_rate_schedule.set_patience(2);
+   learning_rate_schedule.set_decay_rate(0.5);
+
+   // Test
+
+   learning_rate_schedule.update_selection_error(1.0);
+   learning_rate_schedule.update_selection_error(0.9);
+   learning_rate_schedule.update_selection_error(0.95);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(3.0) - 1.0) < 1.0e-12, LOG);
+
+   learning_rate_schedule.update_selection_error(0.95);
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(4.0) - 0.5) < 1.0e-12, LOG);
+
+   // Test
+
+   learning_rate_schedule.reset();
+
+   assert_true(abs(learning_rate_schedule.calculate_learning_rate_factor(0.0) - 1.0) < 1.0e-12, LOG);
+}
+
+
+void LearningRateScheduleTest::test_to_XML()
+{
+   cout << "test_to_XML\n";
+
+   LearningRateSchedule learning_rate_schedule;
+
+   tinyxml2::XMLDocument* document = learning_rate_schedule.to_XML();
+
+   assert_true(document != nullptr, LOG);
+
+   delete document;
+}
+
+
+void LearningRateScheduleTest::test_from_XML()
+{
+   cout << "test_from_XML\n";
+
+   LearningRateSchedule learning_rate_schedule1;
+   LearningRateSchedule learning_rate_schedule2;
+
+   learning_rate_schedule1.set_schedule_method(LearningRateSchedule::OneCycle);
+   learning_rate_schedule1.set_warmup_epochs(2.0);
+   learning_rate_schedule1.set_period_epochs(50.0);
+   learning_rate_schedule1.set_patience(7);
+
+   tinyxml2::XMLDocument* document = learning_rate_schedule1.to_XML();
+
+   learning_rate_schedule2.from_XML(*document);
+
+   delete document;
+
+   assert_true(learning_rate_schedule2.get_schedule_method() == LearningRateSchedule::OneCycle, LOG);
+   assert_true(abs(learning_rate_schedule2.get_warmup_epochs() - 2.0) < 1.0e-12, LOG);
+   assert_true(abs(learning_rate_schedule2.get_period_epochs() - 50.0) < 1.0e-12, LOG);
+   assert_true(learning_rate_schedule2.get_patience() == 7, LOG);
+}
+
+
+void LearningRateScheduleTest::run_test_case()
+{
+   cout << "Running learning rate schedule test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Set methods
+
+   test_set_schedule_method();
+
+   // Schedule methods
+
+   test_calculate_learning_rate_factor();
+
+   test_update_selection_error();
+
+   // Serialization methods
+
+   test_to_XML();
+   test_from_XML();
+
+   cout << "End of learning rate schedule test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2019 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -506,6 +506,118 @@ void LevenbergMarquardtAlgorithmTest::test_perform_Householder_QR_decomposition(
 }
 
 
+void LevenbergMarquardtAlgorithmTest::test_perform_Cholesky_decomposition()
+{
+   cout << "test_perform_Cholesky_decomposition\n";
+
+   LevenbergMarquardtAlgorithm lma;
+
+   Matrix<double> jacobian;
+   Matrix<double> a;
+   Vector<double> b;
+
+   Vector<double> x;
+
+   // Test
+
+   a.set(2, 2);
+   a.initialize_identity();
+
+   b.set(2, 1.0);
+
+   x = lma.perform_Cholesky_decomposition(a, b);
+
+   assert_true(x == 1.0, LOG);
+
+   // Test
+
+   jacobian.set(20, 10);
+   jacobian.randomize_normal();
+
+   a = dot(jacobian.calculate_transpose(), jacobian);
+   a.sum_diagonal(1.0e-3);
+
+   b.set(10);
+   b.randomize_normal();
+
+   x = lma.perform_Cholesky_decomposition(a, b);
+
+   assert_true(absolute_value(dot(a, x) - b) < 1.0e-6, LOG);
+   assert_true(absolute_value(x - lma.perform_Householder_QR_decomposition(a, b)) < 1.0e-6, LOG);
+
+   // Test
+
+   a.set(2, 2, 0.0);
+   a(0,0) = 1.0;
+   a(1,1) = -1.0;
+
+   b.set(2, 1.0);
+
+   x = lma.perform_Cholesky_decomposition(a, b);
+
+   assert_true(abs(x[0] - 1.0) < 1.0e-12, LOG);
+   assert_true(abs(x[1] + 1.0) < 1.0e-12, LOG);
+}
+
+
+void LevenbergMarquardtAlgorithmTest::test_perform_preconditioned_conjugate_gradient()
+{
+   cout << "test_perform_preconditioned_conjugate_gradient\n";
+
+   NeuralNetwork neural_network;
+
+   DataSet data_set;
+
+   SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+   LevenbergMarquardtAlgorithm lma(&sum_squared_error);
+   lma.set_display(false);
+
+   LossIndex::SecondOrderLoss terms_second_order_loss;
+
+   Vector<double> parameters_increment;
+
+   double old_loss;
+   double loss;
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Approximation, {2, 4, 1});
+   neural_network.randomize_parameters_normal();
+
+   data_set.set(20, 2, 1);
+   data_set.randomize_data_normal();
+   data_set.set_training();
+
+   lma.set_damping_parameter(1.0e-2);
+
+   terms_second_order_loss = sum_squared_error.calculate_terms_second_order_loss();
+
+   parameters_increment = lma.perform_preconditioned_conjugate_gradient(terms_second_order_loss.gradient,
+                                                                        terms_second_order_loss.hessian.get_diagonal());
+
+   terms_second_order_loss.hessian.sum_diagonal(lma.get_damping_parameter());
+
+   assert_true(l2_norm(dot(terms_second_order_loss.hessian, parameters_increment) + terms_second_order_loss.gradient)
+               <= 0.5*l2_norm(terms_second_order_loss.gradient) + 1.0e-6, LOG);
+
+   assert_true(dot(parameters_increment, terms_second_order_loss.gradient) < 0.0, LOG);
+
+   // Test
+
+   lma.set_matrix_free(true);
+   lma.set_maximum_epochs_number(5);
+
+   old_loss = sum_squared_error.calculate_training_loss();
+
+   lma.perform_training();
+
+   loss = sum_squared_error.calculate_training_loss();
+
+   assert_true(loss <= old_loss, LOG);
+}
+
+
 void LevenbergMarquardtAlgorithmTest::run_test_case()
 {
    cout << "Running Levenberg-Marquardt algorithm test case...\n";
@@ -555,6 +667,10 @@ void LevenbergMarquardtAlgorithmTest::run_test_case()
 
    test_perform_Householder_QR_decomposition();
 
+   test_perform_Cholesky_decomposition();
+
+   test_perform_preconditioned_conjugate_gradient();
+
    cout << "End of Levenberg-Marquardt algorithm test case.\n";
 }
 
@@ -83,6 +83,10 @@ public:
 
    void test_perform_Householder_QR_decomposition();
 
+   void test_perform_Cholesky_decomposition();
+
+   void test_perform_preconditioned_conjugate_gradient();
+
 
    // Unit testing methods
 
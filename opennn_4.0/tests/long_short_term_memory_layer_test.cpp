@@ -837,6 +837,162 @@ void LongShortTermMemoryLayerTest::test_calculate_outputs()
 }
 
 
+void LongShortTermMemoryLayerTest::test_calculate_outputs_sequences()
+{
+   cout << "test_calculate_outputs_sequences\n";
+
+   LongShortTermMemoryLayer long_short_term_memory_layer(2, 3);
+
+   Tensor<double> inputs(7, 2);
+
+   Tensor<double> outputs;
+
+   Vector<double> outputs_row;
+
+   // Test
+
+   long_short_term_memory_layer.set_timesteps(3);
+
+   long_short_term_memory_layer.randomize_parameters_normal();
+
+   inputs.randomize_uniform(-1.0, 1.0);
+
+   outputs = long_short_term_memory_layer.calculate_outputs(inputs);
+
+   assert_true(outputs.get_dimension(0) == 7, LOG);
+   assert_true(outputs.get_dimension(1) == 3, LOG);
+
+   // The batch holds the sequences {0,1,2}, {3,4,5} and the shorter {6}
+
+   for(size_t i = 0; i < 7; i++)
+   {
+      if(i%3 == 0)
+      {
+         long_short_term_memory_layer.initialize_hidden_states(0.0);
+         long_short_term_memory_layer.initialize_cell_states(0.0);
+      }
+
+      long_short_term_memory_layer.update_cell_states(inputs.get_row(i));
+      long_short_term_memory_layer.update_hidden_states(inputs.get_row(i));
+
+      outputs_row = long_short_term_memory_layer.get_hidden_states();
+
+      assert_true(l2_norm(outputs.get_row(i) - outputs_row) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   Tensor<double> sequences(2, 3, 2);
+
+   sequences.randomize_uniform(-1.0, 1.0);
+
+   outputs = long_short_term_memory_layer.calculate_outputs(sequences);
+
+   assert_true(outputs.get_dimensions_number() == 3, LOG);
+   assert_true(outputs.get_dimension(0) == 2, LOG);
+   assert_true(outputs.get_dimension(1) == 3, LOG);
+   assert_true(outputs.get_dimension(2) == 3, LOG);
+
+   // Each sequence starts from zero states, and each step is the one-instance output
+
+   for(size_t i = 0; i < 2; i++)
+   {
+      for(size_t j = 0; j < 3; j++)
+      {
+         Vector<double> inputs_step(2);
+
+         for(size_t k = 0; k < 2; k++) inputs_step[k] = sequences(i, j, k);
+
+         if(j == 0)
+         {
+            long_short_term_memory_layer.initialize_hidden_states(0.0);
+            long_short_term_memory_layer.initialize_cell_states(0.0);
+         }
+
+         long_short_term_memory_layer.update_cell_states(inputs_step);
+         long_short_term_memory_layer.update_hidden_states(inputs_step);
+
+         outputs_row = long_short_term_memory_layer.get_hidden_states();
+
+         for(size_t k = 0; k < 3; k++)
+         {
+            assert_true(abs(outputs(i, j, k) - outputs_row[k]) < 1.0e-12, LOG);
+         }
+      }
+   }
+
+   // Test
+
+   sequences.set(Vector<size_t>({2, 4, 2}));
+
+   sequences.randomize_uniform(-1.0, 1.0);
+
+   try
+   {
+      long_short_term_memory_layer.calculate_outputs(sequences);
+
+      assert_true(false, LOG);
+   }
+   catch(const logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+}
+
+
+void LongShortTermMemoryLayerTest::test_calculate_error_gradient_sequences()
+{
+   cout << "test_calculate_error_gradient_sequences\n";
+
+   LongShortTermMemoryLayer long_short_term_memory_layer(2, 3);
+
+   Tensor<double> inputs(7, 2);
+   Tensor<double> deltas(7, 3);
+
+   Vector<double> error_gradient;
+
+   Vector<double> sequences_error_gradient;
+
+   // Test
+
+   long_short_term_memory_layer.set_timesteps(3);
+
+   long_short_term_memory_layer.randomize_parameters_normal();
+
+   inputs.randomize_uniform(-1.0, 1.0);
+   deltas.randomize_uniform(-1.0, 1.0);
+
+   error_gradient = long_short_term_memory_layer.calculate_error_gradient(inputs, long_short_term_memory_layer.calculate_first_order_activations(inputs), deltas);
+
+   // The gradient of the batch is the sum of the gradients of its sequences, each one computed on its own
+
+   sequences_error_gradient.set(long_short_term_memory_layer.get_parameters_number(), 0.0);
+
+   const Vector<size_t> sequences_first_rows({0, 3, 6});
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      const size_t sequence_rows_number = min(static_cast<size_t>(3), 7 - sequences_first_rows[i]);
+
+      Tensor<double> sequence_inputs(sequence_rows_number, 2);
+      Tensor<double> sequence_deltas(sequence_rows_number, 3);
+
+      for(size_t j = 0; j < sequence_rows_number; j++)
+      {
+         sequence_inputs.set_row(j, inputs.get_row(sequences_first_rows[i]+j));
+         sequence_deltas.set_row(j, deltas.get_row(sequences_first_rows[i]+j));
+      }
+
+      const Layer::FirstOrderActivations sequence_first_order_activations = long_short_term_memory_layer.calculate_first_order_activations(sequence_inputs);
+
+      sequences_error_gradient += long_short_term_memory_layer.calculate_error_gradient(sequence_inputs, sequence_first_order_activations, sequence_deltas);
+   }
+
+   assert_true(error_gradient.size() == long_short_term_memory_layer.get_parameters_number(), LOG);
+   assert_true(l2_norm(error_gradient - sequences_error_gradient) < 1.0e-10, LOG);
+}
+
+
 void LongShortTermMemoryLayerTest::run_test_case()
 {
    cout << "Running long short term memory layer test case...\n";
@@ -909,6 +1065,9 @@ void LongShortTermMemoryLayerTest::run_test_case()
    // Calculate outputs
 
    test_calculate_outputs();
+   test_calculate_outputs_sequences();
+
+   test_calculate_error_gradient_sequences();
 
 
    cout << "End of long short term memory layer test case.\n";
@@ -97,6 +97,9 @@ public:
    // Calculate outputs
 
    void test_calculate_outputs();
+   void test_calculate_outputs_sequences();
+
+   void test_calculate_error_gradient_sequences();
 
    // Unit testing methods
 
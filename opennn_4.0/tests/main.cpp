@@ -22,6 +22,7 @@ int main()
 {
    cout <<
    "Open Neural Networks Library. Test Suite Application.\n"
+   "adaptive_moment_estimation\n"
    "bounding_layer\n"
    "conjugate_gradient\n"
    "correlations\n"
@@ -32,12 +33,15 @@ int main()
    "genetic_algorithm\n"
    "golden_section_order\n"
    "gradient_descent\n"
+   "evaluation_cache\n"
+   "checkpoint\n"
    "growing_inputs\n"
    "incremental_order\n"
    "instances\n"
    "inputs\n"
    "inputs_selection_algorithm\n"
    "learning_rate_algorithm\n"
+   "learning_rate_schedule\n"
    "levenberg_marquardt_algorithm\n"
    "linear_algebra\n"
    "long_short_term_memory_layer\n"
@@ -58,6 +62,7 @@ int main()
    "probabilistic_layer\n"
    "pruning_inputs\n"
    "quasi_newton_method\n"
+   "random\n"
    "recurrent_layer\n"
    "scaling_layer\n"
    "simulated_annealing_order\n"
@@ -85,7 +90,7 @@ int main()
 
    try
    {
-      srand(static_cast<unsigned>(time(nullptr)));
+      set_random_seed(static_cast<uint64_t>(time(nullptr)));
 
       string message;
 
@@ -111,6 +116,15 @@ int main()
          tests_failed_count += data_set_test.get_tests_failed_count();
       }
 
+      else if(test == "data_set_view" || test == "dsv")
+      {
+         DataSetViewTest data_set_view_test;
+         data_set_view_test.run_test_case();
+         tests_count += data_set_view_test.get_tests_count();
+         tests_passed_count += data_set_view_test.get_tests_passed_count();
+         tests_failed_count += data_set_view_test.get_tests_failed_count();
+      }
+
       else if(test == "linear_algebra" || test == "")
       {
          MetricsTest test;
@@ -156,6 +170,15 @@ int main()
          tests_failed_count += matrix_test.get_tests_failed_count();
       }
 
+      else if(test == "random" || test == "r")
+      {
+         RandomGeneratorTest random_generator_test;
+         random_generator_test.run_test_case();
+         tests_count += random_generator_test.get_tests_count();
+         tests_passed_count += random_generator_test.get_tests_passed_count();
+         tests_failed_count += random_generator_test.get_tests_failed_count();
+      }
+
       else if(test == "vector" || test == "v")
       {
          VectorTest vector_test;
@@ -323,6 +346,14 @@ int main()
         tests_passed_count += learning_rate_algorithm_test.get_tests_passed_count();
         tests_failed_count += learning_rate_algorithm_test.get_tests_failed_count();
       }
+      else if(test == "learning_rate_schedule" || test == "")
+      {
+        LearningRateScheduleTest learning_rate_schedule_test;
+        learning_rate_schedule_test.run_test_case();
+        tests_count += learning_rate_schedule_test.get_tests_count();
+        tests_passed_count += learning_rate_schedule_test.get_tests_passed_count();
+        tests_failed_count += learning_rate_schedule_test.get_tests_failed_count();
+      }
       else if(test == "gradient_descent" || test == "")
       {
         GradientDescentTest gradient_descent_test;
@@ -363,6 +394,14 @@ int main()
         tests_passed_count += stochastic_gradient_descent_test.get_tests_passed_count();
         tests_failed_count += stochastic_gradient_descent_test.get_tests_failed_count();
       }
+      else if(test == "adaptive_moment_estimation" || test == "")
+      {
+        AdaptiveMomentEstimationTest adaptive_moment_estimation_test;
+        adaptive_moment_estimation_test.run_test_case();
+        tests_count += adaptive_moment_estimation_test.get_tests_count();
+        tests_passed_count += adaptive_moment_estimation_test.get_tests_passed_count();
+        tests_failed_count += adaptive_moment_estimation_test.get_tests_failed_count();
+      }
       else if(test == "training_strategy" || test == "ts")
       {
         TrainingStrategyTest training_strategy_test;
@@ -399,6 +438,24 @@ int main()
         tests_failed_count += incremental_order_test.get_tests_failed_count();
       }
 
+      else if(test == "evaluation_cache" || test == "ec")
+      {
+        EvaluationCacheTest evaluation_cache_test;
+        evaluation_cache_test.run_test_case();
+        tests_count += evaluation_cache_test.get_tests_count();
+        tests_passed_count += evaluation_cache_test.get_tests_passed_count();
+        tests_failed_count += evaluation_cache_test.get_tests_failed_count();
+      }
+
+      else if(test == "checkpoint" || test == "cp")
+      {
+        CheckpointTest checkpoint_test;
+        checkpoint_test.run_test_case();
+        tests_count += checkpoint_test.get_tests_count();
+        tests_passed_count += checkpoint_test.get_tests_passed_count();
+        tests_failed_count += checkpoint_test.get_tests_failed_count();
+      }
+
       else if(test == "inputs_selection" || test == "is")
       {
         InputsSelectionTest inputs_selection_algorithm_test;
@@ -455,6 +512,14 @@ int main()
 
       else if(test == "suite" || test == "")
       {
+          // random
+
+          RandomGeneratorTest random_generator_test;
+          random_generator_test.run_test_case();
+          tests_count += random_generator_test.get_tests_count();
+          tests_passed_count += random_generator_test.get_tests_passed_count();
+          tests_failed_count += random_generator_test.get_tests_failed_count();
+
           // vector
 
           VectorTest vector_test;
@@ -513,6 +578,14 @@ int main()
           tests_passed_count += data_set_test.get_tests_passed_count();
           tests_failed_count += data_set_test.get_tests_failed_count();
 
+          // data set view
+
+          DataSetViewTest data_set_view_test;
+          data_set_view_test.run_test_case();
+          tests_count += data_set_view_test.get_tests_count();
+          tests_passed_count += data_set_view_test.get_tests_passed_count();
+          tests_failed_count += data_set_view_test.get_tests_failed_count();
+
           // N E U R A L   N E T W O R K   T E S T S
 
           // perceptron layer
@@ -615,6 +688,14 @@ int main()
           tests_passed_count += learning_rate_algorithm_test.get_tests_passed_count();
           tests_failed_count += learning_rate_algorithm_test.get_tests_failed_count();
 
+          // learning rate schedule
+
+          LearningRateScheduleTest learning_rate_schedule_test;
+          learning_rate_schedule_test.run_test_case();
+          tests_count += learning_rate_schedule_test.get_tests_count();
+          tests_passed_count += learning_rate_schedule_test.get_tests_passed_count();
+          tests_failed_count += learning_rate_schedule_test.get_tests_failed_count();
+
           // gradient descent
 
           GradientDescentTest gradient_descent_test;
@@ -654,6 +735,12 @@ int main()
           tests_passed_count += stochastic_gradient_descent_test.get_tests_passed_count();
           tests_failed_count += stochastic_gradient_descent_test.get_tests_failed_count();
 
+          AdaptiveMomentEstimationTest adaptive_moment_estimation_test;
+          adaptive_moment_estimation_test.run_test_case();
+          tests_count += adaptive_moment_estimation_test.get_tests_count();
+          tests_passed_count += adaptive_moment_estimation_test.get_tests_passed_count();
+          tests_failed_count += adaptive_moment_estimation_test.get_tests_failed_count();
+
           // training_strategy
 
           TrainingStrategyTest training_strategy_test;
@@ -688,6 +775,22 @@ int main()
           tests_passed_count += incremental_order_test.get_tests_passed_count();
           tests_failed_count += incremental_order_test.get_tests_failed_count();
 
+          // evaluation cache
+
+          EvaluationCacheTest evaluation_cache_test;
+          evaluation_cache_test.run_test_case();
+          tests_count += evaluation_cache_test.get_tests_count();
+          tests_passed_count += evaluation_cache_test.get_tests_passed_count();
+          tests_failed_count += evaluation_cache_test.get_tests_failed_count();
+
+          // checkpoint
+
+          CheckpointTest checkpoint_test;
+          checkpoint_test.run_test_case();
+          tests_count += checkpoint_test.get_tests_count();
+          tests_passed_count += checkpoint_test.get_tests_passed_count();
+          tests_failed_count += checkpoint_test.get_tests_failed_count();
+
           // input selection algorithm
 
           InputsSelectionTest inputs_selection_algorithm_test;
@@ -276,6 +276,20 @@ void MeanSquaredErrorTest::test_calculate_selection_error()
 
    assert_true(selection_error == 0.0, LOG);
 
+   // Test
+
+   neural_network.randomize_parameters_normal();
+
+   data_set.set(10, 1, 1);
+   data_set.randomize_data_normal();
+   data_set.set_selection();
+
+   selection_error = mean_squared_error.calculate_selection_error();
+
+   const double selection_error_estimate
+           = mean_squared_error.calculate_selection_error_estimate(neural_network.get_parameters(), data_set.get_selection_batches());
+
+   assert_true(abs(selection_error - selection_error_estimate) < 1.0e-12, LOG);
 }
 
 
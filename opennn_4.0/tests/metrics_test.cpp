@@ -222,6 +222,38 @@ void MetricsTest::test_eigenvectors()
 }
 
 
+void MetricsTest::test_truncated_principal_components()
+{
+    cout << "test_truncated_principal_components\n";
+
+    Matrix<double> data;
+    Matrix<double> principal_components;
+    Vector<double> variances;
+
+    // Test
+
+    data.set(4, 3, 0.0);
+    data(0,0) = 2.0;
+    data(1,0) = -2.0;
+    data(2,1) = 1.0;
+    data(3,1) = -1.0;
+
+    principal_components = truncated_principal_components(data, 1, variances);
+
+    assert_true(principal_components.get_rows_number() == 1, LOG);
+    assert_true(principal_components.get_columns_number() == 3, LOG);
+    assert_true(abs(abs(principal_components(0,0)) - 1.0) < 1.0e-6, LOG);
+    assert_true(abs(variances[0] - 8.0/3.0) < 1.0e-6, LOG);
+
+    // Test
+
+    principal_components = truncated_principal_components(data, 2, variances);
+
+    assert_true(abs(abs(principal_components(1,1)) - 1.0) < 1.0e-6, LOG);
+    assert_true(abs(variances[1] - 2.0/3.0) < 1.0e-6, LOG);
+}
+
+
 void MetricsTest::test_direct()
 {
     cout << "test_direct\n";
@@ -400,6 +432,8 @@ void MetricsTest::run_test_case()
 
    test_eigenvectors();
 
+   test_truncated_principal_components();
+
    test_direct();
 
 
@@ -74,6 +74,8 @@ public:
 
    void test_eigenvectors();
 
+   void test_truncated_principal_components();
+
    void test_direct();
 
    // Vector distances
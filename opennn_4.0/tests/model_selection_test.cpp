@@ -116,6 +116,77 @@ void ModelSelectionTest::test_perform_neurons_selection()
 }
 
 
+void ModelSelectionTest::test_perform_k_fold_cross_validation()
+{
+    cout << "test_perform_k_fold_cross_validation\n";
+
+    DataSet ds;
+
+    ds.generate_sum_data(20,2);
+
+    const Vector<DataSet::InstanceUse> instances_uses = ds.get_instances_uses();
+
+    NeuralNetwork nn(NeuralNetwork::Approximation, {1, 2, 1});
+
+    TrainingStrategy ts(&nn, &ds);
+
+    ts.set_optimization_method(TrainingStrategy::QUASI_NEWTON_METHOD);
+    ts.get_quasi_Newton_method_pointer()->set_maximum_epochs_number(10);
+    ts.set_display(false);
+
+    ModelSelection model_selection(&ts);
+
+    model_selection.set_display(false);
+
+    // Test
+
+    set_random_seed(1);
+
+    model_selection.set_workers_number(1);
+
+    const Vector<NeuralNetwork> ensemble = model_selection.perform_k_fold_cross_validation(4);
+
+    const Vector<double> parameters = nn.get_parameters();
+
+    assert_true(ensemble.size() == 4, LOG);
+    assert_true(ds.get_instances_uses() == instances_uses, LOG);
+
+    // Test
+
+    set_random_seed(1);
+
+    model_selection.set_workers_number(4);
+
+    const Vector<NeuralNetwork> parallel_ensemble = model_selection.perform_k_fold_cross_validation(4);
+
+    assert_true(parallel_ensemble.size() == 4, LOG);
+    assert_true(ds.get_instances_uses() == instances_uses, LOG);
+    assert_true(nn.get_parameters() == parameters, LOG);
+
+    for(size_t i = 0; i < 4; i++)
+    {
+        assert_true(parallel_ensemble[i].get_parameters() == ensemble[i].get_parameters(), LOG);
+    }
+
+    // Test
+
+    set_random_seed(1);
+
+    model_selection.set_workers_number(0);
+
+    assert_true(model_selection.get_workers_number() == 1, LOG);
+
+    const Vector<NeuralNetwork> sequential_ensemble = model_selection.perform_k_fold_cross_validation(4);
+
+    assert_true(sequential_ensemble.size() == 4, LOG);
+
+    for(size_t i = 0; i < 4; i++)
+    {
+        assert_true(sequential_ensemble[i].get_parameters() == ensemble[i].get_parameters(), LOG);
+    }
+}
+
+
 void ModelSelectionTest::test_to_XML()   
 {
     cout << "test_to_XML\n";
@@ -206,6 +277,10 @@ void ModelSelectionTest::run_test_case()
 
     test_perform_neurons_selection();
 
+    // Cross validation methods
+
+    test_perform_k_fold_cross_validation();
+
     // Serialization methods
 
     test_to_XML();
@@ -46,6 +46,10 @@ public:
 
    void test_perform_neurons_selection();
 
+   // Cross validation methods
+
+   void test_perform_k_fold_cross_validation();
+
    // Serialization methods
 
    void test_to_XML();   
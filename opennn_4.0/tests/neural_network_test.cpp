@@ -92,6 +92,25 @@ void NeuralNetworkTest::test_assignment_operator()
 
    NeuralNetwork nn1;
    NeuralNetwork nn2 = nn1;
+
+   // Deep copy
+
+   NeuralNetwork neural_network_1(NeuralNetwork::Approximation, {1,2,1});
+   NeuralNetwork neural_network_2(NeuralNetwork::Approximation, {3,4,5});
+
+   neural_network_2 = neural_network_1;
+
+   assert_true(neural_network_2.get_layers_number() == neural_network_1.get_layers_number(), LOG);
+   assert_true(neural_network_2.get_layer_pointer(1) != neural_network_1.get_layer_pointer(1), LOG);
+   assert_true(neural_network_2.get_parameters() == neural_network_1.get_parameters(), LOG);
+
+   // Self assignment
+
+   NeuralNetwork& neural_network_3 = neural_network_2;
+
+   neural_network_2 = neural_network_3;
+
+   assert_true(neural_network_2.get_layers_number() == neural_network_1.get_layers_number(), LOG);
 }
 
 void NeuralNetworkTest::test_get_display()
@@ -236,6 +255,160 @@ void NeuralNetworkTest::test_set_parameters()
    assert_true(parameters[parameters_number-1] - parameters_number - 1.0 < numeric_limits<double>::min(), LOG);
 }
 
+void NeuralNetworkTest::test_warm_start_inputs()
+{
+   cout << "test_warm_start_inputs\n";
+
+   NeuralNetwork neural_network;
+
+   Matrix<double> previous_synaptic_weights;
+   Vector<double> previous_biases;
+   Vector<double> previous_output_parameters;
+
+   Matrix<double> synaptic_weights;
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Approximation, {3, 2, 1});
+   neural_network.randomize_parameters_normal();
+
+   PerceptronLayer* perceptron_layer_pointer = neural_network.get_first_perceptron_layer_pointer();
+
+   previous_synaptic_weights = perceptron_layer_pointer->get_synaptic_weights();
+   previous_biases = perceptron_layer_pointer->get_biases();
+   previous_output_parameters = neural_network.get_trainable_layers_pointers()[1]->get_parameters();
+
+   neural_network.warm_start_inputs({10, 11, 12}, {10, 12, 13});
+
+   synaptic_weights = perceptron_layer_pointer->get_synaptic_weights();
+
+   assert_true(neural_network.get_inputs_number() == 3, LOG);
+   assert_true(synaptic_weights.get_row(0) == previous_synaptic_weights.get_row(0), LOG);
+   assert_true(synaptic_weights.get_row(1) == previous_synaptic_weights.get_row(2), LOG);
+   assert_true(synaptic_weights.get_row(2) == Vector<double>(2, 0.0), LOG);
+   assert_true(perceptron_layer_pointer->get_biases() == previous_biases, LOG);
+   assert_true(neural_network.get_trainable_layers_pointers()[1]->get_parameters() == previous_output_parameters, LOG);
+
+   // Test
+
+   previous_synaptic_weights = synaptic_weights;
+
+   neural_network.warm_start_inputs({10, 12, 13}, {13});
+
+   synaptic_weights = perceptron_layer_pointer->get_synaptic_weights();
+
+   assert_true(neural_network.get_inputs_number() == 1, LOG);
+   assert_true(synaptic_weights.get_row(0) == previous_synaptic_weights.get_row(2), LOG);
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Forecasting, {2, 3, 2, 1});
+
+   neural_network.randomize_parameters_normal();
+
+   previous_output_parameters = neural_network.get_trainable_layers_pointers()[1]->get_parameters();
+
+   neural_network.warm_start_inputs({0, 1}, {1, 2, 3});
+
+   assert_true(neural_network.get_inputs_number() == 3, LOG);
+   assert_true(neural_network.get_trainable_layers_pointers()[0]->get_inputs_number() == 3, LOG);
+   assert_true(neural_network.get_trainable_layers_pointers()[1]->get_parameters() == previous_output_parameters, LOG);
+}
+
+
+void NeuralNetworkTest::test_warm_start_neurons()
+{
+   cout << "test_warm_start_neurons\n";
+
+   NeuralNetwork neural_network;
+
+   Tensor<double> inputs;
+   Tensor<double> previous_outputs;
+   Tensor<double> outputs;
+
+   Vector<double> previous_biases;
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Approximation, {2, 3, 1});
+   neural_network.randomize_parameters_normal();
+
+   inputs.set({1, 2}, 0.5);
+
+   previous_outputs = neural_network.calculate_outputs(inputs);
+
+   previous_biases = neural_network.get_first_perceptron_layer_pointer()->get_biases();
+
+   neural_network.warm_start_neurons(0, 4);
+
+   outputs = neural_network.calculate_outputs(inputs);
+
+   assert_true(neural_network.get_first_perceptron_layer_pointer()->get_neurons_number() == 4, LOG);
+   assert_true(neural_network.get_first_perceptron_layer_pointer()->get_biases().get_first(3) == previous_biases, LOG);
+   assert_true(abs(outputs(0,0) - previous_outputs(0,0)) < 1.0e-12, LOG);
+
+   // Test
+
+   neural_network.warm_start_neurons(0, 2);
+
+   assert_true(neural_network.get_first_perceptron_layer_pointer()->get_neurons_number() == 2, LOG);
+   assert_true(neural_network.get_trainable_layers_pointers()[1]->get_inputs_number() == 2, LOG);
+   assert_true(neural_network.get_first_perceptron_layer_pointer()->get_biases() == previous_biases.get_first(2), LOG);
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Forecasting, {2, 3, 2, 1});
+
+   neural_network.randomize_parameters_normal();
+
+   const Vector<double> previous_output_parameters = neural_network.get_trainable_layers_pointers()[2]->get_parameters();
+
+   neural_network.warm_start_neurons(0, 4);
+
+   assert_true(neural_network.get_trainable_layers_pointers()[0]->get_neurons_number() == 4, LOG);
+   assert_true(neural_network.get_trainable_layers_pointers()[1]->get_inputs_number() == 4, LOG);
+   assert_true(neural_network.get_trainable_layers_pointers()[2]->get_parameters() == previous_output_parameters, LOG);
+}
+
+
+void NeuralNetworkTest::test_scoped_parameters()
+{
+   cout << "test_scoped_parameters\n";
+
+   NeuralNetwork neural_network(NeuralNetwork::Approximation, {2, 3, 1});
+   neural_network.randomize_parameters_normal();
+
+   const Vector<double> parameters = neural_network.get_parameters();
+
+   // Test
+
+   {
+      const ScopedParameters scoped_parameters(&neural_network);
+
+      neural_network.initialize_parameters(0.0);
+
+      assert_true(scoped_parameters.get_parameters() == parameters, LOG);
+   }
+
+   assert_true(neural_network.get_parameters() == parameters, LOG);
+
+   // Test
+
+   try
+   {
+      const ScopedParameters scoped_parameters(&neural_network);
+
+      neural_network.initialize_parameters(0.0);
+
+      throw logic_error("Exception in scope");
+   }
+   catch(const logic_error&)
+   {
+   }
+
+   assert_true(neural_network.get_parameters() == parameters, LOG);
+}
+
 
 void NeuralNetworkTest::test_initialize_parameters()
 {
@@ -1147,6 +1320,68 @@ void NeuralNetworkTest::test_calculate_outputs()
 
 }
 
+void NeuralNetworkTest::test_fuse_for_inference()
+{
+   cout << "test_fuse_for_inference\n";
+
+   NeuralNetwork neural_network;
+
+   Vector<Descriptives> inputs_descriptives(3);
+   Vector<Descriptives> outputs_descriptives(2);
+
+   Tensor<double> inputs;
+   Tensor<double> outputs;
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Approximation, {3, 4, 2});
+   neural_network.randomize_parameters_normal();
+
+   inputs_descriptives[0] = Descriptives(-1.0, 2.0, 0.5, 1.0);
+   inputs_descriptives[1] = Descriptives(0.0, 4.0, 1.0, 2.0);
+   inputs_descriptives[2] = Descriptives(-3.0, 1.0, -1.0, 0.5);
+
+   neural_network.get_scaling_layer_pointer()->set_descriptives(inputs_descriptives);
+   neural_network.get_scaling_layer_pointer()->set_scaling_methods(Vector<string>({"MinimumMaximum", "MeanStandardDeviation", "StandardDeviation"}));
+
+   outputs_descriptives[0] = Descriptives(1.0, 5.0, 2.0, 3.0);
+   outputs_descriptives[1] = Descriptives(-2.0, 0.0, -1.0, 0.5);
+
+   neural_network.get_unscaling_layer_pointer()->set_descriptives(outputs_descriptives);
+   neural_network.get_unscaling_layer_pointer()->set_unscaling_method(UnscalingLayer::MinimumMaximum);
+
+   inputs.set(Vector<size_t>({4, 3}));
+   inputs.randomize_normal();
+
+   outputs = neural_network.calculate_outputs(inputs);
+
+   neural_network.fuse_for_inference();
+
+   assert_true(!neural_network.has_scaling_layer(), LOG);
+   assert_true(!neural_network.has_unscaling_layer(), LOG);
+   assert_true(neural_network.has_bounding_layer(), LOG);
+
+   assert_true(absolute_value(neural_network.calculate_outputs(inputs).to_vector() - outputs.to_vector()) < 1.0e-12, LOG);
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Approximation, {3, 4, 2});
+   neural_network.randomize_parameters_normal();
+
+   neural_network.get_unscaling_layer_pointer()->set_descriptives(outputs_descriptives);
+   neural_network.get_unscaling_layer_pointer()->set_unscaling_method(UnscalingLayer::Logarithmic);
+
+   outputs = neural_network.calculate_outputs(inputs);
+
+   neural_network.fuse_for_inference();
+
+   assert_true(!neural_network.has_scaling_layer(), LOG);
+   assert_true(neural_network.has_unscaling_layer(), LOG);
+
+   assert_true(absolute_value(neural_network.calculate_outputs(inputs).to_vector() - outputs.to_vector()) < 1.0e-12, LOG);
+}
+
+
 void NeuralNetworkTest::test_calculate_trainable_outputs()
 {
    cout << "test_calculate_trainable_outputs\n";
@@ -1527,6 +1762,8 @@ void NeuralNetworkTest::run_test_case()
    test_calculate_outputs();
    test_calculate_trainable_outputs();
 
+   test_fuse_for_inference();
+
    // Display messages
 
    test_get_display();
@@ -1544,6 +1781,11 @@ void NeuralNetworkTest::run_test_case()
 
    test_set_parameters();
 
+   test_warm_start_inputs();
+   test_warm_start_neurons();
+
+   test_scoped_parameters();
+
    // Display messages
 
    test_set_display();
@@ -62,6 +62,11 @@ public:
 
    void test_set_parameters();
 
+   void test_warm_start_inputs();
+   void test_warm_start_neurons();
+
+   void test_scoped_parameters();
+
    // Display messages
 
    void test_set_display_inputs_warning();
@@ -82,6 +87,8 @@ public:
    void test_calculate_trainable_outputs();
    void test_calculate_outputs();
 
+   void test_fuse_for_inference();
+
    // Expression methods
 
    // XML expression methods
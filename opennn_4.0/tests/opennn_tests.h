@@ -15,6 +15,7 @@
 
 #include "unit_testing.h"
 
+#include "random_test.h"
 #include "vector_test.h"
 #include "matrix_test.h"
 #include "tensor_test.h"
@@ -25,6 +26,7 @@
 #include "functions_test.h"
 
 #include "data_set_test.h"
+#include "data_set_view_test.h"
 
 #include "perceptron_layer_test.h"
 #include "convolutional_layer_test.h"
@@ -45,8 +47,10 @@
 #include "cross_entropy_error_test.h"
 
 #include "learning_rate_algorithm_test.h"
+#include "learning_rate_schedule_test.h"
 #include "gradient_descent_test.h"
 #include "stochastic_gradient_descent_test.h"
+#include "adaptive_moment_estimation_test.h"
 #include "conjugate_gradient_test.h"
 #include "quasi_newton_method_test.h"
 #include "levenberg_marquardt_algorithm_test.h"
@@ -56,6 +60,8 @@
 #include "model_selection_test.h"
 #include "neurons_selection_test.h"
 #include "incremental_neurons_test.h"
+#include "evaluation_cache_test.h"
+#include "checkpoint_test.h"
 #include "inputs_selection_test.h"
 #include "growing_inputs_test.h"
 #include "pruning_inputs_test.h"
@@ -260,12 +260,114 @@ void QuasiNewtonMethodTest::test_calculate_inverse_hessian_approximation()
 }
 
 
+void QuasiNewtonMethodTest::test_update_inverse_hessian_approximation()
+{
+   cout << "test_update_inverse_hessian_approximation\n";
+
+   QuasiNewtonMethod quasi_newton_method;
+
+   Vector<double> old_parameters({0.0, 0.0, 0.0});
+   Vector<double> parameters({1.0, 0.5, -0.5});
+   Vector<double> old_gradient({0.0, 0.0, 0.0});
+   Vector<double> gradient({2.0, 0.25, -1.0});
+
+   Matrix<double> old_inverse_hessian(3, 3, 0.1);
+   old_inverse_hessian(0,0) = 1.0;
+   old_inverse_hessian(1,1) = 2.0;
+   old_inverse_hessian(2,2) = 0.5;
+
+   Matrix<double> inverse_hessian;
+
+   // Test
+
+   quasi_newton_method.set_inverse_hessian_approximation_method(QuasiNewtonMethod::BFGS);
+
+   inverse_hessian = old_inverse_hessian;
+
+   quasi_newton_method.update_inverse_hessian_approximation(old_parameters, parameters, old_gradient, gradient, inverse_hessian);
+
+   assert_true(absolute_value(inverse_hessian - quasi_newton_method.calculate_BFGS_inverse_hessian(old_parameters, parameters, old_gradient, gradient, old_inverse_hessian)) < 1.0e-12, LOG);
+   assert_true(absolute_value(dot(inverse_hessian, gradient - old_gradient) - (parameters - old_parameters)) < 1.0e-12, LOG);
+   assert_true(inverse_hessian.is_symmetric(), LOG);
+
+   // Test
+
+   quasi_newton_method.set_inverse_hessian_approximation_method(QuasiNewtonMethod::DFP);
+
+   inverse_hessian = old_inverse_hessian;
+
+   quasi_newton_method.update_inverse_hessian_approximation(old_parameters, parameters, old_gradient, gradient, inverse_hessian);
+
+   assert_true(absolute_value(dot(inverse_hessian, gradient - old_gradient) - (parameters - old_parameters)) < 1.0e-12, LOG);
+   assert_true(inverse_hessian.is_symmetric(), LOG);
+}
+
+
 void QuasiNewtonMethodTest::test_calculate_training_direction()
 {
    cout << "test_calculate_training_direction\n";
 }
 
 
+void QuasiNewtonMethodTest::test_calculate_limited_memory_training_direction()
+{
+   cout << "test_calculate_limited_memory_training_direction\n";
+
+   QuasiNewtonMethod quasi_newton_method;
+
+   Vector<Vector<double>> parameters_differences;
+   Vector<Vector<double>> gradient_differences;
+
+   Vector<double> gradient({0.3, -0.7});
+
+   Vector<double> training_direction;
+
+   // Test
+
+   training_direction = quasi_newton_method.calculate_limited_memory_training_direction(gradient, parameters_differences, gradient_differences);
+
+   assert_true(absolute_value(training_direction + normalized(gradient)) < 1.0e-12, LOG);
+
+   // Test
+
+   parameters_differences.push_back(Vector<double>({1.0, 1.0}));
+   gradient_differences.push_back(Vector<double>({1.0, 0.0}));
+
+   Matrix<double> inverse_hessian(2, 2);
+   inverse_hessian.initialize_identity();
+
+   inverse_hessian = quasi_newton_method.calculate_BFGS_inverse_hessian(Vector<double>(2, 0.0), parameters_differences[0],
+                                                                        Vector<double>(2, 0.0), gradient_differences[0],
+                                                                        inverse_hessian);
+
+   training_direction = quasi_newton_method.calculate_limited_memory_training_direction(gradient, parameters_differences, gradient_differences);
+
+   assert_true(absolute_value(training_direction - quasi_newton_method.calculate_training_direction(gradient, inverse_hessian)) < 1.0e-12, LOG);
+
+   // Test
+
+   DataSet data_set(2, 1, 1);
+   data_set.randomize_data_normal();
+
+   NeuralNetwork neural_network(NeuralNetwork::Approximation, {1, 1, 1});
+   neural_network.initialize_parameters(3.1415927);
+
+   SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+   quasi_newton_method.set_loss_index_pointer(&sum_squared_error);
+   quasi_newton_method.set_inverse_hessian_approximation_method(QuasiNewtonMethod::LBFGS);
+   quasi_newton_method.set_limited_memory_size(3);
+   quasi_newton_method.set_maximum_epochs_number(10);
+   quasi_newton_method.set_display(false);
+
+   const double old_loss = sum_squared_error.calculate_training_loss();
+
+   quasi_newton_method.perform_training();
+
+   assert_true(sum_squared_error.calculate_training_loss() < old_loss, LOG);
+}
+
+
 void QuasiNewtonMethodTest::test_perform_training()
 {
    cout << "test_perform_training\n";
@@ -412,6 +514,21 @@ void QuasiNewtonMethodTest::test_load()
    quasi_newton_method.from_XML(*document);
 
    delete document;
+
+   // Test
+
+   quasi_newton_method.set_inverse_hessian_approximation_method(QuasiNewtonMethod::LBFGS);
+   quasi_newton_method.set_limited_memory_size(7);
+
+   document = quasi_newton_method.to_XML();
+
+   QuasiNewtonMethod quasi_newton_method_copy;
+   quasi_newton_method_copy.from_XML(*document);
+
+   assert_true(quasi_newton_method_copy.get_inverse_hessian_approximation_method() == QuasiNewtonMethod::LBFGS, LOG);
+   assert_true(quasi_newton_method_copy.get_limited_memory_size() == 7, LOG);
+
+   delete document;
 }
 
 
@@ -448,7 +565,9 @@ void QuasiNewtonMethodTest::run_test_case()
    test_calculate_BFGS_inverse_hessian_approximation();
 
    test_calculate_inverse_hessian_approximation();
+   test_update_inverse_hessian_approximation();
    test_calculate_training_direction();
+   test_calculate_limited_memory_training_direction();
 
    test_perform_training();
 
@@ -57,7 +57,9 @@ public:
    void test_calculate_BFGS_inverse_hessian_approximation();
 
    void test_calculate_inverse_hessian_approximation();
+   void test_update_inverse_hessian_approximation();
    void test_calculate_training_direction();
+   void test_calculate_limited_memory_training_direction();
 
    void test_perform_training();
 
@@ -0,0 +1,362 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   R A N D O M   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "random_test.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+RandomGeneratorTest::RandomGeneratorTest() : UnitTesting()
+{
+}
+
+
+RandomGeneratorTest::~RandomGeneratorTest()
+{
+}
+
+
+void RandomGeneratorTest::test_constructor()
+{
+   cout << "test_constructor\n";
+
+   // Default constructor
+
+   RandomGenerator generator_1;
+
+   assert_true(generator_1.get_seed() == RandomGenerator::default_seed, LOG);
+   assert_true(generator_1.get_stream() == 0, LOG);
+   assert_true(generator_1.get_counter() == 0, LOG);
+
+   // Seed constructor
+
+   RandomGenerator generator_2(7, 2);
+
+   assert_true(generator_2.get_seed() == 7, LOG);
+   assert_true(generator_2.get_stream() == 2, LOG);
+   assert_true(generator_2.get_counter() == 0, LOG);
+}
+
+
+void RandomGeneratorTest::test_destructor()
+{
+   cout << "test_destructor\n";
+}
+
+
+void RandomGeneratorTest::test_set()
+{
+   cout << "test_set\n";
+
+   RandomGenerator generator_1(1);
+   RandomGenerator generator_2(2);
+
+   // Test
+
+   generator_1();
+
+   generator_1.set(2);
+
+   assert_true(generator_1.get_counter() == 0, LOG);
+   assert_true(generator_1() == generator_2(), LOG);
+
+   // Test
+
+   generator_1.set(2, 1);
+   generator_2.set(2, 0);
+
+   assert_true(generator_1() != generator_2(), LOG);
+}
+
+
+void RandomGeneratorTest::test_set_counter()
+{
+   cout << "test_set_counter\n";
+
+   RandomGenerator generator_1(3);
+   RandomGenerator generator_2(3);
+
+   Vector<uint64_t> numbers(5);
+
+   // Test
+
+   for(size_t i = 0; i < 5; i++)
+   {
+      numbers[i] = generator_1();
+   }
+
+   generator_2.set_counter(3);
+
+   assert_true(generator_2() == numbers[3], LOG);
+   assert_true(generator_2() == numbers[4], LOG);
+   assert_true(generator_2() == generator_1(), LOG);
+}
+
+
+void RandomGeneratorTest::test_calculate_uniform()
+{
+   cout << "test_calculate_uniform\n";
+
+   RandomGenerator generator;
+
+   Vector<double> numbers(1000);
+
+   // Test
+
+   for(size_t i = 0; i < 1000; i++)
+   {
+      numbers[i] = generator.calculate_uniform();
+   }
+
+   assert_true(minimum(numbers) >= 0.0, LOG);
+   assert_true(maximum(numbers) < 1.0, LOG);
+   assert_true(abs(mean(numbers) - 0.5) < 0.05, LOG);
+
+   // Test
+
+   for(size_t i = 0; i < 1000; i++)
+   {
+      numbers[i] = generator.calculate_uniform(-2.0, -1.0);
+   }
+
+   assert_true(minimum(numbers) >= -2.0, LOG);
+   assert_true(maximum(numbers) < -1.0, LOG);
+}
+
+
+void RandomGeneratorTest::test_calculate_normal()
+{
+   cout << "test_calculate_normal\n";
+
+   RandomGenerator generator;
+
+   Vector<double> numbers(1000);
+
+   // Test
+
+   for(size_t i = 0; i < 1000; i++)
+   {
+      numbers[i] = generator.calculate_normal(1.0, 2.0);
+   }
+
+   assert_true(abs(mean(numbers) - 1.0) < 0.2, LOG);
+   assert_true(abs(standard_deviation(numbers) - 2.0) < 0.2, LOG);
+}
+
+
+void RandomGeneratorTest::test_calculate_index()
+{
+   cout << "test_calculate_index\n";
+
+   RandomGenerator generator;
+
+   Vector<size_t> occurrences(4, 0);
+
+   // Test
+
+   for(size_t i = 0; i < 1000; i++)
+   {
+      occurrences[generator.calculate_index(4)]++;
+   }
+
+   assert_true(occurrences.calculate_sum() == 1000, LOG);
+   assert_true(minimum(occurrences) > 200, LOG);
+
+   // Test
+
+   assert_true(generator.calculate_index(1) == 0, LOG);
+   assert_true(generator.calculate_index(0) == 0, LOG);
+
+   // Test
+
+   assert_true(calculate_random_uniform<size_t>(1, 1000) != calculate_random_uniform<size_t>(1, 1000), LOG);
+}
+
+
+void RandomGeneratorTest::test_split()
+{
+   cout << "test_split\n";
+
+   RandomGenerator generator_1(5);
+   RandomGenerator generator_2(5);
+
+   // Test
+
+   RandomGenerator split_generator_1 = generator_1.split(1);
+   RandomGenerator split_generator_2 = generator_2.split(1);
+
+   assert_true(split_generator_1.get_stream() == 1, LOG);
+   assert_true(split_generator_1() == split_generator_2(), LOG);
+   assert_true(generator_1.get_counter() == 1, LOG);
+
+   // Test
+
+   RandomGenerator split_generator_3 = generator_1.split(2);
+
+   assert_true(split_generator_3() != split_generator_1(), LOG);
+}
+
+
+void RandomGeneratorTest::test_scoped_random_generator()
+{
+   cout << "test_scoped_random_generator\n";
+
+   RandomGenerator& thread_generator = get_random_generator();
+
+   const uint64_t counter = thread_generator.get_counter();
+
+   RandomGenerator generator(9);
+
+   // Test
+
+   {
+      ScopedRandomGenerator scoped_generator(generator);
+
+      assert_true(&get_random_generator() == &generator, LOG);
+
+      calculate_random_normal(0.0, 1.0);
+   }
+
+   assert_true(&get_random_generator() == &thread_generator, LOG);
+   assert_true(thread_generator.get_counter() == counter, LOG);
+   assert_true(generator.get_counter() == 2, LOG);
+
+   // Test
+
+   Vector<uint64_t> numbers(2);
+
+   thread t([&]()
+   {
+      RandomGenerator thread_generator_copy(generator);
+
+      ScopedRandomGenerator scoped_generator(thread_generator_copy);
+
+      numbers[0] = get_random_generator()();
+   });
+
+   t.join();
+
+   numbers[1] = generator();
+
+   assert_true(numbers[0] == numbers[1], LOG);
+}
+
+
+void RandomGeneratorTest::test_set_random_seed()
+{
+   cout << "test_set_random_seed\n";
+
+   Vector<double> vector_1(10);
+   Vector<double> vector_2(10);
+
+   // Test
+
+   set_random_seed(11);
+
+   vector_1.randomize_normal();
+
+   set_random_seed(11);
+
+   vector_2.randomize_normal();
+
+   assert_true(vector_1 == vector_2, LOG);
+
+   // Test
+
+   set_random_seed(12);
+
+   vector_2.randomize_normal();
+
+   assert_true(vector_1 != vector_2, LOG);
+
+   // Test
+
+   Vector<uint64_t> numbers(2);
+
+   atomic<size_t> step(0);
+
+   thread t([&]()
+   {
+      numbers[0] = get_random_generator()();
+
+      step = 1;
+
+      while(step != 2) this_thread::yield();
+
+      numbers[1] = get_random_generator()();
+   });
+
+   while(step != 1) this_thread::yield();
+
+   set_random_seed(12);
+
+   step = 2;
+
+   t.join();
+
+   assert_true(numbers[0] == numbers[1], LOG);
+
+#ifdef _OPENMP
+
+   // Test
+
+   Vector<uint64_t> numbers_1(4);
+   Vector<uint64_t> numbers_2(4);
+
+   set_random_seed(13);
+
+   #pragma omp parallel num_threads(4)
+   {
+      numbers_1[static_cast<size_t>(omp_get_thread_num())] = get_random_generator()();
+   }
+
+   set_random_seed(13);
+
+   #pragma omp parallel num_threads(4)
+   {
+      numbers_2[static_cast<size_t>(omp_get_thread_num())] = get_random_generator()();
+   }
+
+   assert_true(numbers_1 == numbers_2, LOG);
+
+#endif
+}
+
+
+void RandomGeneratorTest::run_test_case()
+{
+   cout << "Running random generator test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Set methods
+
+   test_set();
+   test_set_counter();
+
+   // Random numbers methods
+
+   test_calculate_uniform();
+   test_calculate_normal();
+   test_calculate_index();
+
+   test_split();
+
+   // Random generator of the current thread
+
+   test_scoped_random_generator();
+   test_set_random_seed();
+
+   cout << "End of random generator test case.\n";
+}
+
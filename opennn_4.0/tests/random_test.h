@@ -0,0 +1,63 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   R A N D O M   T E S T   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef RANDOMTEST_H
+#define RANDOMTEST_H
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class RandomGeneratorTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   explicit RandomGeneratorTest();
+
+   virtual ~RandomGeneratorTest();
+
+   // Constructor and destructor methods
+
+   void test_constructor();
+   void test_destructor();
+
+   // Set methods
+
+   void test_set();
+   void test_set_counter();
+
+   // Random numbers methods
+
+   void test_calculate_uniform();
+   void test_calculate_normal();
+   void test_calculate_index();
+
+   void test_split();
+
+   // Random generator of the current thread
+
+   void test_scoped_random_generator();
+   void test_set_random_seed();
+
+   // Unit testing methods
+
+   void run_test_case();
+
+};
+
+}
+
+#endif
@@ -68,6 +68,9 @@ public:
    void test_calculate_combinations();
 
    void test_calculate_outputs();
+   void test_calculate_outputs_sequences();
+
+   void test_calculate_error_gradient_sequences();
 
    // Unit testing methods
 
@@ -277,6 +277,7 @@ void ScalingLayerTest::test_calculate_outputs()
    ScalingLayer scaling_layer;
    
    Tensor<double> inputs;
+   Tensor<double> outputs;
 
    scaling_layer.set_display(false);
 
@@ -299,18 +300,133 @@ void ScalingLayerTest::test_calculate_outputs()
    inputs.set({1,1}, 0.0);
 
    assert_true(scaling_layer.calculate_outputs(inputs) == inputs, LOG);
+
+   // Test
+
+   scaling_layer.set(2);
+
+   scaling_layer.set_descriptives({Descriptives(-1.0, 3.0, 0.5, 1.5), Descriptives(2.0, 2.0, 2.0, 0.0)});
+
+   scaling_layer.set_scaling_methods(ScalingLayer::MinimumMaximum);
+
+   inputs.set(Vector<size_t>({3, 2}));
+   inputs.randomize_uniform(-2.0, 4.0);
+
+   outputs = scaling_layer.calculate_outputs(inputs);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      assert_true(abs(outputs(i,0) - (2.0*(inputs(i,0) + 1.0)/4.0 - 1.0)) < 1.0e-12, LOG);
+      assert_true(abs(outputs(i,1) - inputs(i,1)) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   scaling_layer.set_descriptives({Descriptives(-1.0, 3.0, 0.5, 1.5), Descriptives(2.0, 6.0, 4.0, 2.0)});
+
+   scaling_layer.set_scaling_methods(Vector<ScalingLayer::ScalingMethod>({ScalingLayer::NoScaling, ScalingLayer::StandardDeviation}));
+
+   outputs = scaling_layer.calculate_outputs(inputs);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      assert_true(abs(outputs(i,0) - inputs(i,0)) < 1.0e-12, LOG);
+      assert_true(abs(outputs(i,1) - inputs(i,1)/2.0) < 1.0e-12, LOG);
+   }
 }
 
 
 void ScalingLayerTest::test_calculate_minimum_maximum_output()
 {
    cout << "test_calculate_minimum_maximum_output\n";
+
+   ScalingLayer scaling_layer(2);
+
+   Tensor<double> inputs(3, 2);
+   Tensor<double> outputs;
+
+   const Vector<Descriptives> descriptives({Descriptives(-1.0, 3.0, 0.5, 1.5), Descriptives(2.0, 6.0, 4.0, 1.0)});
+
+   scaling_layer.set_display(false);
+
+   scaling_layer.set_descriptives(descriptives);
+
+   scaling_layer.set_scaling_methods(ScalingLayer::MinimumMaximum);
+
+   // Test
+
+   inputs.randomize_uniform(-2.0, 7.0);
+
+   outputs = scaling_layer.calculate_outputs(inputs);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      for(size_t j = 0; j < 2; j++)
+      {
+         const double output = 2.0*(inputs(i,j) - descriptives[j].minimum)/(descriptives[j].maximum-descriptives[j].minimum) - 1.0;
+
+         assert_true(abs(outputs(i,j) - output) < 1.0e-12, LOG);
+      }
+   }
+
+   // Test
+
+   inputs.set(Vector<size_t>({1, 2}));
+   inputs.randomize_uniform(-2.0, 7.0);
+
+   outputs = scaling_layer.calculate_outputs(inputs);
+
+   const Tensor<double> minimum_maximum_outputs = scaling_layer.calculate_minimum_maximum_outputs(inputs);
+
+   assert_true(abs(outputs(0,0) - minimum_maximum_outputs(0,0)) < 1.0e-12, LOG);
+   assert_true(abs(outputs(0,1) - minimum_maximum_outputs(0,1)) < 1.0e-12, LOG);
 }
 
 
 void ScalingLayerTest::test_calculate_mean_standard_deviation_output()
 {
    cout << "test_calculate_mean_standard_deviation_output\n";
+
+   ScalingLayer scaling_layer(2);
+
+   Tensor<double> inputs(3, 2);
+   Tensor<double> outputs;
+
+   const Vector<Descriptives> descriptives({Descriptives(-1.0, 3.0, 0.5, 1.5), Descriptives(2.0, 6.0, 4.0, 1.0)});
+
+   scaling_layer.set_display(false);
+
+   scaling_layer.set_descriptives(descriptives);
+
+   scaling_layer.set_scaling_methods(ScalingLayer::MeanStandardDeviation);
+
+   // Test
+
+   inputs.randomize_uniform(-2.0, 7.0);
+
+   outputs = scaling_layer.calculate_outputs(inputs);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      for(size_t j = 0; j < 2; j++)
+      {
+         const double output = (inputs(i,j) - descriptives[j].mean)/descriptives[j].standard_deviation;
+
+         assert_true(abs(outputs(i,j) - output) < 1.0e-12, LOG);
+      }
+   }
+
+   // Test
+
+   inputs.set(Vector<size_t>({1, 2}));
+   inputs.randomize_uniform(-2.0, 7.0);
+
+   outputs = scaling_layer.calculate_outputs(inputs);
+
+   const Tensor<double> mean_standard_deviation_outputs = scaling_layer.calculate_mean_standard_deviation_outputs(inputs);
+
+   assert_true(abs(outputs(0,0) - mean_standard_deviation_outputs(0,0)) < 1.0e-12, LOG);
+   assert_true(abs(outputs(0,1) - mean_standard_deviation_outputs(0,1)) < 1.0e-12, LOG);
 }
 
 
@@ -484,6 +600,8 @@ void ScalingLayerTest::run_test_case()
    // Scaling and unscaling
 
    test_calculate_outputs();
+   test_calculate_minimum_maximum_output();
+   test_calculate_mean_standard_deviation_output();
 
    // Expression methods
 
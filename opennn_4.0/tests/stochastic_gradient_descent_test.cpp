@@ -58,6 +58,61 @@ void StochasticGradientDescentTest::test_set_reserve_all_training_history()
 
 /// @todo
 
+void StochasticGradientDescentTest::test_update_parameters()
+{
+   cout << "test_update_parameters\n";
+
+   StochasticGradientDescent sgd;
+
+   const Vector<double> gradient({1.0, -2.0, 0.5});
+   const double learning_rate = 0.1;
+
+   Vector<double> parameters;
+   Vector<double> last_increment;
+   Vector<double> increment;
+
+   // Test
+
+   sgd.set_momentum(0.0);
+
+   parameters.set(3, 1.0);
+   last_increment.set(3, 0.0);
+
+   sgd.update_parameters(gradient, learning_rate, last_increment, parameters);
+
+   assert_true(absolute_value(parameters - (Vector<double>(3, 1.0) - gradient*learning_rate)) < 1.0e-12, LOG);
+
+   // Test
+
+   sgd.set_momentum(0.9);
+   sgd.set_nesterov(false);
+
+   parameters.set(3, 1.0);
+   last_increment = Vector<double>({0.1, 0.2, 0.3});
+
+   increment = last_increment*0.9 - gradient*learning_rate;
+
+   sgd.update_parameters(gradient, learning_rate, last_increment, parameters);
+
+   assert_true(absolute_value(last_increment - increment) < 1.0e-12, LOG);
+   assert_true(absolute_value(parameters - (Vector<double>(3, 1.0) + increment)) < 1.0e-12, LOG);
+
+   // Test
+
+   sgd.set_nesterov(true);
+
+   parameters.set(3, 1.0);
+   last_increment = Vector<double>({0.1, 0.2, 0.3});
+
+   increment = last_increment*0.9 - gradient*learning_rate;
+
+   sgd.update_parameters(gradient, learning_rate, last_increment, parameters);
+
+   assert_true(absolute_value(last_increment - increment) < 1.0e-12, LOG);
+   assert_true(absolute_value(parameters - (Vector<double>(3, 1.0) + increment*0.9 - gradient*learning_rate)) < 1.0e-12, LOG);
+}
+
+
 void StochasticGradientDescentTest::test_perform_training()
 {
    cout << "test_perform_training\n";
@@ -148,6 +203,45 @@ void StochasticGradientDescentTest::test_perform_training()
 }
 
 
+void StochasticGradientDescentTest::test_perform_training_gradient_accumulation()
+{
+   cout << "test_perform_training_gradient_accumulation\n";
+
+   DataSet data_set(20, 1, 1);
+   data_set.randomize_data_normal();
+   data_set.set_training();
+
+   NeuralNetwork neural_network(NeuralNetwork::Approximation, {1, 2, 1});
+
+   MeanSquaredError mean_squared_error(&neural_network, &data_set);
+
+   StochasticGradientDescent sgd(&mean_squared_error);
+   sgd.set_display(false);
+   sgd.set_maximum_epochs_number(3);
+
+   Vector<double> parameters;
+
+   // Test
+
+   neural_network.initialize_parameters(0.5);
+
+   data_set.set_batch_instances_number(20);
+
+   sgd.perform_training();
+
+   parameters = neural_network.get_parameters();
+
+   neural_network.initialize_parameters(0.5);
+
+   data_set.set_batch_instances_number(5);
+   sgd.set_gradient_accumulation_steps(4);
+
+   sgd.perform_training();
+
+   assert_true(absolute_value(neural_network.get_parameters() - parameters) < 1.0e-9, LOG);
+}
+
+
 void StochasticGradientDescentTest::test_resize_training_history()
 {
    cout << "test_resize_training_history\n";
@@ -188,6 +282,35 @@ void StochasticGradientDescentTest::test_to_XML()
 void StochasticGradientDescentTest::test_from_XML()
 {
    cout << "test_from_XML\n";
+
+   StochasticGradientDescent sgd1;
+   StochasticGradientDescent sgd2;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   sgd1.set_gradient_accumulation_steps(4);
+
+   document = sgd1.to_XML();
+
+   sgd2.from_XML(*document);
+
+   delete document;
+
+   assert_true(sgd2.get_gradient_accumulation_steps() == 4, LOG);
+
+   // Test
+
+   document = sgd1.to_XML();
+
+   document->FirstChildElement("StochasticGradientDescent")->FirstChildElement("SelectionErrorPeriod")->SetText("0");
+
+   sgd2.from_XML(*document);
+
+   delete document;
+
+   assert_true(sgd2.get_selection_error_period() == 1, LOG);
 }
 
 
@@ -206,7 +329,10 @@ void StochasticGradientDescentTest::run_test_case()
 
    // Training methods
 
+   test_update_parameters();
+
    test_perform_training();
+   test_perform_training_gradient_accumulation();
 
    // Training history methods
 
@@ -41,7 +41,10 @@ public:
 
    // Training methods
 
+   void test_update_parameters();
+
    void test_perform_training();
+   void test_perform_training_gradient_accumulation();
 
    // Training history methods
 
@@ -556,6 +556,139 @@ void SumSquaredErrorTest::test_calculate_selection_error()
 }
 
 
+void SumSquaredErrorTest::test_calculate_terms_second_order_loss()
+{
+   cout << "test_calculate_terms_second_order_loss\n";
+
+   NeuralNetwork neural_network;
+
+   DataSet data_set;
+
+   SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+   sum_squared_error.set_regularization_method(LossIndex::NoRegularization);
+
+   Tensor<double> inputs;
+   Tensor<double> targets;
+
+   Vector<double> error_terms;
+   Matrix<double> terms_Jacobian;
+
+   LossIndex::SecondOrderLoss terms_second_order_loss;
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Approximation, {2, 3, 2});
+
+   neural_network.randomize_parameters_normal();
+
+   data_set.set(10, 2, 2);
+
+   data_set.randomize_data_normal();
+
+   data_set.set_training();
+
+   inputs = data_set.get_training_input_data();
+   targets = data_set.get_training_target_data();
+
+   const Vector<Layer::FirstOrderActivations> forward_propagation = neural_network.calculate_trainable_forward_propagation(inputs);
+
+   error_terms = sum_squared_error.calculate_training_error_terms(forward_propagation[1].activations, targets);
+
+   const Tensor<double> output_gradient = (forward_propagation[1].activations - targets).divide(error_terms, 0);
+
+   const Vector<Tensor<double>> layers_delta = sum_squared_error.calculate_layers_delta(forward_propagation, output_gradient);
+
+   terms_Jacobian = sum_squared_error.calculate_error_terms_Jacobian(inputs, forward_propagation, layers_delta);
+
+   terms_second_order_loss = sum_squared_error.calculate_terms_second_order_loss();
+
+   assert_true(abs(terms_second_order_loss.loss - dot(error_terms, error_terms)) < 1.0e-6, LOG);
+   assert_true(absolute_value(terms_second_order_loss.gradient - dot(error_terms, terms_Jacobian)*2.0) < 1.0e-6, LOG);
+   assert_true(absolute_value(terms_second_order_loss.hessian - dot(terms_Jacobian.calculate_transpose(), terms_Jacobian)*2.0) < 1.0e-6, LOG);
+   assert_true(terms_second_order_loss.hessian == terms_second_order_loss.hessian.calculate_transpose(), LOG);
+
+   // Test
+
+   const Matrix<double> hessian = terms_second_order_loss.hessian;
+
+   sum_squared_error.set_regularization_method(LossIndex::L2);
+   sum_squared_error.set_regularization_weight(0.1);
+
+   terms_second_order_loss = sum_squared_error.calculate_terms_second_order_loss();
+
+   assert_true(abs(terms_second_order_loss.loss - sum_squared_error.calculate_training_loss()) < 1.0e-6, LOG);
+   assert_true(absolute_value(terms_second_order_loss.gradient - sum_squared_error.calculate_training_loss_gradient()) < 1.0e-6, LOG);
+   assert_true(absolute_value(terms_second_order_loss.hessian - hessian - sum_squared_error.calculate_regularization_hessian()*0.1) < 1.0e-6, LOG);
+}
+
+
+void SumSquaredErrorTest::test_calculate_terms_hessian_product()
+{
+   cout << "test_calculate_terms_hessian_product\n";
+
+   NeuralNetwork neural_network;
+
+   DataSet data_set;
+
+   SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+   LossIndex::SecondOrderLoss terms_second_order_loss;
+
+   Vector<double> direction;
+
+   // Test
+
+   neural_network.set(NeuralNetwork::Approximation, {2, 3, 2});
+
+   neural_network.randomize_parameters_normal();
+
+   data_set.set(10, 2, 2);
+
+   data_set.randomize_data_normal();
+
+   data_set.set_training();
+
+   direction.set(neural_network.get_parameters_number());
+
+   direction.randomize_normal();
+
+   terms_second_order_loss = sum_squared_error.calculate_terms_second_order_loss();
+
+   assert_true(absolute_value(sum_squared_error.calculate_terms_hessian_product(direction) - dot(terms_second_order_loss.hessian, direction)) < 1.0e-6, LOG);
+
+   // Test
+
+   sum_squared_error.set_regularization_method(LossIndex::L2);
+   sum_squared_error.set_regularization_weight(0.1);
+
+   terms_second_order_loss = sum_squared_error.calculate_terms_second_order_loss();
+
+   assert_true(absolute_value(sum_squared_error.calculate_terms_hessian_product(direction) - dot(terms_second_order_loss.hessian, direction)) < 1.0e-6, LOG);
+
+   // Test
+
+   sum_squared_error.set_regularization_method(LossIndex::NoRegularization);
+
+   terms_second_order_loss = sum_squared_error.calculate_terms_second_order_loss();
+
+   assert_true(absolute_value(sum_squared_error.calculate_terms_hessian_diagonal() - terms_second_order_loss.hessian.get_diagonal()) < 1.0e-6, LOG);
+
+   // Test
+
+   const Vector<double> hessian_product = sum_squared_error.calculate_terms_hessian_product(direction);
+   const Vector<double> hessian_diagonal = sum_squared_error.calculate_terms_hessian_diagonal();
+
+   data_set.set_batch_instances_number(4);
+
+   assert_true(sum_squared_error.get_error_terms_Jacobian_batches().size() == 3, LOG);
+   assert_true(sum_squared_error.get_error_terms_Jacobian_batches()[2].size() == 2, LOG);
+
+   assert_true(absolute_value(sum_squared_error.calculate_terms_hessian_product(direction) - hessian_product) < 1.0e-10, LOG);
+   assert_true(absolute_value(sum_squared_error.calculate_terms_hessian_diagonal() - hessian_diagonal) < 1.0e-10, LOG);
+}
+
+
 void SumSquaredErrorTest::test_calculate_squared_errors()
 {
    cout << "test_calculate_squared_errors\n";
@@ -671,6 +804,10 @@ void SumSquaredErrorTest::run_test_case()
 
 //   test_calculate_training_error_terms_Jacobian();
 
+   test_calculate_terms_second_order_loss();
+
+   test_calculate_terms_hessian_product();
+
    //Serialization methods
 
     test_to_XML();
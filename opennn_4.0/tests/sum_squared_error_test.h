@@ -54,6 +54,10 @@ public:
 
    void test_calculate_training_error_terms_Jacobian();
 
+   void test_calculate_terms_second_order_loss();
+
+   void test_calculate_terms_hessian_product();
+
    // Other methods
 
    void test_calculate_squared_errors();
@@ -23,6 +23,7 @@ DESTDIR = "$$PWD/bin"
 
 SOURCES += \
     data_set_test.cpp \
+    data_set_view_test.cpp \
     unscaling_layer_test.cpp \
     scaling_layer_test.cpp \
     probabilistic_layer_test.cpp \
@@ -46,17 +47,22 @@ SOURCES += \
     model_selection_test.cpp \
     neurons_selection_test.cpp \
     incremental_neurons_test.cpp \
+    evaluation_cache_test.cpp \
+    checkpoint_test.cpp \
     inputs_selection_test.cpp \
     growing_inputs_test.cpp \
     pruning_inputs_test.cpp \
     genetic_algorithm_test.cpp \
     testing_analysis_test.cpp \
+    random_test.cpp \
     vector_test.cpp \
     matrix_test.cpp \
     tensor_test.cpp \
     numerical_differentiation_test.cpp \
     correlations_test.cpp \
     stochastic_gradient_descent_test.cpp \
+    adaptive_moment_estimation_test.cpp \
+    learning_rate_schedule_test.cpp \
     statistics_test.cpp \
     metrics_test.cpp \
     convolutional_layer_test.cpp \
@@ -68,6 +74,7 @@ SOURCES += \
 HEADERS += \
     unit_testing.h \
     data_set_test.h \
+    data_set_view_test.h \
     unscaling_layer_test.h \
     scaling_layer_test.h \
     probabilistic_layer_test.h \
@@ -91,17 +98,22 @@ HEADERS += \
     model_selection_test.h \
     neurons_selection_test.h \
     incremental_neurons_test.h \
+    evaluation_cache_test.h \
+    checkpoint_test.h \
     inputs_selection_test.h \
     growing_inputs_test.h \
     pruning_inputs_test.h \
     genetic_algorithm_test.h \
     testing_analysis_test.h  \
+    random_test.h \
     vector_test.h \
     matrix_test.h \
     tensor_test.h \
     numerical_differentiation_test.h \
     opennn_tests.h \
     stochastic_gradient_descent_test.h \
+    adaptive_moment_estimation_test.h \
+    learning_rate_schedule_test.h \
     correlations_test.h \
     statistics_test.h \
     metrics_test.h \
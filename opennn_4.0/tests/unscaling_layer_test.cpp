@@ -235,6 +235,63 @@ void UnscalingLayerTest::test_calculate_outputs()
    inputs[0] = 0.0;
 
    //assert_true(ul.calculate_outputs(inputs.to_row_matrix()) == inputs, LOG);
+
+   // Test
+
+   Tensor<double> batch_inputs(3, 2);
+   Tensor<double> outputs;
+   Tensor<double> method_outputs;
+
+   batch_inputs.randomize_uniform(-1.0, 1.0);
+
+   ul.set(2);
+
+   ul.set_descriptives({Descriptives(-1.0, 3.0, 0.5, 1.5), Descriptives(2.0, 2.0, 2.0, 0.0)});
+
+   ul.set_unscaling_method(UnscalingLayer::NoUnscaling);
+
+   outputs = ul.calculate_outputs(batch_inputs);
+
+   assert_true(outputs == batch_inputs, LOG);
+
+   // Test
+
+   ul.set_unscaling_method(UnscalingLayer::MinimumMaximum);
+
+   outputs = ul.calculate_outputs(batch_inputs);
+   method_outputs = ul.calculate_minimum_maximum_outputs(batch_inputs);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      assert_true(abs(outputs(i,0) - method_outputs(i,0)) < 1.0e-12, LOG);
+      assert_true(abs(outputs(i,1) - method_outputs(i,1)) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   ul.set_unscaling_method(UnscalingLayer::MeanStandardDeviation);
+
+   outputs = ul.calculate_outputs(batch_inputs);
+   method_outputs = ul.calculate_mean_standard_deviation_outputs(batch_inputs);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      assert_true(abs(outputs(i,0) - method_outputs(i,0)) < 1.0e-12, LOG);
+      assert_true(abs(outputs(i,1) - method_outputs(i,1)) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   ul.set_unscaling_method(UnscalingLayer::Logarithmic);
+
+   outputs = ul.calculate_outputs(batch_inputs);
+   method_outputs = ul.calculate_logarithmic_outputs(batch_inputs);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      assert_true(abs(outputs(i,0) - method_outputs(i,0)) < 1.0e-12, LOG);
+      assert_true(abs(outputs(i,1) - method_outputs(i,1)) < 1.0e-12, LOG);
+   }
 }
 
 